@@ -0,0 +1,175 @@
+/*
+ * This file is part of the MPU6050-Library distribution (https://github.com/jmherzog-de/MPU6050-Library).
+ * Copyright (c) 2021 Jean-Marcel Herzog.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+/**
+ *  \file bench_acquisition.c
+ *  \brief Polled and interrupt driven sample acquisition
+ *  
+ *  Acquires samples from the simulated sensor at 1kHz in three ways and
+ *  prints bus transactions per sample, duplicate samples and the latency
+ *  from the sampling instant to the consumer:
+ *  
+ *  - free-running burst reads every 250us
+ *  - polling INT_STATUS every 250us, burst read on DATA_RDY
+ *  - INT pin edge starting an asynchronous burst read (mpu6050_acqStart())
+ *  
+ *  The program exits with a non-zero value if the interrupt driven
+ *  acquisition misses or duplicates a sample or needs more than one bus
+ *  transaction per sample.
+ *  
+ *  Build and run on a host computer:
+ *  
+ *      gcc -Ilib -Ihardware/Host bench/bench_acquisition.c lib/mpu6050_*.c hardware/Host/sim.c -o bench_acquisition
+ *      ./bench_acquisition
+ *  
+ *  \copyright Copyright 2021 Jean-Marcel Herzog. All rights reserved. This project is released under the GNU Public License.
+ */
+
+#include <stdio.h>
+#include "mpu6050.h"
+#include "sim.h"
+
+#define BENCH_SAMPLES   1000
+#define BENCH_POLL_NS   250000
+
+/**
+ *  \brief Result of one acquisition method
+ */
+typedef struct
+{
+    uint32_t delivered;         /**< Samples passed to the consumer */
+    uint32_t duplicates;        /**< Samples passed more than once */
+    uint32_t lastSample;        /**< Sample number of the last delivered sample */
+    uint64_t latencyNs;         /**< Sum of the sampling to consumer latencies */
+    uint32_t taken;             /**< Samples taken by the sensor */
+    uint32_t transactions;      /**< Bus transactions */
+}
+tBENCH_RESULT;
+
+static tSIM_MPU6050 sim;
+static tMPU6050_DEV dev;
+static tMPU6050_ACQ acq;
+
+static void bench_setup(void)
+{
+    sim_initialization(&sim, MPU6050_I2C_ADDR);
+    mpu6050_devInitialization(&dev, &sim.transport, MPU6050_I2C_ADDR);
+
+    // wake up, DLPF 44Hz -> 1kHz sample rate
+    mpu6050_busWrite(&dev, MPU6050_CONFIG, 0x03);
+    mpu6050_busWrite(&dev, MPU6050_PWR_MGMT_1, 0x00);
+}
+
+/** Start of the measurement: statistics and sample counter */
+static void bench_start(tBENCH_RESULT *result)
+{
+    sim_statsReset(&sim);
+    result->taken = sim.ui32Samples;
+    result->lastSample = sim.ui32Samples;
+}
+
+/** End of the measurement */
+static void bench_stop(tBENCH_RESULT *result)
+{
+    result->taken = sim.ui32Samples - result->taken;
+    result->transactions = sim.stats.TRANSACTIONS;
+}
+
+/** Consumer: the registers hold sample number sim.ui32Samples */
+static void bench_consume(tBENCH_RESULT *result)
+{
+    if(sim.ui32Samples == result->lastSample)
+        result->duplicates++;
+    result->lastSample = sim.ui32Samples;
+    result->delivered++;
+    result->latencyNs += sim.ui64TimeNs - sim.ui64SampleNs;
+}
+
+static void bench_acqSample(tMPU6050_DEV *obj, const tMPU6050_SAMPLE *sample, void *arg)
+{
+    (void)obj;
+    (void)sample;
+    bench_consume((tBENCH_RESULT*)arg);
+}
+
+static void bench_intPin(void *arg)
+{
+    mpu6050_acqIntEdge((tMPU6050_ACQ*)arg);
+}
+
+static void bench_print(const char *name, const tBENCH_RESULT *result)
+{
+    printf("%-10s %9u %9u %11u %13.2f %14.1f\n", name,
+           (unsigned)result->taken, (unsigned)result->delivered, (unsigned)result->duplicates,
+           result->delivered ? (double)result->transactions / result->delivered : 0.0,
+           result->delivered ? result->latencyNs / 1000.0 / result->delivered : 0.0);
+}
+
+int main(void)
+{
+    tBENCH_RESULT freeRun = { 0 };
+    tBENCH_RESULT polled = { 0 };
+    tBENCH_RESULT irq = { 0 };
+    tMPU6050_MOTION motion;
+    tMPU6050_INT_STATUS status;
+    uint64_t end;
+
+    // free-running: read without knowing if there is a new sample
+    bench_setup();
+    bench_start(&freeRun);
+    end = sim.ui64TimeNs + (uint64_t)BENCH_SAMPLES * sim_samplePeriodNs(&sim);
+    while(sim.ui64TimeNs < end)
+    {
+        mpu6050_motionReadBurst(&dev, &motion);
+        bench_consume(&freeRun);
+        sim_clockAdvance(&sim, BENCH_POLL_NS - sim.ui64TimeNs % BENCH_POLL_NS);
+    }
+    bench_stop(&freeRun);
+
+    // polling: one INT_STATUS read per poll
+    bench_setup();
+    bench_start(&polled);
+    end = sim.ui64TimeNs + (uint64_t)BENCH_SAMPLES * sim_samplePeriodNs(&sim);
+    while(sim.ui64TimeNs < end)
+    {
+        mpu6050_intStatusReadReg(&dev, &status);
+        if(status.DATA_RDY_INT)
+        {
+            mpu6050_motionReadBurst(&dev, &motion);
+            bench_consume(&polled);
+        }
+        sim_clockAdvance(&sim, BENCH_POLL_NS - sim.ui64TimeNs % BENCH_POLL_NS);
+    }
+    bench_stop(&polled);
+
+    // interrupt driven: the INT pin starts the burst read
+    bench_setup();
+    sim_intHandlerSet(&sim, bench_intPin, &acq);
+    mpu6050_acqStart(&dev, &acq, 0, bench_acqSample, &irq);
+    bench_start(&irq);
+    sim_clockAdvance(&sim, (uint64_t)BENCH_SAMPLES * sim_samplePeriodNs(&sim));
+    sim_queueFlush(&sim);
+    bench_stop(&irq);
+    mpu6050_acqStop(&acq);
+
+    printf("%-10s %9s %9s %11s %13s %14s\n", "method", "samples", "consumed", "duplicates", "trans/sample", "latency [us]");
+    bench_print("free-run", &freeRun);
+    bench_print("polling", &polled);
+    bench_print("interrupt", &irq);
+    printf("interrupt: %u overruns, %u errors\n", (unsigned)acq.OVERRUNS, (unsigned)acq.ERRORS);
+
+    return (irq.delivered != irq.taken || irq.duplicates || irq.transactions > irq.delivered) ? 1 : 0;
+}
@@ -0,0 +1,258 @@
+/*
+ * This file is part of the MPU6050-Library distribution (https://github.com/jmherzog-de/MPU6050-Library).
+ * Copyright (c) 2021 Jean-Marcel Herzog.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ *  \file bench_asciiFormat.c
+ *  \brief ASCII formatting check and speed
+ *  
+ *  Compares the decimal, fixed-point, Q16.16 and hex rendering of
+ *  asciiFormat.c with snprintf() for edge values and 200000 random values.
+ *  Then renders CSV records of a sample number and one raw sample
+ *  
+ *      sample number,accel x,accel y,accel z,temperature,gyro x,gyro y,gyro z
+ *  
+ *  and prints the time per record next to the former uart_ascii.c
+ *  conversion (repeated subtraction, one call per character), the bytes per
+ *  record and the baud rate a 1kHz CSV stream needs.
+ *  
+ *  The program exits with a non-zero value if a rendered value differs
+ *  from snprintf() or the record formatting is not faster than the former
+ *  conversion.
+ *  
+ *  Build and run on a host computer:
+ *  
+ *      gcc -O2 -Ilib -Ihardware bench/bench_asciiFormat.c hardware/asciiFormat.c -o bench_asciiFormat
+ *      ./bench_asciiFormat
+ *  
+ *  \copyright Copyright 2021 Jean-Marcel Herzog. All rights reserved. This project is released under the GNU Public License.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include "asciiFormat.h"
+
+#define BENCH_VALUES        200000
+#define BENCH_RECORDS       1000
+#define BENCH_LOOPS         200
+#define BENCH_RECORD_SIZE   96
+
+static uint32_t seed = 1;
+
+static uint32_t bench_random(void)
+{
+    seed = seed * 1103515245u + 12345u;
+    return (seed >> 16) | ((seed * 1103515245u + 12345u) & 0xFFFF0000u);
+}
+
+/**
+ *  \brief Compare a rendered value with the expected text
+ *  
+ *  \return Number of errors
+ */
+static unsigned int bench_compare(const char *pcWhat, const char *pcBegin, const char *pcEnd, const char *pcExpected)
+{
+    if((size_t)(pcEnd - pcBegin) == strlen(pcExpected) && !memcmp(pcBegin, pcExpected, pcEnd - pcBegin))
+        return 0;
+
+    printf("%s: got \"%.*s\", expected \"%s\"\n", pcWhat, (int)(pcEnd - pcBegin), pcBegin, pcExpected);
+    return 1;
+}
+
+/**
+ *  \brief Check one value in all formats
+ *  
+ *  \return Number of errors
+ */
+static unsigned int bench_check(uint32_t ui32Val, uint8_t ui8Decimals, uint8_t ui8Digits)
+{
+    static const uint32_t pow10[10] = { 1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000, 1000000000 };
+    char text[32], expected[48];
+    int32_t s = (int32_t)ui32Val;
+    uint32_t magnitude = s < 0 ? 0u - ui32Val : ui32Val;
+    unsigned int errors = 0;
+    int64_t q;
+
+    snprintf(expected, sizeof(expected), "%u", (unsigned)ui32Val);
+    errors += bench_compare("U32", text, ascii_formatU32(text, ui32Val), expected);
+
+    snprintf(expected, sizeof(expected), "%d", (int)s);
+    errors += bench_compare("S32", text, ascii_formatS32(text, s), expected);
+
+    if(ui8Decimals == 0)
+        snprintf(expected, sizeof(expected), "%d", (int)s);
+    else
+        snprintf(expected, sizeof(expected), "%s%u.%0*u", s < 0 ? "-" : "", (unsigned)(magnitude / pow10[ui8Decimals]),
+                 ui8Decimals, (unsigned)(magnitude % pow10[ui8Decimals]));
+    errors += bench_compare("fixed", text, ascii_formatFixed(text, s, ui8Decimals), expected);
+
+    snprintf(expected, sizeof(expected), "%0*X", ui8Digits, (unsigned)(ui8Digits < 8 ? ui32Val & ((1u << (4 * ui8Digits)) - 1) : ui32Val));
+    errors += bench_compare("hex", text, ascii_formatHex(text, ui32Val, ui8Digits), expected);
+
+    // Q16.16 with up to 4 decimals, rounded half away from zero
+    if(ui8Decimals <= 4)
+    {
+        tASCII_RECORD rec;
+
+        q = (int64_t)s * pow10[ui8Decimals];
+        q = (q + (q < 0 ? -32768 : 32768)) / 65536;
+        magnitude = (uint32_t)(q < 0 ? -q : q);
+        if(ui8Decimals == 0)
+            snprintf(expected, sizeof(expected), "%d", (int)q);
+        else
+            snprintf(expected, sizeof(expected), "%s%u.%0*u", q < 0 ? "-" : "", (unsigned)(magnitude / pow10[ui8Decimals]),
+                     ui8Decimals, (unsigned)(magnitude % pow10[ui8Decimals]));
+        ascii_recordInitialization(&rec, text, sizeof(text));
+        ascii_putQ16(&rec, s, ui8Decimals);
+        errors += bench_compare("Q16", text, text + rec.ui16Len, expected);
+    }
+
+    return errors;
+}
+
+/** Character sink of the former conversion */
+static char *formerOut;
+
+static void bench_formerPutc(unsigned char character)
+{
+    *formerOut++ = (char)character;
+}
+
+static void (*volatile formerPutc)(unsigned char) = bench_formerPutc;
+
+/**
+ *  \brief Former uart_putU16AsASCII(): repeated subtraction, one call per character
+ */
+static void bench_formerU16(uint16_t ui16Val)
+{
+    uint8_t digit1 = '0', digit2 = '0', digit3 = '0', digit4 = '0';
+    bool prevprint = 0;
+
+    while(ui16Val >= 10000) { ui16Val -= 10000; digit1++; }
+    while(ui16Val >= 1000) { ui16Val -= 1000; digit2++; }
+    while(ui16Val >= 100) { ui16Val -= 100; digit3++; }
+    while(ui16Val >= 10) { ui16Val -= 10; digit4++; }
+
+    if(digit1 != '0') { formerPutc(digit1); prevprint = 1; }
+    if(prevprint || digit2 != '0') { formerPutc(digit2); prevprint = 1; }
+    if(prevprint || digit3 != '0') { formerPutc(digit3); prevprint = 1; }
+    if(prevprint || digit4 != '0') formerPutc(digit4);
+    formerPutc(ui16Val + '0');
+}
+
+static void bench_formerS16(int16_t i16Val)
+{
+    if(i16Val < 0)
+    {
+        formerPutc('-');
+        bench_formerU16((uint16_t)(0 - (uint16_t)i16Val));
+    }
+    else
+    {
+        bench_formerU16((uint16_t)i16Val);
+    }
+}
+
+int main(void)
+{
+    static tMPU6050_MOTION samples[BENCH_RECORDS];
+    static char out[BENCH_RECORDS * BENCH_RECORD_SIZE];
+    static const uint32_t edges[] =
+    {
+        0, 1, 9, 10, 99, 100, 101, 999, 1000, 9999, 10000, 32767, 32768, 65535, 65536,
+        99999999, 100000000, 999999999, 1000000000, 2147483647, 2147483648u, 4294967295u,
+        0xFFFF8000u, 0xFFFFFFFFu, 0xFFFFFFF6u
+    };
+    char line[BENCH_RECORD_SIZE];
+    tASCII_RECORD rec;
+    unsigned int errors = 0;
+    uint32_t i, loop, bytes = 0, formerBytes = 0;
+    double recordNs, formerNs;
+    clock_t start;
+
+    for(i = 0; i < sizeof(edges) / sizeof(edges[0]); i++)
+        for(loop = 0; loop < 10; loop++)
+            errors += bench_check(edges[i], (uint8_t)loop, (uint8_t)(loop % 8 + 1));
+    for(i = 0; i < BENCH_VALUES; i++)
+        errors += bench_check(bench_random() >> (bench_random() % 32), (uint8_t)(i % 10), (uint8_t)(i % 8 + 1));
+    printf("%u rendering errors\n", errors);
+
+    for(i = 0; i < BENCH_RECORDS; i++)
+    {
+        samples[i].ACCEL.X = (int16_t)(bench_random() % 1024 - 512);
+        samples[i].ACCEL.Y = (int16_t)(bench_random() % 1024 - 512);
+        samples[i].ACCEL.Z = (int16_t)(16384 + bench_random() % 1024 - 512);
+        samples[i].TEMP = (int16_t)(-3900 + bench_random() % 32);
+        samples[i].GYRO.X = (int16_t)(bench_random() % 256 - 128);
+        samples[i].GYRO.Y = (int16_t)(bench_random() % 256 - 128);
+        samples[i].GYRO.Z = (int16_t)(bench_random() % 256 - 128);
+    }
+
+    // records into a caller buffer, one copy per record stands in for uart_write()
+    ascii_recordInitialization(&rec, line, sizeof(line));
+    start = clock();
+    for(loop = 0; loop < BENCH_LOOPS; loop++)
+    {
+        char *o = out;
+
+        for(i = 0; i < BENCH_RECORDS; i++)
+        {
+            ascii_putU32(&rec, i);
+            ascii_putChar(&rec, ',');
+            ascii_putMotion(&rec, &samples[i], ',');
+            ascii_putChar(&rec, '\n');
+            memcpy(o, line, rec.ui16Len);
+            o += rec.ui16Len;
+            ascii_recordClear(&rec);
+        }
+        bytes = (uint32_t)(o - out);
+    }
+    recordNs = (double)(clock() - start) * 1e9 / CLOCKS_PER_SEC / BENCH_LOOPS / BENCH_RECORDS;
+
+    // former conversion, one call per character
+    start = clock();
+    for(loop = 0; loop < BENCH_LOOPS; loop++)
+    {
+        formerOut = out;
+        for(i = 0; i < BENCH_RECORDS; i++)
+        {
+            bench_formerU16((uint16_t)i);
+            formerPutc(',');
+            bench_formerS16(samples[i].ACCEL.X); formerPutc(',');
+            bench_formerS16(samples[i].ACCEL.Y); formerPutc(',');
+            bench_formerS16(samples[i].ACCEL.Z); formerPutc(',');
+            bench_formerS16(samples[i].TEMP); formerPutc(',');
+            bench_formerS16(samples[i].GYRO.X); formerPutc(',');
+            bench_formerS16(samples[i].GYRO.Y); formerPutc(',');
+            bench_formerS16(samples[i].GYRO.Z); formerPutc('\n');
+        }
+        formerBytes = (uint32_t)(formerOut - out);
+    }
+    formerNs = (double)(clock() - start) * 1e9 / CLOCKS_PER_SEC / BENCH_LOOPS / BENCH_RECORDS;
+
+    printf("CSV record: %.1f bytes\n", (double)bytes / BENCH_RECORDS);
+    printf("record formatting  %8.1f ns/record\n", recordNs);
+    printf("former conversion  %8.1f ns/record (%.1f bytes)\n", formerNs, (double)formerBytes / BENCH_RECORDS);
+    printf("1kHz CSV stream: %.0f bytes/s, needs %.0f baud 8N1 (115200 baud carries %.0f records/s)\n",
+           bytes * 1000.0 / BENCH_RECORDS, bytes * 10000.0 / BENCH_RECORDS, 11520.0 * BENCH_RECORDS / bytes);
+
+    if(recordNs >= formerNs)
+        errors++;
+
+    printf("%u errors\n", errors);
+    return errors ? 1 : 0;
+}
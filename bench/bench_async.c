@@ -0,0 +1,106 @@
+/*
+ * This file is part of the MPU6050-Library distribution (https://github.com/jmherzog-de/MPU6050-Library).
+ * Copyright (c) 2021 Jean-Marcel Herzog.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ *  \file bench_async.c
+ *  \brief CPU load of blocking and interrupt driven transfers
+ *  
+ *  Reads accelerometer, temperature and gyroscope (14 byte burst) once per
+ *  sample from the simulated sensor at 1kHz, first with blocking calls and
+ *  then with asynchronous transfers. Prints the CPU time the driver needs
+ *  per sample. The program exits with a non-zero value if the asynchronous
+ *  transfers miss a sample or do not reduce the CPU time.
+ *  
+ *  Build and run on a host computer:
+ *  
+ *      gcc -Ilib -Ihardware/Host bench/bench_async.c lib/mpu6050_*.c hardware/Host/sim.c -o bench_async
+ *      ./bench_async
+ *  
+ *  \copyright Copyright 2021 Jean-Marcel Herzog. All rights reserved. This project is released under the GNU Public License.
+ */
+
+#include <stdio.h>
+#include "mpu6050.h"
+#include "sim.h"
+
+#define BENCH_SAMPLES   1000
+
+static tSIM_MPU6050 sim;
+static tMPU6050_DEV dev;
+static tMPU6050_TRANSFER transfer;
+static uint8_t buffer[MPU6050_MOTION_BURST_LEN];
+static uint32_t completed;
+
+static void bench_transferDone(tMPU6050_TRANSFER *obj)
+{
+    if(obj->ERROR == 0)
+        completed++;
+}
+
+static void bench_setup(void)
+{
+    sim_initialization(&sim, MPU6050_I2C_ADDR);
+    mpu6050_devInitialization(&dev, &sim.transport, MPU6050_I2C_ADDR);
+
+    // wake up, DLPF 44Hz -> 1kHz sample rate
+    mpu6050_busWrite(&dev, MPU6050_CONFIG, 0x03);
+    mpu6050_busWrite(&dev, MPU6050_PWR_MGMT_1, 0x00);
+    sim_statsReset(&sim);
+}
+
+int main(void)
+{
+    uint64_t period;
+    uint64_t blockingNs;
+    uint64_t asyncNs;
+    uint32_t i;
+    tMPU6050_MOTION motion;
+
+    // blocking: the CPU waits for every byte on the bus
+    bench_setup();
+    period = sim_samplePeriodNs(&sim);
+    for(i = 0; i < BENCH_SAMPLES; i++)
+    {
+        mpu6050_motionReadBurst(&dev, &motion);
+        sim_clockAdvance(&sim, period - sim.ui64TimeNs % period);
+    }
+    blockingNs = sim.stats.CPU_BUSY_NS;
+
+    // asynchronous: the transfer runs in the background
+    bench_setup();
+    completed = 0;
+    for(i = 0; i < BENCH_SAMPLES; i++)
+    {
+        transfer.REG = MPU6050_ACCEL_XOUT_H;
+        transfer.READ = true;
+        transfer.DATA = buffer;
+        transfer.COUNT = MPU6050_MOTION_BURST_LEN;
+        transfer.callback = bench_transferDone;
+        transfer.arg = 0;
+        mpu6050_busSubmit(&dev, &transfer);
+        sim_clockAdvance(&sim, period - sim.ui64TimeNs % period);
+    }
+    sim_queueFlush(&sim);
+    asyncNs = sim.stats.CPU_BUSY_NS;
+
+    printf("%-12s %16s %12s\n", "driver", "cpu/sample [us]", "interrupts");
+    printf("%-12s %16.2f %12s\n", "blocking", blockingNs / 1000.0 / BENCH_SAMPLES, "-");
+    printf("%-12s %16.2f %12u\n", "async", asyncNs / 1000.0 / BENCH_SAMPLES, (unsigned)sim.stats.INTERRUPTS);
+    printf("completed %u of %u transfers\n", (unsigned)completed, BENCH_SAMPLES);
+
+    return (completed != BENCH_SAMPLES || asyncNs >= blockingNs) ? 1 : 0;
+}
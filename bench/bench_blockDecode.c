@@ -0,0 +1,218 @@
+/*
+ * This file is part of the MPU6050-Library distribution (https://github.com/jmherzog-de/MPU6050-Library).
+ * Copyright (c) 2021 Jean-Marcel Herzog.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ *  \file bench_blockDecode.c
+ *  \brief Block decoder check and speed
+ *  
+ *  Checks mpu6050_blockDecode() against the scalar code for every channel
+ *  count and block lengths that end inside a SIMD step (each block in its
+ *  own allocation, so a sanitizer catches reads past the end), a frame of 7
+ *  channels against mpu6050_motionDecode() and the float output against
+ *  the scaled values of mpu6050_scaledMeasurements.c. Afterwards prints the
+ *  decode rate of a 14 MByte block of burst frames for the scalar code, the
+ *  SIMD code and the float output. The program exits with a non-zero value
+ *  if a check fails.
+ *  
+ *  The instruction set follows the compiler target, build once per target:
+ *  
+ *      gcc -O2 -Ilib bench/bench_blockDecode.c lib/mpu6050_*.c -o bench_blockDecode
+ *      gcc -O2 -mssse3 -Ilib bench/bench_blockDecode.c lib/mpu6050_*.c -o bench_blockDecode
+ *      gcc -O2 -mavx2 -Ilib bench/bench_blockDecode.c lib/mpu6050_*.c -o bench_blockDecode
+ *      ./bench_blockDecode
+ *  
+ *  \copyright Copyright 2021 Jean-Marcel Herzog. All rights reserved. This project is released under the GNU Public License.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "mpu6050.h"
+
+#define BENCH_FRAMES    1000000
+#define BENCH_LOOPS     10
+
+/** Longest block of the channel count check */
+#define BENCH_CHECK_FRAMES  40
+
+static const char *isaNames[] = { "scalar", "SSSE3", "AVX2", "NEON" };
+
+static uint8_t *data;
+static int16_t *channel[MPU6050_BLOCK_MAX_CHANNELS];
+static float *channelF[MPU6050_BLOCK_MAX_CHANNELS];
+
+/**
+ *  \brief Compare SIMD and scalar decode of every channel count and length
+ *  
+ *  \return Number of errors
+ */
+static unsigned int checkChannels(void)
+{
+    static int16_t ref[MPU6050_BLOCK_MAX_CHANNELS][BENCH_CHECK_FRAMES];
+    static int16_t out[MPU6050_BLOCK_MAX_CHANNELS][BENCH_CHECK_FRAMES + 1];
+    int16_t *pRef[MPU6050_BLOCK_MAX_CHANNELS];
+    int16_t *pOut[MPU6050_BLOCK_MAX_CHANNELS];
+    unsigned int errors = 0;
+    uint32_t frames;
+    uint8_t ch, c;
+
+    for(c = 0; c < MPU6050_BLOCK_MAX_CHANNELS; c++)
+    {
+        pRef[c] = ref[c];
+        pOut[c] = out[c];
+    }
+
+    for(ch = 1; ch <= MPU6050_BLOCK_MAX_CHANNELS; ch++)
+        for(frames = 0; frames <= BENCH_CHECK_FRAMES; frames++)
+        {
+            uint8_t *block = malloc(frames * ch * 2u + 1);
+
+            memcpy(block, data, frames * ch * 2u);
+            memset(out, 0x55, sizeof(out));
+            mpu6050_blockDecodeScalar(block, frames, ch, pRef);
+            mpu6050_blockDecode(block, frames, ch, pOut);
+            free(block);
+
+            for(c = 0; c < ch; c++)
+                if(memcmp(ref[c], out[c], frames * sizeof(int16_t)) != 0 || out[c][frames] != 0x5555)
+                {
+                    printf("%u channels, %u frames: channel %u differs\n", ch, frames, c);
+                    errors++;
+                }
+        }
+    return errors;
+}
+
+/**
+ *  \brief Compare decoded burst frames with mpu6050_motionDecode()
+ *  
+ *  \return Number of errors
+ */
+static unsigned int checkMotion(void)
+{
+    tMPU6050_DEV dev;
+    unsigned int errors = 0;
+    uint32_t f;
+    float scale[7], offset[7] = { 0, 0, 0, MPU6050_TEMP_OFFSET, 0, 0, 0 };
+
+    mpu6050_devInitialization(&dev, 0, MPU6050_I2C_ADDR);
+    mpu6050_devAccelRangeSet(&dev, 2);
+    mpu6050_devGyroRangeSet(&dev, 1);
+    scale[0] = scale[1] = scale[2] = dev.ACCEL_SCALE;
+    scale[3] = MPU6050_TEMP_SCALE;
+    scale[4] = scale[5] = scale[6] = dev.GYRO_SCALE;
+
+    mpu6050_blockDecode(data, 1000, 7, channel);
+    mpu6050_blockDecodeFloat(data, 1000, 7, scale, offset, channelF);
+
+    for(f = 0; f < 1000; f++)
+    {
+        tMPU6050_MOTION motion;
+        tMPU6050_MOTION_SI si;
+        float expect[7];
+        uint8_t c;
+
+        mpu6050_motionDecode(data + f * MPU6050_MOTION_BURST_LEN, &motion);
+        mpu6050_motionScale(&dev, &motion, &si);
+
+        if(channel[0][f] != motion.ACCEL.X || channel[1][f] != motion.ACCEL.Y || channel[2][f] != motion.ACCEL.Z ||
+           channel[3][f] != motion.TEMP ||
+           channel[4][f] != motion.GYRO.X || channel[5][f] != motion.GYRO.Y || channel[6][f] != motion.GYRO.Z)
+        {
+            printf("frame %u differs from mpu6050_motionDecode\n", f);
+            errors++;
+        }
+        expect[0] = si.ACCEL.X;
+        expect[1] = si.ACCEL.Y;
+        expect[2] = si.ACCEL.Z;
+        expect[3] = si.TEMP;
+        expect[4] = si.GYRO.X;
+        expect[5] = si.GYRO.Y;
+        expect[6] = si.GYRO.Z;
+        for(c = 0; c < 7; c++)
+        {
+            float diff = channelF[c][f] - expect[c];
+
+            if(diff > 1e-5f || diff < -1e-5f)
+            {
+                printf("frame %u channel %u float %f expected %f\n", f, c, channelF[c][f], expect[c]);
+                errors++;
+            }
+        }
+    }
+    return errors;
+}
+
+/**
+ *  \brief Time one decoder over the benchmark block
+ *  
+ *  \return Nanoseconds per frame
+ */
+static double timeDecode(void (*decode)(const uint8_t*, uint32_t, uint8_t, int16_t * const*))
+{
+    clock_t start;
+    unsigned int loop;
+
+    decode(data, BENCH_FRAMES, 7, channel);
+    start = clock();
+    for(loop = 0; loop < BENCH_LOOPS; loop++)
+        decode(data, BENCH_FRAMES, 7, channel);
+    return (double)(clock() - start) * 1e9 / CLOCKS_PER_SEC / BENCH_LOOPS / BENCH_FRAMES;
+}
+
+int main(void)
+{
+    static const float scale[7] = { 1, 1, 1, 1, 1, 1, 1 };
+    unsigned int errors = 0;
+    unsigned int loop;
+    uint32_t i, seed = 1;
+    clock_t start;
+    double scalarNs, simdNs, floatNs;
+    uint8_t c;
+
+    data = malloc((size_t)BENCH_FRAMES * MPU6050_MOTION_BURST_LEN);
+    for(c = 0; c < MPU6050_BLOCK_MAX_CHANNELS; c++)
+    {
+        channel[c] = malloc(BENCH_FRAMES * sizeof(int16_t));
+        channelF[c] = malloc(BENCH_FRAMES * sizeof(float));
+    }
+    for(i = 0; i < BENCH_FRAMES * MPU6050_MOTION_BURST_LEN; i++)
+    {
+        seed = seed * 1103515245u + 12345u;
+        data[i] = (uint8_t)(seed >> 16);
+    }
+
+    errors += checkChannels();
+    errors += checkMotion();
+
+    scalarNs = timeDecode(mpu6050_blockDecodeScalar);
+    simdNs = timeDecode(mpu6050_blockDecode);
+
+    start = clock();
+    for(loop = 0; loop < BENCH_LOOPS; loop++)
+        mpu6050_blockDecodeFloat(data, BENCH_FRAMES, 7, scale, 0, channelF);
+    floatNs = (double)(clock() - start) * 1e9 / CLOCKS_PER_SEC / BENCH_LOOPS / BENCH_FRAMES;
+
+    printf("ISA %s, %u frames of 7 channels\n", isaNames[MPU6050_BLOCK_ISA], BENCH_FRAMES);
+    printf("scalar %6.2f ns/frame %7.0f MByte/s\n", scalarNs, MPU6050_MOTION_BURST_LEN * 1e3 / scalarNs);
+    printf("int16  %6.2f ns/frame %7.0f MByte/s\n", simdNs, MPU6050_MOTION_BURST_LEN * 1e3 / simdNs);
+    printf("float  %6.2f ns/frame %7.0f MByte/s\n", floatNs, MPU6050_MOTION_BURST_LEN * 1e3 / floatNs);
+    printf("%u errors\n", errors);
+
+    return errors ? 1 : 0;
+}
@@ -0,0 +1,305 @@
+/*
+ * This file is part of the MPU6050-Library distribution (https://github.com/jmherzog-de/MPU6050-Library).
+ * Copyright (c) 2021 Jean-Marcel Herzog.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+/**
+ *  \file bench_codec.c
+ *  \brief Register codec check and speed
+ *  
+ *  Checks every entry of the register description table: fields must not
+ *  overlap, and decoding and encoding every register value must give the
+ *  value back with the reserved bits cleared. The bit field datatypes must
+ *  be one byte and every member must cover the bits of its table entry.
+ *  Afterwards prints the time of one decode and one encode averaged over
+ *  the whole table. The program
+ *  exits with a non-zero value if a check fails.
+ *  
+ *  Build and run on a host computer:
+ *  
+ *      gcc -O2 -Ilib bench/bench_codec.c lib/mpu6050_*.c -o bench_codec
+ *      ./bench_codec
+ *  
+ *  \copyright Copyright 2021 Jean-Marcel Herzog. All rights reserved. This project is released under the GNU Public License.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include "mpu6050.h"
+
+#define BENCH_LOOPS     200000
+
+/** Largest register datatype of the table */
+#define BENCH_OBJ_SIZE  16
+
+static const char *names[MPU6050_CODEC_COUNT] =
+{
+    "SELF_TEST", "CONFIG", "GYRO_CONFIG", "ACCEL_CONFIG", "FIFO_EN",
+    "I2C_MST_CTRL", "I2C_SLV0_ADDR", "I2C_SLV0_CTRL", "I2C_SLV1_ADDR",
+    "I2C_SLV1_CTRL", "I2C_SLV2_ADDR", "I2C_SLV2_CTRL", "I2C_SLV3_ADDR",
+    "I2C_SLV3_CTRL", "I2C_SLV4_ADDR", "I2C_SLV4_CTRL", "I2C_MST_STATUS",
+    "INT_PIN_CFG", "INT_ENABLE", "INT_STATUS", "I2C_MST_DELAY_CTRL",
+    "SIGNAL_PATH_RESET", "USER_CTRL", "PWR_MGMT_1", "PWR_MGMT_2",
+};
+
+/**
+ *  \brief Check one register description
+ *  
+ *  \return Number of errors
+ */
+static unsigned int check(const tMPU6050_REG_DESC *desc, const char *name)
+{
+    uint8_t mask[MPU6050_CODEC_MAX_SPAN] = { 0 };
+    uint8_t reg[MPU6050_CODEC_MAX_SPAN];
+    uint8_t out[MPU6050_CODEC_MAX_SPAN];
+    uint8_t obj[BENCH_OBJ_SIZE];
+    unsigned int errors = 0;
+    unsigned int i, r, v;
+
+    if(desc->SPAN > MPU6050_CODEC_MAX_SPAN || desc->SIZE > BENCH_OBJ_SIZE)
+    {
+        printf("%-20s span or size too large\n", name);
+        return 1;
+    }
+
+    for(i = 0; i < desc->COUNT; i++)
+    {
+        const tMPU6050_FIELD_DESC *field = &desc->FIELDS[i];
+        uint8_t bits = (uint8_t)(((1u << field->WIDTH) - 1) << field->SHIFT);
+
+        if(field->REG >= desc->SPAN || field->OFFSET >= desc->SIZE || field->SHIFT + field->WIDTH > 8 || field->POS + field->WIDTH > 8)
+        {
+            printf("%-20s field %u out of range\n", name, i);
+            errors++;
+        }
+        if(mask[field->REG] & bits)
+        {
+            printf("%-20s field %u overlaps\n", name, i);
+            errors++;
+        }
+        mask[field->REG] |= bits;
+    }
+
+    for(r = 0; r < desc->SPAN; r++)
+    {
+        for(v = 0; v < 256; v++)
+        {
+            memset(reg, 0, sizeof(reg));
+            reg[r] = (uint8_t)v;
+            mpu6050_regDecode(desc, reg, obj);
+            mpu6050_regEncode(desc, obj, out);
+            if(out[r] != (v & mask[r]))
+            {
+                printf("%-20s 0x%02X: register %u value 0x%02X decodes to 0x%02X\n", name, desc->ADDR, r, v, out[r]);
+                errors++;
+                break;
+            }
+        }
+    }
+
+    return errors;
+}
+
+/** Set a bit field member to all ones, the register value must be table field n */
+#define CHECK_FIELD(id, n, type, member) \
+    do \
+    { \
+        type obj = { 0 }; \
+        obj.member = ones; \
+        errors += checkField(&mpu6050_registerMap[MPU6050_CODEC_##id].FIELDS[n], #type, #member, sizeof(type), obj.RAW); \
+    } \
+    while(0)
+
+static volatile uint8_t ones = 0xFF;
+
+/**
+ *  \brief Check one member of a bit field datatype
+ *  
+ *  \return Number of errors
+ */
+static unsigned int checkField(const tMPU6050_FIELD_DESC *field, const char *type, const char *member, size_t size, uint8_t ui8Raw)
+{
+    uint8_t bits = (uint8_t)(((1u << field->WIDTH) - 1) << field->SHIFT);
+
+    if(size != 1)
+    {
+        printf("%-28s is %u bytes\n", type, (unsigned int)size);
+        return 1;
+    }
+
+    if(ui8Raw != bits)
+    {
+        printf("%-28s %s sets 0x%02X, table 0x%02X\n", type, member, ui8Raw, bits);
+        return 1;
+    }
+
+    return 0;
+}
+
+/**
+ *  \brief Check the bit field datatypes against the table
+ *  
+ *  \return Number of errors
+ */
+static unsigned int checkLayout(void)
+{
+    unsigned int errors = 0;
+
+    CHECK_FIELD(CONFIG, 0, tMPU6050_CONFIG, EXT_SYNC_SET);
+    CHECK_FIELD(CONFIG, 1, tMPU6050_CONFIG, DLPF_CFG);
+    CHECK_FIELD(GYRO_CONFIG, 0, tMPU6050_GYRO_CONFIG, XG_ST);
+    CHECK_FIELD(GYRO_CONFIG, 1, tMPU6050_GYRO_CONFIG, YG_ST);
+    CHECK_FIELD(GYRO_CONFIG, 2, tMPU6050_GYRO_CONFIG, ZG_ST);
+    CHECK_FIELD(GYRO_CONFIG, 3, tMPU6050_GYRO_CONFIG, FS_SEL);
+    CHECK_FIELD(ACCEL_CONFIG, 0, tMPU6050_ACCEL_CONFIG, XA_ST);
+    CHECK_FIELD(ACCEL_CONFIG, 1, tMPU6050_ACCEL_CONFIG, YA_ST);
+    CHECK_FIELD(ACCEL_CONFIG, 2, tMPU6050_ACCEL_CONFIG, ZA_ST);
+    CHECK_FIELD(ACCEL_CONFIG, 3, tMPU6050_ACCEL_CONFIG, AFS_SEL);
+    CHECK_FIELD(FIFO_EN, 0, tMPU6050_FIFO_EN, TEMP_FIFO_EN);
+    CHECK_FIELD(FIFO_EN, 1, tMPU6050_FIFO_EN, XG_FIFO_EN);
+    CHECK_FIELD(FIFO_EN, 2, tMPU6050_FIFO_EN, YG_FIFO_EN);
+    CHECK_FIELD(FIFO_EN, 3, tMPU6050_FIFO_EN, ZG_FIFO_EN);
+    CHECK_FIELD(FIFO_EN, 4, tMPU6050_FIFO_EN, ACCEL_FIFO_EN);
+    CHECK_FIELD(FIFO_EN, 5, tMPU6050_FIFO_EN, SLV2_FIFO_EN);
+    CHECK_FIELD(FIFO_EN, 6, tMPU6050_FIFO_EN, SLV1_FIFO_EN);
+    CHECK_FIELD(FIFO_EN, 7, tMPU6050_FIFO_EN, SLV0_FIFO_EN);
+    CHECK_FIELD(I2C_MST_CTRL, 0, tMPU6050_I2C_MST_CTRL, MULTI_MST_EN);
+    CHECK_FIELD(I2C_MST_CTRL, 1, tMPU6050_I2C_MST_CTRL, WAIT_FOR_ES);
+    CHECK_FIELD(I2C_MST_CTRL, 2, tMPU6050_I2C_MST_CTRL, SLV_3_FIFO_EN);
+    CHECK_FIELD(I2C_MST_CTRL, 3, tMPU6050_I2C_MST_CTRL, I2C_MST_P_NSR);
+    CHECK_FIELD(I2C_MST_CTRL, 4, tMPU6050_I2C_MST_CTRL, I2C_MST_CLK);
+    CHECK_FIELD(I2C_SLV0_ADDR, 0, tMPU6050_I2C_SLV0_ADDR, I2C_SLV0_RW);
+    CHECK_FIELD(I2C_SLV0_ADDR, 1, tMPU6050_I2C_SLV0_ADDR, I2C_SLV0_ADDR);
+    CHECK_FIELD(I2C_SLV0_CTRL, 0, tMPU6050_I2C_SLV0_CTRL, I2C_SLV0_EN);
+    CHECK_FIELD(I2C_SLV0_CTRL, 1, tMPU6050_I2C_SLV0_CTRL, I2C_SLV0_BYTE_SW);
+    CHECK_FIELD(I2C_SLV0_CTRL, 2, tMPU6050_I2C_SLV0_CTRL, I2C_SLV0_REG_DIS);
+    CHECK_FIELD(I2C_SLV0_CTRL, 3, tMPU6050_I2C_SLV0_CTRL, I2C_SLV0_GRP);
+    CHECK_FIELD(I2C_SLV0_CTRL, 4, tMPU6050_I2C_SLV0_CTRL, I2C_SLV0_LEN);
+    CHECK_FIELD(I2C_SLV1_ADDR, 0, tMPU6050_I2C_SLV1_ADDR, I2C_SLV1_RW);
+    CHECK_FIELD(I2C_SLV1_ADDR, 1, tMPU6050_I2C_SLV1_ADDR, I2C_SLV1_ADDR);
+    CHECK_FIELD(I2C_SLV1_CTRL, 0, tMPU6050_I2C_SLV1_CTRL, I2C_SLV1_EN);
+    CHECK_FIELD(I2C_SLV1_CTRL, 1, tMPU6050_I2C_SLV1_CTRL, I2C_SLV1_BYTE_SW);
+    CHECK_FIELD(I2C_SLV1_CTRL, 2, tMPU6050_I2C_SLV1_CTRL, I2C_SLV1_REG_DIS);
+    CHECK_FIELD(I2C_SLV1_CTRL, 3, tMPU6050_I2C_SLV1_CTRL, I2C_SLV1_GRP);
+    CHECK_FIELD(I2C_SLV1_CTRL, 4, tMPU6050_I2C_SLV1_CTRL, I2C_SLV1_LEN);
+    CHECK_FIELD(I2C_SLV2_ADDR, 0, tMPU6050_I2C_SLV2_ADDR, I2C_SLV2_RW);
+    CHECK_FIELD(I2C_SLV2_ADDR, 1, tMPU6050_I2C_SLV2_ADDR, I2C_SLV2_ADDR);
+    CHECK_FIELD(I2C_SLV2_CTRL, 0, tMPU6050_I2C_SLV2_CTRL, I2C_SLV2_EN);
+    CHECK_FIELD(I2C_SLV2_CTRL, 1, tMPU6050_I2C_SLV2_CTRL, I2C_SLV2_BYTE_SW);
+    CHECK_FIELD(I2C_SLV2_CTRL, 2, tMPU6050_I2C_SLV2_CTRL, I2C_SLV2_REG_DIS);
+    CHECK_FIELD(I2C_SLV2_CTRL, 3, tMPU6050_I2C_SLV2_CTRL, I2C_SLV2_GRP);
+    CHECK_FIELD(I2C_SLV2_CTRL, 4, tMPU6050_I2C_SLV2_CTRL, I2C_SLV2_LEN);
+    CHECK_FIELD(I2C_SLV3_ADDR, 0, tMPU6050_I2C_SLV3_ADDR, I2C_SLV3_RW);
+    CHECK_FIELD(I2C_SLV3_ADDR, 1, tMPU6050_I2C_SLV3_ADDR, I2C_SLV3_ADDR);
+    CHECK_FIELD(I2C_SLV3_CTRL, 0, tMPU6050_I2C_SLV3_CTRL, I2C_SLV3_EN);
+    CHECK_FIELD(I2C_SLV3_CTRL, 1, tMPU6050_I2C_SLV3_CTRL, I2C_SLV3_BYTE_SW);
+    CHECK_FIELD(I2C_SLV3_CTRL, 2, tMPU6050_I2C_SLV3_CTRL, I2C_SLV3_REG_DIS);
+    CHECK_FIELD(I2C_SLV3_CTRL, 3, tMPU6050_I2C_SLV3_CTRL, I2C_SLV3_GRP);
+    CHECK_FIELD(I2C_SLV3_CTRL, 4, tMPU6050_I2C_SLV3_CTRL, I2C_SLV3_LEN);
+    CHECK_FIELD(I2C_SLV4_ADDR, 0, tMPU6050_I2C_SLV4_ADDR, I2C_SLV4_RW);
+    CHECK_FIELD(I2C_SLV4_ADDR, 1, tMPU6050_I2C_SLV4_ADDR, I2C_SLV4_ADDR);
+    CHECK_FIELD(I2C_SLV4_CTRL, 0, tMPU6050_I2C_SLV4_CTRL, I2C_SLV4_EN);
+    CHECK_FIELD(I2C_SLV4_CTRL, 1, tMPU6050_I2C_SLV4_CTRL, I2C_SLV4_INT_EN);
+    CHECK_FIELD(I2C_SLV4_CTRL, 2, tMPU6050_I2C_SLV4_CTRL, I2C_SLV4_REG_DIS);
+    CHECK_FIELD(I2C_SLV4_CTRL, 3, tMPU6050_I2C_SLV4_CTRL, I2C_MST_DLY);
+    CHECK_FIELD(I2C_MST_STATUS, 0, tMPU6050_I2C_MST_STATUS, PASS_THROUGH);
+    CHECK_FIELD(I2C_MST_STATUS, 1, tMPU6050_I2C_MST_STATUS, I2C_SLV4_DONE);
+    CHECK_FIELD(I2C_MST_STATUS, 2, tMPU6050_I2C_MST_STATUS, I2C_LOST_ARB);
+    CHECK_FIELD(I2C_MST_STATUS, 3, tMPU6050_I2C_MST_STATUS, I2C_SLV4_NACK);
+    CHECK_FIELD(I2C_MST_STATUS, 4, tMPU6050_I2C_MST_STATUS, I2C_SLV3_NACK);
+    CHECK_FIELD(I2C_MST_STATUS, 5, tMPU6050_I2C_MST_STATUS, I2C_SLV2_NACK);
+    CHECK_FIELD(I2C_MST_STATUS, 6, tMPU6050_I2C_MST_STATUS, I2C_SLV1_NACK);
+    CHECK_FIELD(I2C_MST_STATUS, 7, tMPU6050_I2C_MST_STATUS, I2C_SLV0_NACK);
+    CHECK_FIELD(INT_PIN_CFG, 0, tMPU6050_INT_PIN_CFG, INT_LEVEL);
+    CHECK_FIELD(INT_PIN_CFG, 1, tMPU6050_INT_PIN_CFG, INT_OPEN);
+    CHECK_FIELD(INT_PIN_CFG, 2, tMPU6050_INT_PIN_CFG, LATCH_INT_EN);
+    CHECK_FIELD(INT_PIN_CFG, 3, tMPU6050_INT_PIN_CFG, INT_RD_CLEAR);
+    CHECK_FIELD(INT_PIN_CFG, 4, tMPU6050_INT_PIN_CFG, FSYNC_INT_LEVEL);
+    CHECK_FIELD(INT_PIN_CFG, 5, tMPU6050_INT_PIN_CFG, FSYNC_INT_EN);
+    CHECK_FIELD(INT_PIN_CFG, 6, tMPU6050_INT_PIN_CFG, I2C_BYPASS_EN);
+    CHECK_FIELD(INT_ENABLE, 0, tMPU6050_INT_ENABLE, FIFO_OFLOW_EN);
+    CHECK_FIELD(INT_ENABLE, 1, tMPU6050_INT_ENABLE, I2C_MST_INT_EN);
+    CHECK_FIELD(INT_ENABLE, 2, tMPU6050_INT_ENABLE, DATA_RDY_EN);
+    CHECK_FIELD(INT_STATUS, 0, tMPU6050_INT_STATUS, FIFO_OFLOW_INT);
+    CHECK_FIELD(INT_STATUS, 1, tMPU6050_INT_STATUS, I2C_MST_INT);
+    CHECK_FIELD(INT_STATUS, 2, tMPU6050_INT_STATUS, DATA_RDY_INT);
+    CHECK_FIELD(I2C_MST_DELAY_CTRL, 0, tMPU6050_I2C_MST_DELAY_CTRL, DELAY_ES_SHADOW);
+    CHECK_FIELD(I2C_MST_DELAY_CTRL, 1, tMPU6050_I2C_MST_DELAY_CTRL, I2C_SLV4_DLY_EN);
+    CHECK_FIELD(I2C_MST_DELAY_CTRL, 2, tMPU6050_I2C_MST_DELAY_CTRL, I2C_SLV3_DLY_EN);
+    CHECK_FIELD(I2C_MST_DELAY_CTRL, 3, tMPU6050_I2C_MST_DELAY_CTRL, I2C_SLV2_DLY_EN);
+    CHECK_FIELD(I2C_MST_DELAY_CTRL, 4, tMPU6050_I2C_MST_DELAY_CTRL, I2C_SLV1_DLY_EN);
+    CHECK_FIELD(I2C_MST_DELAY_CTRL, 5, tMPU6050_I2C_MST_DELAY_CTRL, I2C_SLV0_DLY_EN);
+    CHECK_FIELD(SIGNAL_PATH_RESET, 0, tMPU6050_SIGNAL_PATH_RESET, GYRO_RESET);
+    CHECK_FIELD(SIGNAL_PATH_RESET, 1, tMPU6050_SIGNAL_PATH_RESET, ACCEL_RESET);
+    CHECK_FIELD(SIGNAL_PATH_RESET, 2, tMPU6050_SIGNAL_PATH_RESET, TEMP_RESET);
+    CHECK_FIELD(USER_CTRL, 0, tMPU6050_USER_CTRL, FIFO_EN);
+    CHECK_FIELD(USER_CTRL, 1, tMPU6050_USER_CTRL, I2C_MST_EN);
+    CHECK_FIELD(USER_CTRL, 2, tMPU6050_USER_CTRL, I2C_IF_DIS);
+    CHECK_FIELD(USER_CTRL, 3, tMPU6050_USER_CTRL, FIFO_RESET);
+    CHECK_FIELD(USER_CTRL, 4, tMPU6050_USER_CTRL, I2C_MST_RESET);
+    CHECK_FIELD(USER_CTRL, 5, tMPU6050_USER_CTRL, SIG_COND_RESET);
+    CHECK_FIELD(PWR_MGMT_1, 0, tMPU6050_PWR_MGMT_1, DEVICE_RESET);
+    CHECK_FIELD(PWR_MGMT_1, 1, tMPU6050_PWR_MGMT_1, SLEEP);
+    CHECK_FIELD(PWR_MGMT_1, 2, tMPU6050_PWR_MGMT_1, CYCLE);
+    CHECK_FIELD(PWR_MGMT_1, 3, tMPU6050_PWR_MGMT_1, TEMP_DIS);
+    CHECK_FIELD(PWR_MGMT_1, 4, tMPU6050_PWR_MGMT_1, CLKSEL);
+    CHECK_FIELD(PWR_MGMT_2, 0, tMPU6050_PWR_MGMT_2, LP_WAKE_CTRL);
+    CHECK_FIELD(PWR_MGMT_2, 1, tMPU6050_PWR_MGMT_2, STBY_XA);
+    CHECK_FIELD(PWR_MGMT_2, 2, tMPU6050_PWR_MGMT_2, STBY_YA);
+    CHECK_FIELD(PWR_MGMT_2, 3, tMPU6050_PWR_MGMT_2, STBY_ZA);
+    CHECK_FIELD(PWR_MGMT_2, 4, tMPU6050_PWR_MGMT_2, STBY_XG);
+    CHECK_FIELD(PWR_MGMT_2, 5, tMPU6050_PWR_MGMT_2, STBY_YG);
+    CHECK_FIELD(PWR_MGMT_2, 6, tMPU6050_PWR_MGMT_2, STBY_ZG);
+
+    return errors;
+}
+
+int main(void)
+{
+    uint8_t reg[MPU6050_CODEC_MAX_SPAN] = { 0xA5, 0x5A, 0xC3, 0x3C };
+    uint8_t obj[BENCH_OBJ_SIZE];
+    unsigned int errors = 0;
+    unsigned int loop, id;
+    clock_t start;
+    double decodeNs, encodeNs;
+
+    for(id = 0; id < MPU6050_CODEC_COUNT; id++)
+        errors += check(&mpu6050_registerMap[id], names[id]);
+    errors += checkLayout();
+
+    start = clock();
+    for(loop = 0; loop < BENCH_LOOPS; loop++)
+        for(id = 0; id < MPU6050_CODEC_COUNT; id++)
+        {
+            reg[0] ^= (uint8_t)loop;
+            mpu6050_regDecode(&mpu6050_registerMap[id], reg, obj);
+        }
+    decodeNs = (double)(clock() - start) * 1e9 / CLOCKS_PER_SEC / BENCH_LOOPS / MPU6050_CODEC_COUNT;
+
+    start = clock();
+    for(loop = 0; loop < BENCH_LOOPS; loop++)
+        for(id = 0; id < MPU6050_CODEC_COUNT; id++)
+        {
+            obj[0] ^= (uint8_t)loop;
+            mpu6050_regEncode(&mpu6050_registerMap[id], obj, reg);
+        }
+    encodeNs = (double)(clock() - start) * 1e9 / CLOCKS_PER_SEC / BENCH_LOOPS / MPU6050_CODEC_COUNT;
+
+    printf("%u register descriptions, %u errors\n", MPU6050_CODEC_COUNT, errors);
+    printf("decode %6.1f ns/register\n", decodeNs);
+    printf("encode %6.1f ns/register\n", encodeNs);
+
+    return errors ? 1 : 0;
+}
@@ -0,0 +1,301 @@
+/*
+ * This file is part of the MPU6050-Library distribution (https://github.com/jmherzog-de/MPU6050-Library).
+ * Copyright (c) 2021 Jean-Marcel Herzog.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ *  \file bench_delta.c
+ *  \brief Delta sample compression
+ *  
+ *  Encodes three recordings of 100000 samples with mpu6050_deltaEncode():
+ *  a sensor at rest (noise of +-32 LSB accelerometer, +-8 LSB gyroscope),
+ *  a sensor in motion (sine waves of a few thousand LSB plus noise) and
+ *  random full scale values as the worst case. Prints the bytes per sample
+ *  and the compression ratio against 14 bytes of a raw sample, decodes the
+ *  stream in pieces of random length and compares it with the input.
+ *  Afterwards a block is dropped from the stream: the decoder restarts,
+ *  must skip the blocks up to the next keyframe and deliver every sample
+ *  from there on. Prints the encode and decode speed.
+ *  
+ *  The program exits with a non-zero value if a sample differs, a block
+ *  exceeds MPU6050_DELTA_BLOCK_MAX, the decoder does not resynchronize or
+ *  the sensor at rest compresses less than 2:1.
+ *  
+ *  Build and run on a host computer:
+ *  
+ *      gcc -O2 -Ilib bench/bench_delta.c lib/mpu6050_*.c -lm -o bench_delta
+ *      ./bench_delta
+ *  
+ *  \copyright Copyright 2021 Jean-Marcel Herzog. All rights reserved. This project is released under the GNU Public License.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include "mpu6050.h"
+
+#define BENCH_SAMPLES   100000
+#define BENCH_BLOCKS    ((BENCH_SAMPLES + MPU6050_DELTA_BLOCK - 1) / MPU6050_DELTA_BLOCK)
+#define BENCH_LOOPS     20
+
+static tMPU6050_MOTION input[BENCH_SAMPLES];
+static tMPU6050_MOTION output[BENCH_SAMPLES];
+static uint8_t stream[BENCH_BLOCKS * MPU6050_DELTA_BLOCK_MAX];
+static uint32_t blockStart[BENCH_BLOCKS + 1];
+static uint32_t seed = 1;
+
+/** Random number 0..32767 */
+static int32_t bench_random(void)
+{
+    seed = seed * 1103515245 + 12345;
+    return (int32_t)((seed >> 16) & 0x7FFF);
+}
+
+/** Random number -range..range */
+static int16_t bench_noise(int32_t range)
+{
+    return (int16_t)(bench_random() % (2 * range + 1) - range);
+}
+
+static void bench_rest(void)
+{
+    uint32_t i;
+
+    for(i = 0; i < BENCH_SAMPLES; i++)
+    {
+        input[i].ACCEL.X = bench_noise(32);
+        input[i].ACCEL.Y = (int16_t)(-120 + bench_noise(32));
+        input[i].ACCEL.Z = (int16_t)(16384 + bench_noise(32));
+        input[i].TEMP = (int16_t)(-1500 + i / 20000);
+        input[i].GYRO.X = (int16_t)(-40 + bench_noise(8));
+        input[i].GYRO.Y = (int16_t)(12 + bench_noise(8));
+        input[i].GYRO.Z = (int16_t)(3 + bench_noise(8));
+    }
+}
+
+static void bench_motion(void)
+{
+    uint32_t i;
+
+    for(i = 0; i < BENCH_SAMPLES; i++)
+    {
+        double t = i / 1000.0;
+
+        input[i].ACCEL.X = (int16_t)(4000 * sin(2 * M_PI * 1.3 * t) + bench_noise(32));
+        input[i].ACCEL.Y = (int16_t)(3000 * sin(2 * M_PI * 0.7 * t) + bench_noise(32));
+        input[i].ACCEL.Z = (int16_t)(16384 + 2000 * cos(2 * M_PI * 2.1 * t) + bench_noise(32));
+        input[i].TEMP = (int16_t)(-1500 + i / 5000);
+        input[i].GYRO.X = (int16_t)(6000 * cos(2 * M_PI * 1.3 * t) + bench_noise(8));
+        input[i].GYRO.Y = (int16_t)(9000 * cos(2 * M_PI * 0.7 * t) + bench_noise(8));
+        input[i].GYRO.Z = (int16_t)(2500 * sin(2 * M_PI * 3.0 * t) + bench_noise(8));
+    }
+}
+
+static void bench_fullScale(void)
+{
+    uint32_t i;
+
+    for(i = 0; i < BENCH_SAMPLES; i++)
+    {
+        input[i].ACCEL.X = (int16_t)(bench_random() * 2 + (bench_random() & 1));
+        input[i].ACCEL.Y = (int16_t)(bench_random() * 2 + (bench_random() & 1));
+        input[i].ACCEL.Z = (int16_t)(bench_random() * 2 + (bench_random() & 1));
+        input[i].TEMP = (int16_t)(bench_random() * 2 + (bench_random() & 1));
+        input[i].GYRO.X = (int16_t)(bench_random() * 2 + (bench_random() & 1));
+        input[i].GYRO.Y = (int16_t)(bench_random() * 2 + (bench_random() & 1));
+        input[i].GYRO.Z = (int16_t)(bench_random() * 2 + (bench_random() & 1));
+    }
+}
+
+/**
+ *  \brief Encode the input, record where each block starts
+ *  \return Stream length, 0 if a block is too long
+ */
+static uint32_t bench_encode(uint16_t ui16KeyInterval, uint32_t *pui32Blocks)
+{
+    tMPU6050_DELTA_ENC enc;
+    uint32_t i, len = 0, blocks = 0;
+    uint16_t n;
+
+    mpu6050_deltaEncInitialization(&enc, ui16KeyInterval);
+    for(i = 0; i < BENCH_SAMPLES; i++)
+    {
+        n = mpu6050_deltaEncode(&enc, &input[i], &stream[len]);
+        if(n > MPU6050_DELTA_BLOCK_MAX)
+            return 0;
+        if(n)
+        {
+            blockStart[blocks++] = len;
+            len += n;
+        }
+    }
+    n = mpu6050_deltaFlush(&enc, &stream[len]);
+    if(n)
+    {
+        blockStart[blocks++] = len;
+        len += n;
+    }
+    blockStart[blocks] = len;
+    *pui32Blocks = blocks;
+
+    return len;
+}
+
+/**
+ *  \brief Decode the stream in pieces of random length and compare
+ *  \return Number of errors
+ */
+static uint32_t bench_roundTrip(uint32_t ui32Len)
+{
+    tMPU6050_DELTA_DEC dec;
+    uint32_t pos = 0, avail = 0, n = 0, used;
+
+    mpu6050_deltaDecInitialization(&dec);
+    while(pos < ui32Len)
+    {
+        // data arrives in pieces, the caller keeps what was not decoded
+        avail += 1 + bench_random() % 300;
+        if(pos + avail > ui32Len)
+            avail = ui32Len - pos;
+        n += mpu6050_deltaDecode(&dec, &stream[pos], avail, &output[n], BENCH_SAMPLES - n, &used);
+        pos += used;
+        avail -= used;
+        if(used == 0 && pos + avail == ui32Len)
+            break;
+    }
+
+    if(n != BENCH_SAMPLES || pos != ui32Len || dec.ERRORS || dec.SKIPPED)
+    {
+        printf("decoded %u of %u samples, %u of %u bytes, %u errors, %u skipped\n", n, BENCH_SAMPLES, pos, ui32Len, dec.ERRORS, dec.SKIPPED);
+        return 1;
+    }
+    if(memcmp(input, output, sizeof(input)))
+    {
+        printf("decoded samples differ\n");
+        return 1;
+    }
+
+    return 0;
+}
+
+/**
+ *  \brief Drop a block: the decoder restarts and waits for the next keyframe
+ *  \return Number of errors
+ */
+static uint32_t bench_resync(uint32_t ui32Len, uint32_t ui32Blocks)
+{
+    tMPU6050_DELTA_DEC dec;
+    uint32_t lost = ui32Blocks / 2 + 3;
+    uint32_t next = (lost / MPU6050_DELTA_KEY_INTERVAL + 1) * MPU6050_DELTA_KEY_INTERVAL;
+    uint32_t n, used;
+
+    mpu6050_deltaDecInitialization(&dec);
+    n = mpu6050_deltaDecode(&dec, stream, blockStart[lost], output, BENCH_SAMPLES, &used);
+    if(n != lost * MPU6050_DELTA_BLOCK || used != blockStart[lost])
+    {
+        printf("resync: %u samples before the lost block\n", n);
+        return 1;
+    }
+
+    mpu6050_deltaDecInitialization(&dec);
+    n = mpu6050_deltaDecode(&dec, &stream[blockStart[lost + 1]], ui32Len - blockStart[lost + 1], output, BENCH_SAMPLES, &used);
+
+    if(dec.SKIPPED != next - lost - 1 || n != BENCH_SAMPLES - next * MPU6050_DELTA_BLOCK
+        || memcmp(&input[next * MPU6050_DELTA_BLOCK], output, n * sizeof(output[0])))
+    {
+        printf("resync: %u samples after %u skipped blocks, expected %u after %u\n", n, dec.SKIPPED, BENCH_SAMPLES - next * MPU6050_DELTA_BLOCK, next - lost - 1);
+        return 1;
+    }
+    printf("block %u lost, %u blocks skipped, synchronized at block %u\n", lost, dec.SKIPPED, next);
+
+    return 0;
+}
+
+/**
+ *  \brief Encode and decode speed
+ */
+static void bench_speed(void)
+{
+    tMPU6050_DELTA_ENC enc;
+    tMPU6050_DELTA_DEC dec;
+    uint32_t i, loop, len = 0;
+    clock_t start;
+    double encodeNs, decodeNs;
+
+    start = clock();
+    for(loop = 0; loop < BENCH_LOOPS; loop++)
+    {
+        mpu6050_deltaEncInitialization(&enc, MPU6050_DELTA_KEY_INTERVAL);
+        for(i = 0, len = 0; i < BENCH_SAMPLES; i++)
+            len += mpu6050_deltaEncode(&enc, &input[i], &stream[len]);
+        len += mpu6050_deltaFlush(&enc, &stream[len]);
+    }
+    encodeNs = (double)(clock() - start) * 1e9 / CLOCKS_PER_SEC / BENCH_LOOPS / BENCH_SAMPLES;
+
+    start = clock();
+    for(loop = 0; loop < BENCH_LOOPS; loop++)
+    {
+        mpu6050_deltaDecInitialization(&dec);
+        mpu6050_deltaDecode(&dec, stream, len, output, BENCH_SAMPLES, NULL);
+    }
+    decodeNs = (double)(clock() - start) * 1e9 / CLOCKS_PER_SEC / BENCH_LOOPS / BENCH_SAMPLES;
+
+    printf("encode %6.1f ns/sample, decode %6.1f ns/sample\n", encodeNs, decodeNs);
+}
+
+int main(void)
+{
+    static const char *names[] = { "rest", "motion", "full scale" };
+    uint32_t errors = 0, len, blocks, set;
+    double ratio[3];
+
+    for(set = 0; set < 3; set++)
+    {
+        if(set == 0)
+            bench_rest();
+        else if(set == 1)
+            bench_motion();
+        else
+            bench_fullScale();
+
+        len = bench_encode(MPU6050_DELTA_KEY_INTERVAL, &blocks);
+        if(len == 0)
+        {
+            printf("%s: block exceeds %u bytes\n", names[set], MPU6050_DELTA_BLOCK_MAX);
+            errors++;
+            continue;
+        }
+        ratio[set] = 14.0 * BENCH_SAMPLES / len;
+        printf("%-10s %6.2f bytes/sample, ratio %5.2f\n", names[set], (double)len / BENCH_SAMPLES, ratio[set]);
+
+        errors += bench_roundTrip(len);
+        if(set == 1)
+        {
+            errors += bench_resync(len, blocks);
+            bench_speed();
+        }
+    }
+
+    if(ratio[0] < 2.0)
+    {
+        printf("sensor at rest compresses only %.2f:1\n", ratio[0]);
+        errors++;
+    }
+    printf("%u errors\n", errors);
+
+    return errors ? 1 : 0;
+}
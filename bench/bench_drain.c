@@ -0,0 +1,183 @@
+/*
+ * This file is part of the MPU6050-Library distribution (https://github.com/jmherzog-de/MPU6050-Library).
+ * Copyright (c) 2021 Jean-Marcel Herzog.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ *  \file bench_drain.c
+ *  \brief Adaptive FIFO drain scheduling
+ *  
+ *  Streams accelerometer, temperature and gyroscope frames (14 bytes) from
+ *  the simulated sensor through mpu6050_drainRun(). The host sleeps as long
+ *  as mpu6050_drainSleep() allows plus a random wake-up delay of up to
+ *  500us. The run has five phases of 2s:
+ *  
+ *  - 1kHz Sample Rate, 400kHz bus
+ *  - the bus slows down to 200kHz
+ *  - 200Hz Sample Rate (SMPLRT_DIV 4), 400kHz bus
+ *  - the caller buffer holds only 4 frames
+ *  - 8kHz Sample Rate (DLPF off): the bus can not keep up
+ *  
+ *  For each phase prints drains per second (a fixed 5ms poll needs 200),
+ *  the fill level at drain time, overflows, lost samples and the bus load.
+ *  The program exits with a non-zero value if one of the first four phases
+ *  overflows or loses a sample, if the last phase is not detected as
+ *  saturated, or if a drain in any phase plans with no fill rate or sleeps
+ *  longer than the FIFO takes to fill.
+ *  
+ *  Build and run on a host computer:
+ *  
+ *      gcc -Ilib -Ihardware/Host bench/bench_drain.c lib/mpu6050_*.c hardware/Host/sim.c -o bench_drain
+ *      ./bench_drain
+ *  
+ *  \copyright Copyright 2021 Jean-Marcel Herzog. All rights reserved. This project is released under the GNU Public License.
+ */
+
+#include <stdio.h>
+#include "mpu6050.h"
+#include "sim.h"
+
+#define BENCH_PHASE_NS      2000000000ULL
+#define BENCH_JITTER_US     500
+#define BENCH_BUF_FRAMES    (MPU6050_FIFO_SIZE / 14)
+#define BENCH_SMALL_FRAMES  4
+
+static tSIM_MPU6050 sim;
+static tMPU6050_DEV dev;
+static tMPU6050_DRAIN drain;
+static uint16_t sampleNumber;
+static uint16_t expect;
+
+/**
+ *  \brief Data source: channel i of sample n is n * 8 + i
+ */
+static void bench_source(void *arg, uint64_t ui64TimeNs, int16_t *pi16Data)
+{
+    uint8_t i;
+
+    (void)arg;
+    (void)ui64TimeNs;
+    for(i = 0; i < 7; i++)
+        pi16Data[i] = (int16_t)(sampleNumber * 8 + i);
+    sampleNumber++;
+}
+
+/** Host clock in microseconds */
+static uint32_t bench_clock(void)
+{
+    return (uint32_t)(sim.ui64TimeNs / 1000);
+}
+
+/**
+ *  \brief Run one phase
+ *  
+ *  \return Number of errors
+ */
+static unsigned int bench_phase(const char *name, bool bFeasible, uint16_t ui16BufFrames)
+{
+    static tMPU6050_MOTION buf[BENCH_BUF_FRAMES];
+    static uint32_t seed = 1;
+    uint64_t start = sim.ui64TimeNs;
+    uint16_t overflows = dev.FIFO_STATUS.OVERFLOWS;
+    uint32_t drains = 0, lost = 0, levelSum = 0, badPlans = 0;
+    uint32_t fillUs = (uint32_t)((uint64_t)MPU6050_FIFO_SIZE * mpu6050_samplePeriodNs(&dev) / (14 * 1000));
+    uint16_t levelMax = 0;
+    uint16_t n, i;
+
+    sim_statsReset(&sim);
+    while(sim.ui64TimeNs - start < BENCH_PHASE_NS)
+    {
+        seed = seed * 1103515245u + 12345u;
+        sim_clockAdvance(&sim, ((uint64_t)mpu6050_drainSleep(&drain) + (seed >> 16) % BENCH_JITTER_US) * 1000);
+
+        n = mpu6050_drainRun(&drain, buf, ui16BufFrames);
+        drains++;
+        if(drain.FILL_RATE == 0 || drain.INTERVAL > fillUs)
+            badPlans++;
+        levelSum += dev.FIFO_STATUS.LEVEL;
+        if(dev.FIFO_STATUS.LEVEL > levelMax)
+            levelMax = dev.FIFO_STATUS.LEVEL;
+
+        for(i = 0; i < n; i++)
+        {
+            uint16_t number = (uint16_t)buf[i].ACCEL.X / 8;
+
+            // the sample number wraps at 8192
+            lost += (uint16_t)(number - expect) & 0x1FFF;
+            expect = (number + 1) & 0x1FFF;
+        }
+    }
+
+    overflows = dev.FIFO_STATUS.OVERFLOWS - overflows;
+    printf("%-22s %8.1f %9u %9u %9u %6u %7.1f%% %s\n", name,
+           drains * 1e9 / BENCH_PHASE_NS, (unsigned)(levelSum / drains), (unsigned)levelMax,
+           (unsigned)overflows, (unsigned)lost, sim.stats.BUS_TIME_NS * 100.0 / (sim.ui64TimeNs - start),
+           drain.SATURATED ? "saturated" : "");
+    if(badPlans)
+        printf("%u drains planned without fill rate or beyond the FIFO fill time\n", (unsigned)badPlans);
+
+    if(badPlans)
+        return 1;
+    if(bFeasible && (overflows || lost || drain.SATURATED))
+        return 1;
+    if(!bFeasible && !drain.SATURATED)
+        return 1;
+    return 0;
+}
+
+int main(void)
+{
+    tMPU6050_FIFO_EN fifoEn = { 0 };
+    tMPU6050_USER_CTRL ctrl = { 0 };
+    tMPU6050_SMPLRT_DIV div;
+    unsigned int errors = 0;
+
+    sim_initialization(&sim, MPU6050_I2C_ADDR);
+    sim_sourceSet(&sim, bench_source, 0);
+    mpu6050_devInitialization(&dev, &sim.transport, MPU6050_I2C_ADDR);
+
+    // wake up, DLPF 44Hz -> 1kHz sample rate, all motion data into the FIFO
+    mpu6050_busWrite(&dev, MPU6050_CONFIG, 0x03);
+    mpu6050_busWrite(&dev, MPU6050_PWR_MGMT_1, 0x00);
+    fifoEn.ACCEL_FIFO_EN = fifoEn.TEMP_FIFO_EN = true;
+    fifoEn.XG_FIFO_EN = fifoEn.YG_FIFO_EN = fifoEn.ZG_FIFO_EN = true;
+    mpu6050_fifoEnWriteReg(&dev, &fifoEn);
+    ctrl.FIFO_EN = true;
+    mpu6050_userCtrlWriteReg(&dev, &ctrl);
+
+    mpu6050_drainInitialization(&drain, &dev, bench_clock, 1000000);
+
+    printf("phase                  drains/s avg level max level overflows   lost bus load\n");
+    errors += bench_phase("1kHz, 400kHz bus", true, BENCH_BUF_FRAMES);
+
+    sim.ui32BusClockHz = 200000;
+    errors += bench_phase("1kHz, 200kHz bus", true, BENCH_BUF_FRAMES);
+
+    sim.ui32BusClockHz = 400000;
+    div = 4;
+    mpu6050_sampleRateDividerRegWrite(&dev, &div);
+    mpu6050_drainRateUpdate(&drain);
+    errors += bench_phase("200Hz, 400kHz bus", true, BENCH_BUF_FRAMES);
+    errors += bench_phase("200Hz, 4 frame buffer", true, BENCH_SMALL_FRAMES);
+
+    div = 0;
+    mpu6050_sampleRateDividerRegWrite(&dev, &div);
+    mpu6050_busWrite(&dev, MPU6050_CONFIG, 0x00);
+    mpu6050_drainRateUpdate(&drain);
+    errors += bench_phase("8kHz, 400kHz bus", false, BENCH_BUF_FRAMES);
+
+    printf("%u errors\n", errors);
+    return errors ? 1 : 0;
+}
@@ -0,0 +1,172 @@
+/*
+ * This file is part of the MPU6050-Library distribution (https://github.com/jmherzog-de/MPU6050-Library).
+ * Copyright (c) 2021 Jean-Marcel Herzog.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ *  \file bench_fifo.c
+ *  \brief FIFO overflow recovery
+ *  
+ *  Streams accelerometer and gyroscope frames (12 bytes, the FIFO size is no
+ *  multiple) from the simulated sensor at 1kHz through mpu6050_fifoDrain()
+ *  every 5ms. One drain is delayed by 200ms so the FIFO overflows. Every
+ *  sample carries its sample number, so the bench counts frames decoded
+ *  from the wrong bytes and frames actually lost for each recovery method.
+ *  The virtual time of the simulation is the host time base of the lost
+ *  frame estimate.
+ *  
+ *  The program exits with a non-zero value if a recovery method other than
+ *  MPU6050_FIFO_RECOVER_NONE delivers a corrupt frame, or if LOST_FRAMES
+ *  differs from the lost frames by more than 2% plus 2 frames.
+ *  
+ *  Build and run on a host computer:
+ *  
+ *      gcc -Ilib -Ihardware/Host bench/bench_fifo.c lib/mpu6050_*.c hardware/Host/sim.c -o bench_fifo
+ *      ./bench_fifo
+ *  
+ *  \copyright Copyright 2021 Jean-Marcel Herzog. All rights reserved. This project is released under the GNU Public License.
+ */
+
+#include <stdio.h>
+#include "mpu6050.h"
+#include "sim.h"
+
+#define BENCH_DURATION_MS   2000
+#define BENCH_DRAIN_MS      5
+#define BENCH_STALL_AT_MS   500
+#define BENCH_STALL_MS      200
+
+/**
+ *  \brief Result of one recovery method
+ */
+typedef struct
+{
+    uint32_t delivered;         /**< Frames returned by the drain */
+    uint32_t corrupt;           /**< Frames decoded from the wrong bytes */
+    uint32_t lost;              /**< Frames missing in the sequence */
+    uint32_t lastGood;          /**< Number of the last good frame after the stall */
+    tMPU6050_FIFO_STATUS status;
+}
+tBENCH_RESULT;
+
+static tSIM_MPU6050 sim;
+static tMPU6050_DEV dev;
+static uint16_t sampleNumber;
+
+/**
+ *  \brief Host time base: virtual time in microseconds
+ */
+static uint32_t bench_clock(void)
+{
+    return (uint32_t)(sim.ui64TimeNs / 1000);
+}
+
+/**
+ *  \brief Data source: channel i of sample n is n * 8 + i
+ */
+static void bench_source(void *arg, uint64_t ui64TimeNs, int16_t *pi16Data)
+{
+    uint8_t i;
+
+    (void)arg;
+    (void)ui64TimeNs;
+    for(i = 0; i < 7; i++)
+        pi16Data[i] = (int16_t)(sampleNumber * 8 + i);
+    sampleNumber++;
+}
+
+static void bench_run(uint8_t ui8Recovery, tBENCH_RESULT *result)
+{
+    static tMPU6050_MOTION buf[MPU6050_FIFO_SIZE / 12];
+    tMPU6050_FIFO_EN fifoEn = { 0 };
+    tMPU6050_USER_CTRL ctrl = { 0 };
+    uint16_t expect = 0;
+    uint16_t n, i;
+    uint32_t ms;
+
+    sim_initialization(&sim, MPU6050_I2C_ADDR);
+    sim_sourceSet(&sim, bench_source, 0);
+    sampleNumber = 0;
+    mpu6050_devInitialization(&dev, &sim.transport, MPU6050_I2C_ADDR);
+    mpu6050_fifoRecoverySet(&dev, ui8Recovery);
+    mpu6050_fifoClockSet(&dev, bench_clock, 1000000);
+
+    // wake up, DLPF 44Hz -> 1kHz sample rate, accelerometer and gyroscope into the FIFO
+    mpu6050_busWrite(&dev, MPU6050_CONFIG, 0x03);
+    mpu6050_busWrite(&dev, MPU6050_PWR_MGMT_1, 0x00);
+    fifoEn.ACCEL_FIFO_EN = fifoEn.XG_FIFO_EN = fifoEn.YG_FIFO_EN = fifoEn.ZG_FIFO_EN = true;
+    mpu6050_fifoEnWriteReg(&dev, &fifoEn);
+    ctrl.FIFO_EN = true;
+    mpu6050_userCtrlWriteReg(&dev, &ctrl);
+
+    for(ms = 0; ms < BENCH_DURATION_MS; ms += BENCH_DRAIN_MS)
+    {
+        if(ms == BENCH_STALL_AT_MS)
+        {
+            sim_clockAdvance(&sim, BENCH_STALL_MS * 1000000ULL);
+            ms += BENCH_STALL_MS;
+        }
+
+        n = mpu6050_fifoDrain(&dev, buf, sizeof(buf) / sizeof(buf[0]));
+        for(i = 0; i < n; i++)
+        {
+            uint16_t number = (uint16_t)buf[i].ACCEL.X / 8;
+
+            result->delivered++;
+            if((uint16_t)buf[i].ACCEL.X % 8 != 0 || buf[i].ACCEL.Y != buf[i].ACCEL.X + 1 ||
+               buf[i].ACCEL.Z != buf[i].ACCEL.X + 2 || buf[i].GYRO.X != buf[i].ACCEL.X + 4 ||
+               buf[i].GYRO.Y != buf[i].ACCEL.X + 5 || buf[i].GYRO.Z != buf[i].ACCEL.X + 6)
+            {
+                result->corrupt++;
+                continue;
+            }
+            result->lost += (uint16_t)(number - expect);
+            expect = number + 1;
+            result->lastGood = number;
+        }
+        sim_clockAdvance(&sim, BENCH_DRAIN_MS * 1000000ULL);
+    }
+    mpu6050_fifoStatusGet(&dev, &result->status);
+}
+
+int main(void)
+{
+    static const char *names[] = { "RESET", "DISCARD", "NONE" };
+    unsigned int errors = 0;
+    uint8_t recovery;
+
+    printf("recovery   delivered corrupt lost overflows LOST_FRAMES\n");
+    for(recovery = MPU6050_FIFO_RECOVER_RESET; recovery <= MPU6050_FIFO_RECOVER_NONE; recovery++)
+    {
+        tBENCH_RESULT result = { 0 };
+
+        bench_run(recovery, &result);
+        printf("%-10s %9u %7u %4u %9u %11u\n", names[recovery],
+               (unsigned)result.delivered, (unsigned)result.corrupt, (unsigned)result.lost,
+               (unsigned)result.status.OVERFLOWS, (unsigned)result.status.LOST_FRAMES);
+
+        if(recovery == MPU6050_FIFO_RECOVER_NONE)
+            continue;
+        if(result.corrupt || result.status.OVERFLOWS == 0 ||
+           result.status.LOST_FRAMES > result.lost + result.lost / 50 + 2 ||
+           result.status.LOST_FRAMES + result.lost / 50 + 2 < result.lost)
+        {
+            printf("%-10s failed\n", names[recovery]);
+            errors++;
+        }
+    }
+
+    return errors ? 1 : 0;
+}
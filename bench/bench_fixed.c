@@ -0,0 +1,195 @@
+/*
+ * This file is part of the MPU6050-Library distribution (https://github.com/jmherzog-de/MPU6050-Library).
+ * Copyright (c) 2021 Jean-Marcel Herzog.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ *  \file bench_fixed.c
+ *  \brief Fixed-point conversion accuracy and speed
+ *  
+ *  Converts every raw value of every full scale range with the Q16.16 path
+ *  (mpu6050_fixedMeasurements.c) and with the float path
+ *  (mpu6050_scaledMeasurements.c) and prints the worst case error of both
+ *  against the exact value computed in double precision. Afterwards prints
+ *  the time of one sample conversion of both paths.
+ *  
+ *  On a host computer the float path runs on a hardware FPU. Build with
+ *  the soft-float library of the target (e.g. arm-none-eabi-gcc
+ *  -mcpu=cortex-m0plus on a simulator) to see the difference the fixed-point
+ *  path makes on an MCU without FPU. The program exits with a non-zero value
+ *  if a fixed-point error exceeds the bound documented in
+ *  mpu6050_fixedMeasurements.c.
+ *  
+ *  Build and run on a host computer:
+ *  
+ *      gcc -O2 -Ilib bench/bench_fixed.c lib/mpu6050_*.c -lm -o bench_fixed
+ *      ./bench_fixed
+ *  
+ *  \copyright Copyright 2021 Jean-Marcel Herzog. All rights reserved. This project is released under the GNU Public License.
+ */
+
+#include <stdio.h>
+#include <math.h>
+#include <time.h>
+#include "mpu6050.h"
+
+#define BENCH_LOOPS     2000
+#define BENCH_SAMPLES   1024
+
+static tMPU6050_DEV dev;
+static tMPU6050_MOTION samples[BENCH_SAMPLES];
+
+/** Exact scale factors in units/LSB */
+static const double accelExact[4] = { 9.80665 / 16384, 9.80665 / 8192, 9.80665 / 4096, 9.80665 / 2048 };
+static const double gyroExact[4] = { M_PI / 180 / 131, M_PI / 180 / 65.5, M_PI / 180 / 32.8, M_PI / 180 / 16.4 };
+
+/** Documented worst case error of the fixed-point path in Q16.16 LSB */
+static const double accelBound[4] = { 1.8, 3.0, 5.5, 10.4 };
+static const double gyroBound[4] = { 0.6, 0.7, 15.6, 30.7 };
+static const double tempBound = 32.2;
+
+/**
+ *  \brief Print and check the worst case error of one measurement
+ *  
+ *  \return Number of errors
+ */
+static unsigned int report(const char *name, double fixedErr, double floatErr, double bound)
+{
+    printf("%-24s fixed %7.2f LSB  float %7.2f LSB  bound %6.1f LSB\n", name, fixedErr, floatErr, bound);
+    if(fixedErr > bound)
+    {
+        printf("%-24s exceeds the documented error bound\n", name);
+        return 1;
+    }
+    return 0;
+}
+
+/**
+ *  \brief Worst case error of both paths over all raw values of one range
+ */
+static unsigned int checkRange(uint8_t ui8Sel)
+{
+    double accelFixedErr = 0, accelFloatErr = 0, gyroFixedErr = 0, gyroFloatErr = 0;
+    char name[32];
+    unsigned int errors = 0;
+    int32_t raw;
+
+    mpu6050_devAccelRangeSet(&dev, ui8Sel);
+    mpu6050_devGyroRangeSet(&dev, ui8Sel);
+
+    for(raw = -32768; raw <= 32767; raw++)
+    {
+        tMPU6050_ACCEL accel = { (int16_t)raw, 0, 0 };
+        tMPU6050_GYRO gyro = { (int16_t)raw, 0, 0 };
+        tMPU6050_ACCEL_Q16 accelQ;
+        tMPU6050_ACCEL_SI accelF;
+        tMPU6050_GYRO_Q16 gyroQ;
+        tMPU6050_GYRO_SI gyroF;
+        double exact;
+
+        mpu6050_accelFixed(&dev, &accel, &accelQ);
+        mpu6050_accelScale(&dev, &accel, &accelF);
+        exact = raw * accelExact[ui8Sel] * 65536.0;
+        accelFixedErr = fmax(accelFixedErr, fabs(accelQ.X - exact));
+        accelFloatErr = fmax(accelFloatErr, fabs(accelF.X * 65536.0 - exact));
+
+        mpu6050_gyroFixed(&dev, &gyro, &gyroQ);
+        mpu6050_gyroScale(&dev, &gyro, &gyroF);
+        exact = raw * gyroExact[ui8Sel] * 65536.0;
+        gyroFixedErr = fmax(gyroFixedErr, fabs(gyroQ.X - exact));
+        gyroFloatErr = fmax(gyroFloatErr, fabs(gyroF.X * 65536.0 - exact));
+    }
+
+    snprintf(name, sizeof(name), "accel AFS_SEL %u", ui8Sel);
+    errors += report(name, accelFixedErr, accelFloatErr, accelBound[ui8Sel]);
+    snprintf(name, sizeof(name), "gyro FS_SEL %u", ui8Sel);
+    errors += report(name, gyroFixedErr, gyroFloatErr, gyroBound[ui8Sel]);
+    return errors;
+}
+
+/**
+ *  \brief Worst case error of both paths over all raw temperature values
+ */
+static unsigned int checkTemp(void)
+{
+    double fixedErr = 0, floatErr = 0;
+    int32_t raw;
+
+    for(raw = -32768; raw <= 32767; raw++)
+    {
+        double exact = (raw / 340.0 + 36.53) * 65536.0;
+
+        fixedErr = fmax(fixedErr, fabs(mpu6050_tempFixed((int16_t)raw) - exact));
+        floatErr = fmax(floatErr, fabs(mpu6050_tempScale((int16_t)raw) * 65536.0 - exact));
+    }
+    return report("temperature", fixedErr, floatErr, tempBound);
+}
+
+/**
+ *  \brief Pseudo random raw value
+ */
+static int16_t random16(uint32_t *seed)
+{
+    *seed = *seed * 1103515245u + 12345u;
+    return (int16_t)(*seed >> 16);
+}
+
+int main(void)
+{
+    static tMPU6050_MOTION_Q16 outQ[BENCH_SAMPLES];
+    static tMPU6050_MOTION_SI outF[BENCH_SAMPLES];
+    unsigned int errors = 0;
+    unsigned int loop, i;
+    uint32_t seed = 1;
+    clock_t start;
+    double fixedNs, floatNs;
+    uint8_t sel;
+
+    mpu6050_devInitialization(&dev, 0, MPU6050_I2C_ADDR);
+    for(sel = 0; sel < 4; sel++)
+        errors += checkRange(sel);
+    errors += checkTemp();
+
+    for(i = 0; i < BENCH_SAMPLES; i++)
+    {
+        samples[i].ACCEL.X = random16(&seed);
+        samples[i].ACCEL.Y = random16(&seed);
+        samples[i].ACCEL.Z = random16(&seed);
+        samples[i].TEMP = random16(&seed);
+        samples[i].GYRO.X = random16(&seed);
+        samples[i].GYRO.Y = random16(&seed);
+        samples[i].GYRO.Z = random16(&seed);
+    }
+    mpu6050_devAccelRangeSet(&dev, 1);
+    mpu6050_devGyroRangeSet(&dev, 2);
+
+    start = clock();
+    for(loop = 0; loop < BENCH_LOOPS; loop++)
+        for(i = 0; i < BENCH_SAMPLES; i++)
+            mpu6050_motionFixed(&dev, &samples[i], &outQ[i]);
+    fixedNs = (double)(clock() - start) * 1e9 / CLOCKS_PER_SEC / BENCH_LOOPS / BENCH_SAMPLES;
+
+    start = clock();
+    for(loop = 0; loop < BENCH_LOOPS; loop++)
+        for(i = 0; i < BENCH_SAMPLES; i++)
+            mpu6050_motionScale(&dev, &samples[i], &outF[i]);
+    floatNs = (double)(clock() - start) * 1e9 / CLOCKS_PER_SEC / BENCH_LOOPS / BENCH_SAMPLES;
+
+    printf("fixed %6.1f ns/sample (check %ld)\n", fixedNs, (long)outQ[BENCH_SAMPLES - 1].TEMP);
+    printf("float %6.1f ns/sample (check %.2f)\n", floatNs, outF[BENCH_SAMPLES - 1].TEMP);
+    printf("%u errors\n", errors);
+
+    return errors ? 1 : 0;
+}
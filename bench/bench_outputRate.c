@@ -0,0 +1,101 @@
+/*
+ * This file is part of the MPU6050-Library distribution (https://github.com/jmherzog-de/MPU6050-Library).
+ * Copyright (c) 2021 Jean-Marcel Herzog.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ *  \file bench_outputRate.c
+ *  \brief Output data rate planner
+ *  
+ *  Plans and applies a set of Sample Rate and bandwidth requests on the
+ *  simulated sensor and prints the chosen setting, the achieved rate and the
+ *  group delay. The program exits with a non-zero value if a plan differs
+ *  from the expected setting or the simulated sensor samples at another
+ *  period than planned.
+ *  
+ *  Build and run on a host computer:
+ *  
+ *      gcc -Ilib -Ihardware/Host bench/bench_outputRate.c lib/mpu6050_*.c hardware/Host/sim.c -o bench_outputRate
+ *      ./bench_outputRate
+ *  
+ *  \copyright Copyright 2021 Jean-Marcel Herzog. All rights reserved. This project is released under the GNU Public License.
+ */
+
+#include <stdio.h>
+#include "mpu6050.h"
+#include "sim.h"
+
+/**
+ *  \brief Request and expected plan
+ */
+typedef struct
+{
+    uint16_t RATE_HZ;
+    uint16_t BANDWIDTH_HZ;
+    bool MET;
+    uint8_t DLPF_CFG;
+    uint8_t SMPLRT_DIV;
+}
+tBENCH_CASE;
+
+static const tBENCH_CASE cases[] =
+{
+    { 8000, 500, true,  0,   0 },
+    { 1000, 300, true,  0,   7 },
+    {  333, 200, true,  2,   2 },
+    {  200, 100, true,  2,   4 },
+    {  100, 100, true,  3,   9 },
+    {   50, 1000, true, 4,  19 },
+    {   10,  10, true,  6,  99 },
+    { 2000,  50, false, 3,   0 },
+    { 9000, 100, false, 2,   0 },
+    {  100,   2, false, 6,   9 },
+    {    2,   5, false, 6, 255 }
+};
+
+int main(void)
+{
+    static tSIM_MPU6050 sim;
+    static tMPU6050_DEV dev;
+    tMPU6050_ODR_PLAN plan, current;
+    unsigned int errors = 0;
+    uint8_t i;
+
+    sim_initialization(&sim, MPU6050_I2C_ADDR);
+    mpu6050_devInitialization(&dev, &sim.transport, MPU6050_I2C_ADDR);
+
+    printf("request Hz  bandwidth Hz  met  DLPF_CFG  SMPLRT_DIV   rate Hz  acc/gyro BW Hz  acc/gyro delay us\n");
+    for(i = 0; i < sizeof(cases) / sizeof(cases[0]); i++)
+    {
+        const tBENCH_CASE *c = &cases[i];
+        bool met = mpu6050_odrApply(&dev, c->RATE_HZ, c->BANDWIDTH_HZ, &plan);
+
+        mpu6050_odrGet(&dev, &current);
+        printf("%10u %13u %4s %9u %11u %9.2f %7u/%-7u %8u/%-8u",
+               c->RATE_HZ, c->BANDWIDTH_HZ, met ? "yes" : "no", plan.DLPF_CFG, plan.SMPLRT_DIV, plan.RATE_HZ,
+               plan.ACCEL_BANDWIDTH_HZ, plan.GYRO_BANDWIDTH_HZ, plan.ACCEL_DELAY_US, plan.GYRO_DELAY_US);
+
+        if(met != c->MET || plan.DLPF_CFG != c->DLPF_CFG || plan.SMPLRT_DIV != c->SMPLRT_DIV ||
+           current.PERIOD_NS != plan.PERIOD_NS || sim_samplePeriodNs(&sim) != plan.PERIOD_NS)
+        {
+            printf(" error");
+            errors++;
+        }
+        printf("\n");
+    }
+
+    printf("%u errors\n", errors);
+    return errors ? 1 : 0;
+}
@@ -0,0 +1,349 @@
+/*
+ * This file is part of the MPU6050-Library distribution (https://github.com/jmherzog-de/MPU6050-Library).
+ * Copyright (c) 2021 Jean-Marcel Herzog.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ *  \file bench_recording.c
+ *  \brief Sample recording
+ *  
+ *  Records 2000000 samples of a simulated sensor at 1 kHz (33 minutes)
+ *  with the settings of the sensor in the header, delivered in pieces of
+ *  1 to 64 samples like FIFO drains, with a jitter of the sample times, a
+ *  loss of 500 samples and a pause of two hours. Prints the write rate and
+ *  the number of write() calls. The recording is read back through the
+ *  memory mapped reader and compared sample by sample, the sum of each
+ *  channel is taken over the blocks without copying and 1000000 random
+ *  times are looked up with recording_seek() and compared with a binary
+ *  search over all sample times. A second recording that is never closed
+ *  must be readable up to the last complete write.
+ *  
+ *  The program exits with a non-zero value if a check fails or the writer
+ *  needs more than one write() per 1000 samples.
+ *  
+ *  Build and run on a host computer:
+ *  
+ *      gcc -O2 -Ilib -Ihardware/Host bench/bench_recording.c hardware/Host/recording.c hardware/Host/sim.c lib/mpu6050_*.c -o bench_recording
+ *      ./bench_recording /tmp/bench.rec
+ *  
+ *  \copyright Copyright 2021 Jean-Marcel Herzog. All rights reserved. This project is released under the GNU Public License.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "mpu6050.h"
+#include "sim.h"
+#include "recording.h"
+
+#define BENCH_SAMPLES       2000000
+#define BENCH_PERIOD_NS     1000000
+#define BENCH_JITTER_NS     20000
+#define BENCH_LOST_AT       700000
+#define BENCH_LOST          500
+#define BENCH_PAUSE_AT      1300000
+#define BENCH_PAUSE_NS      (2 * 3600 * (int64_t)1000000000)
+#define BENCH_SEEKS         1000000
+#define BENCH_CHUNK_MAX     64
+
+static int64_t times[BENCH_SAMPLES];
+static uint32_t seed = 1;
+
+/** Random number 0..32767 */
+static uint32_t bench_random(void)
+{
+    seed = seed * 1103515245 + 12345;
+    return (seed >> 16) & 0x7FFF;
+}
+
+/** Value of channel c of sample n */
+static int16_t bench_value(uint64_t n, uint8_t c)
+{
+    return (int16_t)(uint16_t)(n * 2654435761u + c * 40503u);
+}
+
+static void bench_sample(uint64_t n, tMPU6050_MOTION *sample)
+{
+    sample->ACCEL.X = bench_value(n, 0);
+    sample->ACCEL.Y = bench_value(n, 1);
+    sample->ACCEL.Z = bench_value(n, 2);
+    sample->TEMP = bench_value(n, 3);
+    sample->GYRO.X = bench_value(n, 4);
+    sample->GYRO.Y = bench_value(n, 5);
+    sample->GYRO.Z = bench_value(n, 6);
+}
+
+/** Sample times with jitter, a loss and a pause; the times are truncated to microseconds after the first one */
+static void bench_times(void)
+{
+    int64_t t = 1000000000;
+    uint32_t i;
+
+    for(i = 0; i < BENCH_SAMPLES; i++)
+    {
+        if(i == BENCH_LOST_AT)
+            t += (int64_t)BENCH_LOST * BENCH_PERIOD_NS;
+        if(i == BENCH_PAUSE_AT)
+            t += BENCH_PAUSE_NS;
+        times[i] = t + (int64_t)(bench_random() % (2 * BENCH_JITTER_NS / 1000)) * 1000;
+        t += BENCH_PERIOD_NS;
+    }
+}
+
+/**
+ *  \brief Write samples first..last-1 in random pieces
+ */
+static bool bench_write(tRECORDING_WRITER *w, uint32_t ui32First, uint32_t ui32Last)
+{
+    tMPU6050_MOTION chunk[BENCH_CHUNK_MAX];
+    uint32_t i = ui32First, n, k;
+
+    while(i < ui32Last)
+    {
+        n = 1 + bench_random() % BENCH_CHUNK_MAX;
+        if(n > ui32Last - i)
+            n = ui32Last - i;
+        for(k = 0; k < n; k++)
+            bench_sample(i + k, &chunk[k]);
+        if(i <= BENCH_LOST_AT && BENCH_LOST_AT < i + n)
+        {
+            // the loss shows before the piece that follows it
+            if(!recording_writerAppend(w, chunk, &times[i], BENCH_LOST_AT - i))
+                return false;
+            recording_writerLost(w, BENCH_LOST);
+            if(!recording_writerAppend(w, &chunk[BENCH_LOST_AT - i], &times[BENCH_LOST_AT], i + n - BENCH_LOST_AT))
+                return false;
+        }
+        else if(!recording_writerAppend(w, chunk, &times[i], n))
+            return false;
+        i += n;
+    }
+    return true;
+}
+
+/**
+ *  \brief Compare the first ui64Samples samples of a recording
+ *  \return Number of errors
+ */
+static uint32_t bench_compare(const tRECORDING_READER *r, uint64_t ui64Samples)
+{
+    tMPU6050_MOTION expect, sample;
+    uint64_t n;
+
+    if(r->SAMPLES != ui64Samples)
+    {
+        printf("%llu samples, expected %llu\n", (unsigned long long)r->SAMPLES, (unsigned long long)ui64Samples);
+        return 1;
+    }
+    for(n = 0; n < ui64Samples; n++)
+    {
+        bench_sample(n, &expect);
+        recording_sample(r, n, &sample);
+        if(memcmp(&expect, &sample, sizeof(sample)) || recording_sampleTime(r, n) != times[n])
+        {
+            printf("sample %llu differs\n", (unsigned long long)n);
+            return 1;
+        }
+    }
+    return 0;
+}
+
+/**
+ *  \brief Channel sums over the mapped blocks
+ *  \return Number of errors
+ */
+static uint32_t bench_channels(const tRECORDING_READER *r)
+{
+    int64_t sum[RECORDING_CHANNELS] = { 0 }, expect[RECORDING_CHANNELS] = { 0 };
+    uint32_t lost = 0, errors = 0, i;
+    uint64_t b, n;
+    uint8_t c;
+    clock_t start = clock();
+    double ms;
+
+    for(b = 0; b < r->BLOCKS; b++)
+    {
+        const tRECORDING_BLOCK *block = recording_block(r, b);
+
+        lost += block->LOST;
+        for(c = 0; c < RECORDING_CHANNELS; c++)
+        {
+            const int16_t *v = recording_blockChannel(r, b, c);
+
+            for(i = 0; i < block->COUNT; i++)
+                sum[c] += v[i];
+        }
+    }
+    ms = (double)(clock() - start) * 1e3 / CLOCKS_PER_SEC;
+
+    for(n = 0; n < BENCH_SAMPLES; n++)
+        for(c = 0; c < RECORDING_CHANNELS; c++)
+            expect[c] += bench_value(n, c);
+    for(c = 0; c < RECORDING_CHANNELS; c++)
+        if(sum[c] != expect[c])
+        {
+            printf("channel %u sum differs\n", c);
+            errors++;
+        }
+    if(lost != BENCH_LOST)
+    {
+        printf("%u samples lost, expected %u\n", lost, BENCH_LOST);
+        errors++;
+    }
+    printf("channel sums  %6.1f ms, %6.0f MByte/s\n", ms, BENCH_SAMPLES * RECORDING_CHANNELS * 2 / 1e3 / ms);
+
+    return errors;
+}
+
+/**
+ *  \brief Random seeks against a binary search over all times
+ *  \return Number of errors
+ */
+static uint32_t bench_seek(const tRECORDING_READER *r)
+{
+    static int64_t query[BENCH_SEEKS];
+    static uint64_t result[BENCH_SEEKS];
+    const int64_t t0 = times[0] - 1000000, span = times[BENCH_SAMPLES - 1] - t0 + 2000000;
+    uint32_t i, errors = 0;
+    clock_t start;
+    double ns;
+
+    for(i = 0; i < BENCH_SEEKS; i++)
+    {
+        // half of the queries fall into the time around the loss and the pause
+        int64_t t = (int64_t)(((uint64_t)bench_random() << 15 | bench_random()) % (uint64_t)(span / 1000)) * 1000 + bench_random() % 1000;
+
+        if(i & 1)
+            t = times[(i & 2) ? BENCH_LOST_AT : BENCH_PAUSE_AT] - 3000000 + (int64_t)(bench_random() % 6000) * 1000;
+        query[i] = t0 + ((i & 1) ? t - t0 : t);
+    }
+
+    start = clock();
+    for(i = 0; i < BENCH_SEEKS; i++)
+        result[i] = recording_seek(r, query[i]);
+    ns = (double)(clock() - start) * 1e9 / CLOCKS_PER_SEC / BENCH_SEEKS;
+
+    for(i = 0; i < BENCH_SEEKS; i++)
+    {
+        uint32_t lo = 0, hi = BENCH_SAMPLES;
+
+        while(lo < hi)
+        {
+            uint32_t mid = (lo + hi) / 2;
+
+            if(times[mid] < query[i])
+                lo = mid + 1;
+            else
+                hi = mid;
+        }
+        if(result[i] != lo && errors++ < 5)
+            printf("seek %lld: sample %llu, expected %u\n", (long long)query[i], (unsigned long long)result[i], lo);
+    }
+    printf("seek          %6.1f ns, %llu blocks, %llu buckets\n", ns, (unsigned long long)r->BLOCKS, (unsigned long long)r->BUCKETS);
+
+    return errors;
+}
+
+int main(int argc, char **argv)
+{
+    static tSIM_MPU6050 sim;
+    static tRECORDING_WRITER w;
+    static tRECORDING_READER r;
+    tMPU6050_DEV dev;
+    tMPU6050_FIFO_EN fifoEn = { 0 };
+    tMPU6050_ODR_PLAN plan;
+    tRECORDING_CONFIG config;
+    const char *path = argc > 1 ? argv[1] : "bench_recording.rec";
+    uint32_t errors = 0;
+    uint64_t writes;
+    clock_t start;
+    double ms;
+
+    sim_initialization(&sim, MPU6050_I2C_ADDR);
+    mpu6050_devInitialization(&dev, &sim.transport, MPU6050_I2C_ADDR);
+    mpu6050_odrApply(&dev, 1000, 188, &plan);
+    mpu6050_devAccelRangeSet(&dev, 2);
+    mpu6050_devGyroRangeSet(&dev, 1);
+    fifoEn.ACCEL_FIFO_EN = fifoEn.TEMP_FIFO_EN = true;
+    fifoEn.XG_FIFO_EN = fifoEn.YG_FIFO_EN = fifoEn.ZG_FIFO_EN = true;
+    mpu6050_fifoEnWriteReg(&dev, &fifoEn);
+    recording_configGet(&dev, 1600000000LL * 1000000000, &config);
+
+    bench_times();
+
+    start = clock();
+    if(!recording_writerOpen(&w, path, &config) || !bench_write(&w, 0, BENCH_SAMPLES))
+    {
+        perror(path);
+        return 1;
+    }
+    writes = w.WRITES;
+    if(!recording_writerClose(&w))
+    {
+        perror(path);
+        return 1;
+    }
+    ms = (double)(clock() - start) * 1e3 / CLOCKS_PER_SEC;
+    printf("write         %6.1f ms, %6.1f ns/sample, %llu write() calls\n", ms, ms * 1e6 / BENCH_SAMPLES, (unsigned long long)writes);
+    if(writes * 1000 > BENCH_SAMPLES)
+    {
+        printf("more than one write() per 1000 samples\n");
+        errors++;
+    }
+
+    start = clock();
+    if(!recording_open(&r, path))
+    {
+        printf("%s: no recording\n", path);
+        return 1;
+    }
+    printf("open          %6.1f ms, %zu bytes, %.2f bytes/sample\n", (double)(clock() - start) * 1e3 / CLOCKS_PER_SEC, r.SIZE, (double)r.SIZE / BENCH_SAMPLES);
+
+    if(memcmp(&r.header->CONFIG, &config, sizeof(config)) || r.header->CONFIG.PERIOD_NS != BENCH_PERIOD_NS
+        || r.header->CONFIG.AFS_SEL != 2 || r.header->CONFIG.FS_SEL != 1 || r.header->CONFIG.FIFO_EN != fifoEn.RAW)
+    {
+        printf("device settings differ\n");
+        errors++;
+    }
+    errors += bench_compare(&r, BENCH_SAMPLES);
+    errors += bench_channels(&r);
+    errors += bench_seek(&r);
+    recording_close(&r);
+
+    // never closed: readable up to the last write
+    if(!recording_writerOpen(&w, path, &config) || !bench_write(&w, 0, BENCH_SAMPLES / 4) || !recording_writerFlush(&w))
+    {
+        perror(path);
+        return 1;
+    }
+    if(!recording_open(&r, path))
+    {
+        printf("%s: recording that was not closed cannot be opened\n", path);
+        errors++;
+    }
+    else
+    {
+        errors += bench_compare(&r, w.HEADER.BLOCKS * RECORDING_BLOCK_SAMPLES);
+        printf("not closed    %llu of %u samples readable\n", (unsigned long long)r.SAMPLES, BENCH_SAMPLES / 4);
+        recording_close(&r);
+    }
+    recording_writerClose(&w);
+    remove(path);
+
+    printf("%u errors\n", errors);
+
+    return errors ? 1 : 0;
+}
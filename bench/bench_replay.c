@@ -0,0 +1,272 @@
+/*
+ * This file is part of the MPU6050-Library distribution (https://github.com/jmherzog-de/MPU6050-Library).
+ * Copyright (c) 2021 Jean-Marcel Herzog.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ *  \file bench_replay.c
+ *  \brief Recording replay
+ *  
+ *  Writes a recording of 300000 samples (5 minutes at 1 kHz, sensor clock
+ *  250 ppm fast, a loss of 100 samples) and replays it through the library:
+ *  the application loop sleeps 5ms, drains the FIFO with mpu6050_fifoDrain(),
+ *  scales the samples and runs a complementary filter for roll and pitch.
+ *  Every 16th loop also reads the measurement registers with
+ *  mpu6050_accelReadReg() and mpu6050_gyroReadReg().
+ *  
+ *  The unpaced replay runs twice: both runs must deliver every recorded
+ *  sample in order, without FIFO overflow and with the same filter output.
+ *  Prints the throughput of the whole pipeline (bus model, FIFO decode,
+ *  scaling and filter) in samples per second and as a multiple of real
+ *  time. Afterwards 250ms of the recording are replayed in real time and
+ *  2s at 20 times real time from minute 1: the wall clock time must match
+ *  within -5% and +50%.
+ *  
+ *  Build and run on a host computer:
+ *  
+ *      gcc -O2 -Ilib -Ihardware/Host bench/bench_replay.c hardware/Host/replay.c hardware/Host/recording.c hardware/Host/sim.c lib/mpu6050_*.c -lm -o bench_replay
+ *      ./bench_replay /tmp/bench.rec
+ *  
+ *  \copyright Copyright 2021 Jean-Marcel Herzog. All rights reserved. This project is released under the GNU Public License.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include "mpu6050.h"
+#include "sim.h"
+#include "recording.h"
+#include "replay.h"
+
+#define BENCH_SAMPLES       300000
+#define BENCH_PERIOD_NS     1000000
+#define BENCH_CLOCK_PPM     250
+#define BENCH_LOST_AT       100000
+#define BENCH_LOST          100
+#define BENCH_SLEEP_NS      5000000
+#define BENCH_BUF_FRAMES    (MPU6050_FIFO_SIZE / MPU6050_MOTION_BURST_LEN)
+#define BENCH_FILTER_ALPHA  0.98f
+
+/**
+ *  \brief Result of one replay
+ */
+typedef struct
+{
+    uint64_t SAMPLES;       /**< Samples processed */
+    uint64_t WALL_NS;       /**< Wall clock time */
+    uint64_t SIM_NS;        /**< Virtual time */
+    double CHECKSUM;        /**< Sum of the filter output */
+    uint32_t ERRORS;        /**< Samples or register reads that differ from the recording */
+}
+tBENCH_RUN;
+
+/** Recorded sample n */
+static void bench_sample(uint32_t n, tMPU6050_MOTION *sample)
+{
+    double t = n / 1000.0;
+
+    sample->ACCEL.X = (int16_t)(3000 * sin(2 * M_PI * 0.3 * t) + (n * 7919 % 41) - 20);
+    sample->ACCEL.Y = (int16_t)(2000 * sin(2 * M_PI * 0.7 * t) + (n * 6007 % 41) - 20);
+    sample->ACCEL.Z = (int16_t)(8192 + 1000 * cos(2 * M_PI * 0.5 * t) + (n * 3001 % 41) - 20);
+    sample->TEMP = (int16_t)(-1500 + n / 10000);
+    sample->GYRO.X = (int16_t)(4000 * cos(2 * M_PI * 0.3 * t) + (n * 104729 % 17) - 8);
+    sample->GYRO.Y = (int16_t)(3000 * cos(2 * M_PI * 0.7 * t) + (n * 1299709 % 17) - 8);
+    sample->GYRO.Z = (int16_t)(500 * sin(2 * M_PI * 1.1 * t) + (n * 15485863 % 17) - 8);
+}
+
+/**
+ *  \brief Record the session to replay
+ */
+static bool bench_record(const char *pcPath)
+{
+    static tSIM_MPU6050 sim;
+    static tRECORDING_WRITER w;
+    tMPU6050_DEV dev;
+    tMPU6050_FIFO_EN fifoEn = { 0 };
+    tMPU6050_ODR_PLAN plan;
+    tRECORDING_CONFIG config;
+    tMPU6050_MOTION sample;
+    int64_t t;
+    uint32_t n;
+
+    sim_initialization(&sim, MPU6050_I2C_ADDR);
+    mpu6050_devInitialization(&dev, &sim.transport, MPU6050_I2C_ADDR);
+    mpu6050_odrApply(&dev, 1000, 98, &plan);
+    mpu6050_busWrite(&dev, MPU6050_ACCEL_CONFIG, 1 << 3);
+    mpu6050_busWrite(&dev, MPU6050_GYRO_CONFIG, 1 << 3);
+    fifoEn.ACCEL_FIFO_EN = fifoEn.TEMP_FIFO_EN = true;
+    fifoEn.XG_FIFO_EN = fifoEn.YG_FIFO_EN = fifoEn.ZG_FIFO_EN = true;
+    mpu6050_fifoEnWriteReg(&dev, &fifoEn);
+    recording_configGet(&dev, 0, &config);
+
+    if(!recording_writerOpen(&w, pcPath, &config))
+        return false;
+    for(n = 0; n < BENCH_SAMPLES; n++)
+    {
+        // the sensor clock runs fast, the loss leaves a gap in time
+        t = (int64_t)((n + (n >= BENCH_LOST_AT ? BENCH_LOST : 0)) * (double)BENCH_PERIOD_NS * 1e6 / (1e6 + BENCH_CLOCK_PPM));
+        if(n == BENCH_LOST_AT)
+            recording_writerLost(&w, BENCH_LOST);
+        bench_sample(n, &sample);
+        if(!recording_writerAppend(&w, &sample, &t, 1))
+            return false;
+    }
+    return recording_writerClose(&w);
+}
+
+/**
+ *  \brief Replay through the application loop
+ *  
+ *  \param [in] rec Recording
+ *  \param [in] ui32Speed Pacing
+ *  \param [in] i64StartNs Time of the recording to start at
+ *  \param [in] ui64DurationNs Virtual time to replay, 0 for the whole recording
+ *  \param [in] run Returns the result
+ */
+static void bench_replay(const tRECORDING_READER *rec, uint32_t ui32Speed, int64_t i64StartNs, uint64_t ui64DurationNs, tBENCH_RUN *run)
+{
+    static tREPLAY rp;
+    static tMPU6050_MOTION buf[BENCH_BUF_FRAMES];
+    tMPU6050_DEV dev;
+    tMPU6050_MOTION_SI si;
+    tMPU6050_MOTION expect;
+    tMPU6050_ACCEL accel;
+    tMPU6050_GYRO gyro;
+    float roll = 0, pitch = 0;
+    const float dt = BENCH_PERIOD_NS * 1e-9f;
+    uint64_t first, total, start, loops = 0;
+    uint16_t n, i;
+
+    memset(run, 0, sizeof(*run));
+    replay_initialization(&rp, rec, MPU6050_I2C_ADDR);
+    replay_devInitialization(&rp, &dev);
+    replay_seek(&rp, i64StartNs);
+    first = rp.NEXT;
+    total = rec->SAMPLES - first;
+
+    start = replay_wallClockNs();
+    replay_paceSet(&rp, ui32Speed);
+
+    while(run->SAMPLES < total && (ui64DurationNs == 0 || rp.sim.ui64TimeNs - rp.SIM_START_NS < ui64DurationNs))
+    {
+        sim_clockAdvance(&rp.sim, BENCH_SLEEP_NS);
+        n = mpu6050_fifoDrain(&dev, buf, BENCH_BUF_FRAMES);
+
+        for(i = 0; i < n && run->SAMPLES < total; i++)
+        {
+            bench_sample((uint32_t)(first + run->SAMPLES), &expect);
+            if(memcmp(&expect, &buf[i], sizeof(expect)) && run->ERRORS++ < 5)
+                printf("sample %llu differs\n", (unsigned long long)(first + run->SAMPLES));
+
+            mpu6050_motionScale(&dev, &buf[i], &si);
+            roll = BENCH_FILTER_ALPHA * (roll + si.GYRO.X * dt) + (1 - BENCH_FILTER_ALPHA) * atan2f(si.ACCEL.Y, si.ACCEL.Z);
+            pitch = BENCH_FILTER_ALPHA * (pitch + si.GYRO.Y * dt) + (1 - BENCH_FILTER_ALPHA) * atan2f(-si.ACCEL.X, si.ACCEL.Z);
+            run->CHECKSUM += roll + pitch;
+            run->SAMPLES++;
+        }
+
+        // the measurement registers hold the last sample taken, which may change during the bus transfers
+        if((++loops & 15) == 0 && !rp.END)
+        {
+            uint64_t before = rp.NEXT - 1, k;
+            bool accelOk = false, gyroOk = false;
+
+            mpu6050_accelReadReg(&dev, &accel);
+            mpu6050_gyroReadReg(&dev, &gyro);
+            for(k = before; k < rp.NEXT; k++)
+            {
+                bench_sample((uint32_t)k, &expect);
+                accelOk = accelOk || !memcmp(&accel, &expect.ACCEL, sizeof(accel));
+                gyroOk = gyroOk || !memcmp(&gyro, &expect.GYRO, sizeof(gyro));
+            }
+            if((!accelOk || !gyroOk) && run->ERRORS++ < 5)
+                printf("measurement registers differ from sample %llu\n", (unsigned long long)before);
+        }
+    }
+
+    run->WALL_NS = replay_wallClockNs() - start;
+    run->SIM_NS = rp.sim.ui64TimeNs - rp.SIM_START_NS;
+    if(dev.FIFO_STATUS.OVERFLOWS)
+    {
+        printf("%u FIFO overflows\n", (unsigned)dev.FIFO_STATUS.OVERFLOWS);
+        run->ERRORS++;
+    }
+    if(rp.sim.i32ClockPpm < BENCH_CLOCK_PPM - 5 || rp.sim.i32ClockPpm > BENCH_CLOCK_PPM + 5)
+    {
+        printf("clock error %d ppm, recorded %d ppm\n", rp.sim.i32ClockPpm, BENCH_CLOCK_PPM);
+        run->ERRORS++;
+    }
+}
+
+/**
+ *  \brief Paced replay
+ *  \return Number of errors
+ */
+static uint32_t bench_paced(const tRECORDING_READER *rec, uint32_t ui32Speed, uint64_t ui64DurationNs)
+{
+    tBENCH_RUN run;
+    double ratio;
+
+    bench_replay(rec, ui32Speed, 60 * (int64_t)1000000000, ui64DurationNs, &run);
+    ratio = (double)run.WALL_NS * ui32Speed / run.SIM_NS;
+    printf("speed %2u: %5.0f ms of the recording in %5.1f ms wall clock (%.3f of the nominal time)\n",
+           ui32Speed, run.SIM_NS / 1e6, run.WALL_NS / 1e6, ratio);
+
+    if(ratio < 0.95 || ratio > 1.5)
+    {
+        printf("pacing off\n");
+        run.ERRORS++;
+    }
+    return run.ERRORS;
+}
+
+int main(int argc, char **argv)
+{
+    static tRECORDING_READER rec;
+    const char *path = argc > 1 ? argv[1] : "bench_replay.rec";
+    tBENCH_RUN run[2];
+    uint32_t errors = 0, k;
+
+    if(!bench_record(path) || !recording_open(&rec, path))
+    {
+        perror(path);
+        return 1;
+    }
+
+    for(k = 0; k < 2; k++)
+    {
+        bench_replay(&rec, REPLAY_UNPACED, 0, 0, &run[k]);
+        errors += run[k].ERRORS;
+        printf("unpaced:  %llu samples, %6.1f ms, %8.0f samples/s, %5.0f x real time\n",
+               (unsigned long long)run[k].SAMPLES, run[k].WALL_NS / 1e6,
+               run[k].SAMPLES * 1e9 / run[k].WALL_NS, (double)run[k].SIM_NS / run[k].WALL_NS);
+        if(run[k].SAMPLES != BENCH_SAMPLES)
+            errors++;
+    }
+    if(run[0].CHECKSUM != run[1].CHECKSUM)
+    {
+        printf("filter output differs between runs\n");
+        errors++;
+    }
+
+    errors += bench_paced(&rec, REPLAY_REALTIME, 250000000);
+    errors += bench_paced(&rec, 20, 2000000000);
+
+    recording_close(&rec);
+    remove(path);
+    printf("%u errors\n", errors);
+
+    return errors ? 1 : 0;
+}
@@ -0,0 +1,140 @@
+/*
+ * This file is part of the MPU6050-Library distribution (https://github.com/jmherzog-de/MPU6050-Library).
+ * Copyright (c) 2021 Jean-Marcel Herzog.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+/**
+ *  \file bench_ring.c
+ *  \brief Sample ring between acquisition and a slower consumer
+ *  
+ *  Acquires samples from the simulated sensor at 1kHz with the interrupt
+ *  driven acquisition into a sample ring and pops them in batches in a
+ *  control loop, first at 100Hz and then at 10Hz, where the ring is too
+ *  small. Prints the samples taken, popped and dropped and the high-water
+ *  mark of the ring. The program exits with a non-zero value if the 100Hz
+ *  loop loses a sample or the timestamps are out of order, or if the 10Hz
+ *  loop does not count the dropped samples.
+ *  
+ *  Build and run on a host computer:
+ *  
+ *      gcc -Ilib -Ihardware/Host bench/bench_ring.c lib/mpu6050_*.c hardware/Host/sim.c -o bench_ring
+ *      ./bench_ring
+ *  
+ *  \copyright Copyright 2021 Jean-Marcel Herzog. All rights reserved. This project is released under the GNU Public License.
+ */
+
+#include <stdio.h>
+#include "mpu6050.h"
+#include "sim.h"
+
+#define BENCH_SAMPLES   2000
+#define BENCH_BATCH     16
+
+static tSIM_MPU6050 sim;
+static tMPU6050_DEV dev;
+static tMPU6050_ACQ acq;
+static tMPU6050_RING ring;
+
+/** Host clock in microseconds */
+static uint32_t bench_clock(void)
+{
+    return (uint32_t)(sim.ui64TimeNs / 1000);
+}
+
+static void bench_intPin(void *arg)
+{
+    mpu6050_acqIntEdge((tMPU6050_ACQ*)arg);
+}
+
+/**
+ *  \brief Run the control loop at the given rate
+ *  
+ *  \param [in] ui32LoopHz Control loop rate
+ *  \param [out] pui32Taken Samples taken by the sensor
+ *  \param [out] pui32Popped Samples popped by the control loop
+ *  \return Number of timestamps that are not after the previous one
+ */
+static uint32_t bench_run(uint32_t ui32LoopHz, uint32_t *pui32Taken, uint32_t *pui32Popped)
+{
+    tMPU6050_SAMPLE samples[BENCH_BATCH];
+    uint64_t period = 1000000000ULL / ui32LoopHz;
+    uint64_t end;
+    uint32_t start;
+    uint32_t last = 0;
+    uint32_t disorder = 0;
+    uint16_t n, i;
+
+    sim_initialization(&sim, MPU6050_I2C_ADDR);
+    mpu6050_devInitialization(&dev, &sim.transport, MPU6050_I2C_ADDR);
+    sim_intHandlerSet(&sim, bench_intPin, &acq);
+
+    // wake up, DLPF 44Hz -> 1kHz sample rate
+    mpu6050_busWrite(&dev, MPU6050_CONFIG, 0x03);
+    mpu6050_busWrite(&dev, MPU6050_PWR_MGMT_1, 0x00);
+
+    mpu6050_ringInitialization(&ring);
+    mpu6050_acqStart(&dev, &acq, bench_clock, mpu6050_ringAcqPush, &ring);
+
+    start = sim.ui32Samples;
+    *pui32Popped = 0;
+    end = sim.ui64TimeNs + (uint64_t)BENCH_SAMPLES * sim_samplePeriodNs(&sim);
+    while(sim.ui64TimeNs < end)
+    {
+        sim_clockAdvance(&sim, period);
+
+        // control cycle: consume everything that arrived
+        while((n = mpu6050_ringPop(&ring, samples, BENCH_BATCH)) != 0)
+        {
+            for(i = 0; i < n; i++)
+            {
+                if(samples[i].TIMESTAMP <= last)
+                    disorder++;
+                last = samples[i].TIMESTAMP;
+            }
+            *pui32Popped += n;
+        }
+    }
+
+    mpu6050_acqStop(&acq);
+    sim_queueFlush(&sim);
+    *pui32Taken = sim.ui32Samples - start;
+    *pui32Popped += mpu6050_ringPop(&ring, samples, BENCH_BATCH);
+
+    return disorder;
+}
+
+int main(void)
+{
+    uint32_t taken100, popped100, overruns100, highWater100, disorder100;
+    uint32_t taken10, popped10, overruns10, highWater10;
+
+    disorder100 = bench_run(100, &taken100, &popped100);
+    overruns100 = ring.OVERRUNS;
+    highWater100 = ring.HIGH_WATER;
+
+    bench_run(10, &taken10, &popped10);
+    overruns10 = ring.OVERRUNS;
+    highWater10 = ring.HIGH_WATER;
+
+    printf("ring size %u samples\n", (unsigned)MPU6050_RING_SIZE);
+    printf("%-8s %8s %8s %9s %11s\n", "loop", "taken", "popped", "overruns", "high-water");
+    printf("%-8s %8u %8u %9u %11u\n", "100Hz", (unsigned)taken100, (unsigned)popped100, (unsigned)overruns100, (unsigned)highWater100);
+    printf("%-8s %8u %8u %9u %11u\n", "10Hz", (unsigned)taken10, (unsigned)popped10, (unsigned)overruns10, (unsigned)highWater10);
+
+    if(popped100 != taken100 || overruns100 || disorder100)
+        return 1;
+    if(overruns10 == 0 || popped10 + overruns10 != taken10)
+        return 1;
+    return 0;
+}
@@ -0,0 +1,238 @@
+/*
+ * This file is part of the MPU6050-Library distribution (https://github.com/jmherzog-de/MPU6050-Library).
+ * Copyright (c) 2021 Jean-Marcel Herzog.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ *  \file bench_telemetry.c
+ *  \brief Binary telemetry framing
+ *  
+ *  Streams 17000 raw and 8000 scaled samples through the telemetry encoder
+ *  into a wire buffer and prints the wire bytes per sample and the sample
+ *  rate a 115200 baud 8N1 link carries, next to the ASCII hex output of
+ *  uart_ascii.c (four hex digits and a separator per value). The wire is
+ *  decoded again and compared with the input. Afterwards the wire is
+ *  corrupted (bit flips, dropped bytes, noise between frames): the decoder
+ *  must reject every damaged frame, count the missing ones and deliver all
+ *  others. Prints the encode and decode speed.
+ *  
+ *  The program exits with a non-zero value if a sample differs, a damaged
+ *  frame is accepted, or the binary link carries less than twice the ASCII
+ *  sample rate.
+ *  
+ *  Build and run on a host computer:
+ *  
+ *      gcc -O2 -Ilib -Ihardware bench/bench_telemetry.c hardware/telemetry.c lib/mpu6050_*.c -o bench_telemetry
+ *      ./bench_telemetry
+ *  
+ *  \copyright Copyright 2021 Jean-Marcel Herzog. All rights reserved. This project is released under the GNU Public License.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include "mpu6050.h"
+#include "telemetry.h"
+
+#define BENCH_RAW_SAMPLES       17000
+#define BENCH_SCALED_SAMPLES    8000
+#define BENCH_WIRE_SIZE         (2 * 1024 * 1024)
+#define BENCH_BAUD_BYTES        (115200 / 10)
+#define BENCH_ASCII_SIZE        (7 * 5)
+
+static tMPU6050_MOTION raw[BENCH_RAW_SAMPLES];
+static tMPU6050_MOTION_SI scaled[BENCH_SCALED_SAMPLES];
+static uint8_t wire[BENCH_WIRE_SIZE];
+static uint32_t wireLen;
+static uint32_t frameStart[4096];
+static uint32_t frameCount;
+
+/** Byte sink: appends to the wire buffer */
+static void bench_write(const uint8_t *pui8Data, uint16_t ui16Count)
+{
+    if(wireLen + ui16Count > BENCH_WIRE_SIZE)
+        return;
+    frameStart[frameCount++ % 4096] = wireLen;
+    memcpy(&wire[wireLen], pui8Data, ui16Count);
+    wireLen += ui16Count;
+}
+
+static uint32_t seed = 1;
+
+static uint32_t bench_random(void)
+{
+    seed = seed * 1103515245u + 12345u;
+    return seed >> 8;
+}
+
+/**
+ *  \brief Decode a wire buffer and compare with the input
+ *  
+ *  \return Number of samples that differ
+ */
+static unsigned int bench_decode(tTELEMETRY_DECODER *dec, const uint8_t *pui8Wire, uint32_t ui32Len)
+{
+    static tMPU6050_MOTION rawOut[TELEMETRY_PAYLOAD_MAX / TELEMETRY_RAW_SIZE];
+    static tMPU6050_MOTION_SI scaledOut[TELEMETRY_PAYLOAD_MAX / TELEMETRY_SCALED_SIZE];
+    uint32_t next[2] = { 0, 0 };
+    unsigned int errors = 0;
+    uint32_t i, frame;
+    uint16_t n, k;
+
+    for(i = 0; i < ui32Len; i++)
+    {
+        if(!telemetry_decodeByte(dec, pui8Wire[i]))
+            continue;
+
+        // sequence numbers count frames, the position of a sample follows from it
+        if(dec->CHANNEL < 2)
+        {
+            frame = next[dec->CHANNEL] + (uint8_t)(dec->SEQ - (uint8_t)next[dec->CHANNEL]);
+            next[dec->CHANNEL] = frame + 1;
+        }
+
+        if(dec->CHANNEL == TELEMETRY_CHANNEL_RAW)
+        {
+            n = telemetry_rawUnpack(dec->payload, dec->PAYLOAD_LEN, rawOut);
+            for(k = 0; k < n; k++)
+                if(memcmp(&rawOut[k], &raw[frame * 17 + k], sizeof(rawOut[k])))
+                    errors++;
+        }
+        else if(dec->CHANNEL == TELEMETRY_CHANNEL_SCALED)
+        {
+            n = telemetry_scaledUnpack(dec->payload, dec->PAYLOAD_LEN, scaledOut);
+            for(k = 0; k < n; k++)
+                if(memcmp(&scaledOut[k], &scaled[frame * 8 + k], sizeof(scaledOut[k])))
+                    errors++;
+        }
+        else
+        {
+            errors++;
+        }
+    }
+
+    return errors;
+}
+
+int main(void)
+{
+    static uint8_t damaged[BENCH_WIRE_SIZE];
+    tTELEMETRY tel;
+    tTELEMETRY_DECODER dec;
+    unsigned int errors = 0, damagedFrames = 0, droppedFrames = 0;
+    uint32_t i, rawBytes, scaledBytes, damagedLen = 0;
+    double binaryRate, asciiRate, encodeNs, decodeNs;
+    clock_t start;
+
+    for(i = 0; i < BENCH_RAW_SAMPLES; i++)
+    {
+        // sensor at rest with noise, including zero bytes
+        raw[i].ACCEL.X = (int16_t)(bench_random() % 512 - 256);
+        raw[i].ACCEL.Y = (int16_t)(bench_random() % 512 - 256);
+        raw[i].ACCEL.Z = (int16_t)(16384 + bench_random() % 512 - 256);
+        raw[i].TEMP = (int16_t)(-3900 + bench_random() % 16);
+        raw[i].GYRO.X = (int16_t)(bench_random() % 64 - 32);
+        raw[i].GYRO.Y = (int16_t)(bench_random() % 64 - 32);
+        raw[i].GYRO.Z = (int16_t)(bench_random() % 64 - 32);
+    }
+    for(i = 0; i < BENCH_SCALED_SAMPLES; i++)
+    {
+        scaled[i].ACCEL.X = raw[i].ACCEL.X / 16384.0f * 9.80665f;
+        scaled[i].ACCEL.Y = raw[i].ACCEL.Y / 16384.0f * 9.80665f;
+        scaled[i].ACCEL.Z = raw[i].ACCEL.Z / 16384.0f * 9.80665f;
+        scaled[i].TEMP = raw[i].TEMP / 340.0f + 36.53f;
+        scaled[i].GYRO.X = raw[i].GYRO.X / 131.0f;
+        scaled[i].GYRO.Y = raw[i].GYRO.Y / 131.0f;
+        scaled[i].GYRO.Z = 0.0f;
+    }
+
+    // raw and scaled streams
+    telemetry_initialization(&tel, bench_write);
+    start = clock();
+    telemetry_sendRaw(&tel, raw, BENCH_RAW_SAMPLES);
+    encodeNs = (double)(clock() - start) * 1e9 / CLOCKS_PER_SEC / BENCH_RAW_SAMPLES;
+    rawBytes = wireLen;
+    telemetry_sendScaled(&tel, scaled, BENCH_SCALED_SAMPLES);
+    scaledBytes = wireLen - rawBytes;
+
+    binaryRate = BENCH_BAUD_BYTES / ((double)rawBytes / BENCH_RAW_SAMPLES);
+    asciiRate = BENCH_BAUD_BYTES / (double)BENCH_ASCII_SIZE;
+    printf("format            bytes/sample  samples/s at 115200 baud\n");
+    printf("ASCII hex         %12u %12.0f\n", BENCH_ASCII_SIZE, asciiRate);
+    printf("binary raw        %12.2f %12.0f\n", (double)rawBytes / BENCH_RAW_SAMPLES, binaryRate);
+    printf("binary scaled     %12.2f %12.0f\n", (double)scaledBytes / BENCH_SCALED_SAMPLES,
+           BENCH_BAUD_BYTES / ((double)scaledBytes / BENCH_SCALED_SAMPLES));
+    if(binaryRate < 2.0 * asciiRate)
+        errors++;
+
+    // clean wire
+    telemetry_decoderInitialization(&dec);
+    dec.bSkip = false;
+    start = clock();
+    errors += bench_decode(&dec, wire, wireLen);
+    decodeNs = (double)(clock() - start) * 1e9 / CLOCKS_PER_SEC / wireLen;
+    if(dec.FRAMES != tel.FRAMES || dec.CRC_ERRORS || dec.FORMAT_ERRORS || dec.LOST)
+        errors++;
+    printf("clean wire:   %u of %u frames, %u CRC errors, %u format errors, %u lost\n",
+           (unsigned)dec.FRAMES, (unsigned)tel.FRAMES, (unsigned)dec.CRC_ERRORS,
+           (unsigned)dec.FORMAT_ERRORS, (unsigned)dec.LOST);
+
+    // damaged wire: every 7th frame gets a bit flip, every 11th loses a byte, noise after every 13th
+    for(i = 0; i < frameCount && i < 4096; i++)
+    {
+        uint32_t begin = frameStart[i];
+        uint32_t end = (i + 1 < frameCount) ? frameStart[i + 1] : wireLen;
+        uint32_t len = end - begin;
+
+        memcpy(&damaged[damagedLen], &wire[begin], len);
+        if(i % 7 == 3)
+        {
+            damaged[damagedLen + bench_random() % (len - 1)] ^= (uint8_t)(1 << (bench_random() % 8));
+            damagedFrames++;
+        }
+        else if(i % 11 == 5)
+        {
+            uint32_t drop = bench_random() % (len - 1);
+
+            memmove(&damaged[damagedLen + drop], &damaged[damagedLen + drop + 1], len - drop - 1);
+            len--;
+            damagedFrames++;
+        }
+        damagedLen += len;
+
+        if(i % 13 == 6)
+        {
+            damaged[damagedLen++] = 0x5A;
+            damaged[damagedLen++] = 0xA5;
+            damaged[damagedLen++] = 0;
+        }
+    }
+    for(i = 0; i < frameCount; i++)
+        if(i % 7 == 3 || i % 11 == 5)
+            droppedFrames++;
+
+    telemetry_decoderInitialization(&dec);
+    dec.bSkip = false;
+    errors += bench_decode(&dec, damaged, damagedLen);
+    printf("damaged wire: %u of %u frames, %u CRC errors, %u format errors, %u lost (%u damaged)\n",
+           (unsigned)dec.FRAMES, (unsigned)tel.FRAMES, (unsigned)dec.CRC_ERRORS,
+           (unsigned)dec.FORMAT_ERRORS, (unsigned)dec.LOST, damagedFrames);
+    if(dec.FRAMES != tel.FRAMES - damagedFrames || dec.LOST != droppedFrames)
+        errors++;
+
+    printf("encode %.1f ns/sample, decode %.1f ns/byte\n", encodeNs, decodeNs);
+    printf("%u errors\n", errors);
+    return errors ? 1 : 0;
+}
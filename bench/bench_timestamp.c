@@ -0,0 +1,197 @@
+/*
+ * This file is part of the MPU6050-Library distribution (https://github.com/jmherzog-de/MPU6050-Library).
+ * Copyright (c) 2021 Jean-Marcel Herzog.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ *  \file bench_timestamp.c
+ *  \brief FIFO sample timestamp reconstruction
+ *  
+ *  Streams accelerometer, temperature and gyroscope frames (14 bytes) at
+ *  1kHz from a simulated sensor whose clock runs 0.8% fast. The host drains
+ *  the FIFO every 20ms plus a random wake-up delay of up to 2ms. Every frame
+ *  is stamped twice:
+ *  
+ *  - nominal: the newest frame at the drain time, the older frames the
+ *    nominal period of the configuration apart
+ *  - mpu6050_tsDrain()
+ *  
+ *  and compared with the true sample time of the simulator. After 2s to
+ *  lock, prints the mean offset and the jitter (largest deviation from the
+ *  mean offset) of both and the fitted clock error. Then the host stalls
+ *  for 1.5s, the FIFO overflows and the measurement is repeated.
+ *  The program exits with a non-zero value if the mean offset or the
+ *  jitter of mpu6050_tsDrain() exceeds 20% of the sample period or the
+ *  fitted clock error is off by more than 100ppm.
+ *  
+ *  Build and run on a host computer:
+ *  
+ *      gcc -Ilib -Ihardware/Host bench/bench_timestamp.c lib/mpu6050_*.c hardware/Host/sim.c -o bench_timestamp
+ *      ./bench_timestamp
+ *  
+ *  \copyright Copyright 2021 Jean-Marcel Herzog. All rights reserved. This project is released under the GNU Public License.
+ */
+
+#include <stdio.h>
+#include "mpu6050.h"
+#include "sim.h"
+
+#define BENCH_CLOCK_PPM     8000
+#define BENCH_LOCK_NS       2000000000ULL
+#define BENCH_PHASE_NS      4000000000ULL
+#define BENCH_SLEEP_US      20000
+#define BENCH_JITTER_US     2000
+#define BENCH_STALL_US      1500000
+#define BENCH_BUF_FRAMES    (MPU6050_FIFO_SIZE / 14)
+
+static tSIM_MPU6050 sim;
+static tMPU6050_DEV dev;
+static tMPU6050_TIMESTAMP ts;
+static uint16_t sampleNumber;
+static uint64_t sampleTimeNs[8192];
+
+/**
+ *  \brief Data source: channel i of sample n is n * 8 + i, records the sample time
+ */
+static void bench_source(void *arg, uint64_t ui64TimeNs, int16_t *pi16Data)
+{
+    uint8_t i;
+
+    (void)arg;
+    for(i = 0; i < 7; i++)
+        pi16Data[i] = (int16_t)(sampleNumber * 8 + i);
+    sampleTimeNs[sampleNumber % 8192] = ui64TimeNs;
+    sampleNumber++;
+}
+
+/** Host clock in microseconds */
+static uint32_t bench_clock(void)
+{
+    return (uint32_t)(sim.ui64TimeNs / 1000);
+}
+
+/**
+ *  \brief Error statistics of one timestamp method
+ */
+typedef struct
+{
+    double SUM;
+    double MIN;
+    double MAX;
+    uint32_t COUNT;
+}
+tBENCH_ERROR;
+
+static void bench_errorAdd(tBENCH_ERROR *err, double dErrorUs)
+{
+    if(err->COUNT == 0 || dErrorUs < err->MIN)
+        err->MIN = dErrorUs;
+    if(err->COUNT == 0 || dErrorUs > err->MAX)
+        err->MAX = dErrorUs;
+    err->SUM += dErrorUs;
+    err->COUNT++;
+}
+
+/** Largest deviation from the mean error */
+static double bench_errorJitter(const tBENCH_ERROR *err)
+{
+    double mean = err->SUM / err->COUNT;
+
+    return (err->MAX - mean > mean - err->MIN) ? err->MAX - mean : mean - err->MIN;
+}
+
+/**
+ *  \brief Run one phase
+ *  
+ *  \return Number of errors
+ */
+static unsigned int bench_phase(const char *name)
+{
+    static tMPU6050_MOTION buf[BENCH_BUF_FRAMES];
+    static uint32_t stamps[BENCH_BUF_FRAMES];
+    static uint32_t seed = 1;
+    const double periodUs = mpu6050_samplePeriodNs(&dev) / 1000.0;
+    const double truePpm = 1e6 * sim_samplePeriodNs(&sim) / mpu6050_samplePeriodNs(&dev) - 1e6;
+    uint64_t start = sim.ui64TimeNs;
+    tBENCH_ERROR nominal = { 0 }, fitted = { 0 };
+    uint16_t n, i;
+
+    while(sim.ui64TimeNs - start < BENCH_PHASE_NS)
+    {
+        uint32_t now;
+
+        seed = seed * 1103515245u + 12345u;
+        sim_clockAdvance(&sim, ((uint64_t)BENCH_SLEEP_US + (seed >> 16) % BENCH_JITTER_US) * 1000);
+
+        now = bench_clock();
+        n = mpu6050_tsDrain(&ts, buf, stamps, BENCH_BUF_FRAMES);
+        if(sim.ui64TimeNs - start < BENCH_LOCK_NS)
+            continue;
+
+        for(i = 0; i < n; i++)
+        {
+            double trueUs = sampleTimeNs[(uint16_t)buf[i].ACCEL.X / 8] / 1000.0;
+
+            bench_errorAdd(&nominal, now - (n - 1 - i) * periodUs - trueUs);
+            bench_errorAdd(&fitted, stamps[i] - trueUs);
+        }
+    }
+
+    printf("%-18s %9.1f %9.1f %9.1f %9.1f %8d %8.0f\n", name,
+           nominal.SUM / nominal.COUNT, bench_errorJitter(&nominal),
+           fitted.SUM / fitted.COUNT, bench_errorJitter(&fitted),
+           (int)mpu6050_tsDriftPpm(&ts), truePpm);
+
+    if(fitted.SUM / fitted.COUNT > 0.2 * periodUs || fitted.SUM / fitted.COUNT < -0.2 * periodUs)
+        return 1;
+    if(bench_errorJitter(&fitted) > 0.2 * periodUs)
+        return 1;
+    if(mpu6050_tsDriftPpm(&ts) - truePpm > 100 || truePpm - mpu6050_tsDriftPpm(&ts) > 100)
+        return 1;
+    return 0;
+}
+
+int main(void)
+{
+    tMPU6050_FIFO_EN fifoEn = { 0 };
+    tMPU6050_USER_CTRL ctrl = { 0 };
+    unsigned int errors = 0;
+
+    sim_initialization(&sim, MPU6050_I2C_ADDR);
+    sim.i32ClockPpm = BENCH_CLOCK_PPM;
+    sim_sourceSet(&sim, bench_source, 0);
+    mpu6050_devInitialization(&dev, &sim.transport, MPU6050_I2C_ADDR);
+
+    // wake up, DLPF 44Hz -> 1kHz sample rate, all motion data into the FIFO
+    mpu6050_busWrite(&dev, MPU6050_CONFIG, 0x03);
+    mpu6050_busWrite(&dev, MPU6050_PWR_MGMT_1, 0x00);
+    fifoEn.ACCEL_FIFO_EN = fifoEn.TEMP_FIFO_EN = true;
+    fifoEn.XG_FIFO_EN = fifoEn.YG_FIFO_EN = fifoEn.ZG_FIFO_EN = true;
+    mpu6050_fifoEnWriteReg(&dev, &fifoEn);
+    ctrl.FIFO_EN = true;
+    mpu6050_userCtrlWriteReg(&dev, &ctrl);
+
+    mpu6050_tsInitialization(&ts, &dev, bench_clock, 1000000);
+
+    printf("                   nominal timestamps  fitted timestamps   clock error ppm\n");
+    printf("phase               mean us jitter us   mean us jitter us   fitted     true\n");
+    errors += bench_phase("start");
+
+    sim_clockAdvance(&sim, (uint64_t)BENCH_STALL_US * 1000);
+    errors += bench_phase("after overflow");
+
+    printf("%u errors, %u overflows\n", errors, (unsigned)dev.FIFO_STATUS.OVERFLOWS);
+    return errors ? 1 : 0;
+}
@@ -0,0 +1,159 @@
+/*
+ * This file is part of the MPU6050-Library distribution (https://github.com/jmherzog-de/MPU6050-Library).
+ * Copyright (c) 2021 Jean-Marcel Herzog.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ *  \file bench_transport.c
+ *  \brief Bus cost of the library API
+ *  
+ *  Runs library calls against the simulated sensor and prints the number of
+ *  bus transactions, bytes and bus time of every call. The program exits with
+ *  a non-zero value if a call needs more transactions than its budget.
+ *  
+ *  The calls run in table order on one device handle, so later calls of
+ *  configuration registers are served from the shadow register cache.
+ *  
+ *  Build and run on a host computer:
+ *  
+ *      gcc -Ilib -Ihardware/Host bench/bench_transport.c lib/mpu6050_*.c hardware/Host/sim.c -o bench_transport
+ *      ./bench_transport
+ *  
+ *  \copyright Copyright 2021 Jean-Marcel Herzog. All rights reserved. This project is released under the GNU Public License.
+ */
+
+#include <stdio.h>
+#include "mpu6050.h"
+#include "sim.h"
+
+static tSIM_MPU6050 sim;
+static tMPU6050_DEV dev;
+
+static void call_accelReadReg(void)     { tMPU6050_ACCEL obj; mpu6050_accelReadReg(&dev, &obj); }
+static void call_gyroReadReg(void)      { tMPU6050_GYRO obj; mpu6050_gyroReadReg(&dev, &obj); }
+static void call_tempOutReadReg(void)   { tMPU6050_TEMP obj; mpu6050_tempOutReadReg(&dev, &obj); }
+static void call_motionReadBurst(void)  { tMPU6050_MOTION obj; mpu6050_motionReadBurst(&dev, &obj); }
+static void call_fifoCountReadReg(void) { tMPU6050_FIFO_COUNT obj; mpu6050_fifoCountReadReg(&dev, &obj); }
+static void call_intStatusReadReg(void) { tMPU6050_INT_STATUS obj; mpu6050_intStatusReadReg(&dev, &obj); }
+static void call_configRegRead(void)    { tMPU6050_CONFIG obj; mpu6050_configRegRead(&dev, &obj); }
+static void call_whoAmIReadReg(void)    { tMPU6050_WHO_AM_I obj; mpu6050_whoAmIReadReg(&dev, &obj); }
+static void call_i2cSlv0ReadReg(void)   { tMPU6050_I2C_SLV0 obj; mpu6050_i2cSlv0ReadReg(&dev, &obj); }
+static void call_i2cSlv0WriteReg(void)  { tMPU6050_I2C_SLV0 obj = { 0 }; mpu6050_i2cSlv0WriteReg(&dev, &obj); }
+static void call_dlpfCfgWrite(void)     { mpu6050_shadowFieldWrite(&dev, MPU6050_FIELD_DLPF_CFG, 3); }
+static void call_stbyXgWrite(void)      { mpu6050_shadowFieldWrite(&dev, MPU6050_FIELD_STBY_XG, 1); }
+
+/** Register settings of a typical device bring-up */
+static const uint8_t bringUp[][2] =
+{
+    { MPU6050_SMPRT_DIV,    0x07 },
+    { MPU6050_CONFIG,       0x03 },
+    { MPU6050_GYRO_CONFIG,  0x08 },
+    { MPU6050_ACCEL_CONFIG, 0x08 },
+    { MPU6050_FIFO_EN,      0x78 },
+    { MPU6050_INT_PIN_CFG,  0x30 },
+    { MPU6050_INT_ENABLE,   0x01 },
+    { MPU6050_USER_CTRL,    0x40 },
+    { MPU6050_PWR_MGMT_2,   0x00 },
+};
+
+static void call_bringUp(void)
+{
+    unsigned int i;
+
+    mpu6050_shadowInvalidate(&dev);
+    for(i = 0; i < sizeof(bringUp) / sizeof(bringUp[0]); i++)
+        mpu6050_busWrite(&dev, bringUp[i][0], bringUp[i][1]);
+}
+
+static void call_bringUpBatch(void)
+{
+    tMPU6050_BATCH batch;
+
+    mpu6050_batchBegin(&dev, &batch);
+    call_bringUp();
+    mpu6050_batchCommit(&dev);
+}
+
+static tMPU6050_SNAPSHOT snapshot;
+
+static void call_snapshot(void)         { mpu6050_snapshot(&dev, &snapshot); }
+static void call_restore(void)          { mpu6050_restore(&dev, &snapshot); }
+
+static void call_brownOutRestore(void)
+{
+    // the sensor returns to its reset values
+    sim_reset(&sim);
+    mpu6050_shadowInvalidate(&dev);
+    mpu6050_restore(&dev, &snapshot);
+}
+
+typedef struct
+{
+    const char *name;
+    void (*call)(void);
+    uint32_t budget;    /**< Maximum number of bus transactions */
+}
+tBENCH_ENTRY;
+
+static const tBENCH_ENTRY entries[] =
+{
+    { "mpu6050_accelReadReg",       call_accelReadReg,      1 },
+    { "mpu6050_gyroReadReg",        call_gyroReadReg,       1 },
+    { "mpu6050_tempOutReadReg",     call_tempOutReadReg,    2 },
+    { "mpu6050_motionReadBurst",    call_motionReadBurst,   1 },
+    { "mpu6050_fifoCountReadReg",   call_fifoCountReadReg,  2 },
+    { "mpu6050_intStatusReadReg",   call_intStatusReadReg,  1 },
+    { "mpu6050_configRegRead",      call_configRegRead,     1 },
+    { "mpu6050_whoAmIReadReg",      call_whoAmIReadReg,     1 },
+    { "mpu6050_i2cSlv0WriteReg",    call_i2cSlv0WriteReg,   1 },
+    { "mpu6050_i2cSlv0ReadReg",     call_i2cSlv0ReadReg,    0 },
+    { "mpu6050_configRegRead",      call_configRegRead,     0 },
+    { "DLPF_CFG = 3",               call_dlpfCfgWrite,      1 },
+    { "DLPF_CFG = 3 (unchanged)",   call_dlpfCfgWrite,      0 },
+    { "STBY_XG = 1",                call_stbyXgWrite,       2 },
+    { "STBY_XG = 1 (unchanged)",    call_stbyXgWrite,       0 },
+    { "bring-up",                   call_bringUp,           9 },
+    { "bring-up (batch)",           call_bringUpBatch,      5 },
+    { "mpu6050_snapshot",           call_snapshot,          2 },
+    { "mpu6050_restore (unchanged)", call_restore,          0 },
+    { "mpu6050_restore (brown-out)", call_brownOutRestore,  5 },
+};
+
+int main(void)
+{
+    unsigned int i;
+    int failed = 0;
+
+    sim_initialization(&sim, MPU6050_I2C_ADDR);
+    mpu6050_devInitialization(&dev, &sim.transport, MPU6050_I2C_ADDR);
+
+    printf("%-28s %6s %6s %6s %10s\n", "call", "trans", "read", "write", "bus [us]");
+
+    for(i = 0; i < sizeof(entries) / sizeof(entries[0]); i++)
+    {
+        sim_statsReset(&sim);
+        entries[i].call();
+
+        printf("%-28s %6u %6u %6u %10.1f%s\n", entries[i].name,
+               (unsigned)sim.stats.TRANSACTIONS, (unsigned)sim.stats.BYTES_READ,
+               (unsigned)sim.stats.BYTES_WRITTEN, sim.stats.BUS_TIME_NS / 1000.0,
+               sim.stats.TRANSACTIONS > entries[i].budget ? "  OVER BUDGET" : "");
+
+        if(sim.stats.TRANSACTIONS > entries[i].budget)
+            failed = 1;
+    }
+
+    return failed;
+}
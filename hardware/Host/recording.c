@@ -0,0 +1,646 @@
+/*
+ * This file is part of the MPU6050-Library distribution (https://github.com/jmherzog-de/MPU6050-Library).
+ * Copyright (c) 2021 Jean-Marcel Herzog.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ *  \file recording.c
+ *  \brief Sample Recording
+ *  
+ *  Binary file format for long recordings on a host computer (POSIX).
+ *  
+ *  | Offset                        | Content                                      |
+ *  |:-----------------------------:|:--------------------------------------------:|
+ *  | 0                             | tRECORDING_HEADER with the device settings   |
+ *  | HEADER_SIZE + n * BLOCK_SIZE  | Block n                                      |
+ *  | INDEX_OFFSET                  | tRECORDING_INDEX of every block              |
+ *  
+ *  A block holds up to BLOCK_SAMPLES samples: a tRECORDING_BLOCK header, the
+ *  sample times in microseconds after the first sample and every channel
+ *  as an array of int16_t. Blocks have a fixed size, the last block and a
+ *  block before a pause of more than 71 minutes may be incomplete. All
+ *  values are stored in the byte order of the host (the ENDIAN field
+ *  tells), which lets a reader work on the mapped file without copying:
+ *  recording_blockChannel() returns a pointer into the file.
+ *  
+ *  The writer collects RECORDING_WRITE_BLOCKS blocks (4096 samples) for one
+ *  write() and writes the index and the final header when it is closed. A
+ *  recording that was not closed (crash, power loss) is still readable up
+ *  to the last complete write: the reader then builds the index from the
+ *  block headers.
+ *  
+ *  Seeking to a time takes constant time for a constant sample rate: the
+ *  reader divides the recording into time buckets of about one block and
+ *  keeps the last block starting in each bucket, followed by a binary
+ *  search over the at most BLOCK_SAMPLES sample times of the block.
+ *  
+ *  \copyright Copyright 2021 Jean-Marcel Herzog. All rights reserved. This project is released under the GNU Public License.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "recording.h"
+
+/** Longest time from the first to the last sample of a block */
+#define RECORDING_BLOCK_SPAN_NS     ((int64_t)UINT32_MAX * 1000)
+
+/**
+ *  \brief Settings of the device for the file header
+ *  
+ *  \param [in] dev Device
+ *  \param [in] i64StartNs Start of the recording, e.g. wall clock time
+ *  \param [in] config Returns the settings
+ */
+void recording_configGet(tMPU6050_DEV *dev, int64_t i64StartNs, tRECORDING_CONFIG *config)
+{
+    tMPU6050_ODR_PLAN plan;
+
+    mpu6050_odrGet(dev, &plan);
+
+    memset(config, 0, sizeof(*config));
+    config->AFS_SEL = dev->AFS_SEL;
+    config->FS_SEL = dev->FS_SEL;
+    config->DLPF_CFG = plan.DLPF_CFG;
+    config->SMPLRT_DIV = plan.SMPLRT_DIV;
+    config->FIFO_EN = dev->FIFO_LAYOUT.EN.RAW;
+    config->PERIOD_NS = plan.PERIOD_NS;
+    config->ACCEL_SENS = dev->ACCEL_SENS;
+    config->GYRO_SENS = dev->GYRO_SENS;
+    config->ACCEL_SCALE = dev->ACCEL_SCALE;
+    config->GYRO_SCALE = dev->GYRO_SCALE;
+    config->START_NS = i64StartNs;
+}
+
+/**
+ *  \brief write() all bytes
+ */
+static bool recording_write(tRECORDING_WRITER *w, const void *pData, size_t size, off_t offset)
+{
+    const uint8_t *p = pData;
+
+    while(size)
+    {
+        ssize_t n = (offset < 0) ? write(w->fd, p, size) : pwrite(w->fd, p, size, offset);
+
+        if(n < 0 && errno == EINTR)
+            continue;
+        if(n <= 0)
+        {
+            w->ERROR = true;
+            return false;
+        }
+        w->WRITES++;
+        p += n;
+        size -= (size_t)n;
+        if(offset >= 0)
+            offset += n;
+    }
+    return true;
+}
+
+/** Block being filled */
+static tRECORDING_BLOCK *recording_writerBlock(tRECORDING_WRITER *w)
+{
+    return (tRECORDING_BLOCK*)(w->buffer + (size_t)w->BUFFERED * w->HEADER.BLOCK_SIZE);
+}
+
+/**
+ *  \brief Complete the block being filled, write the buffer when it is full
+ */
+static bool recording_blockEnd(tRECORDING_WRITER *w)
+{
+    tRECORDING_BLOCK *block = recording_writerBlock(w);
+
+    if(w->HEADER.BLOCKS == w->INDEX_SIZE)
+    {
+        uint64_t size = w->INDEX_SIZE ? 2 * w->INDEX_SIZE : 1024;
+        tRECORDING_INDEX *index = realloc(w->index, size * sizeof(tRECORDING_INDEX));
+
+        if(!index)
+        {
+            w->ERROR = true;
+            return false;
+        }
+        w->index = index;
+        w->INDEX_SIZE = size;
+    }
+    w->index[w->HEADER.BLOCKS].T0_NS = block->T0_NS;
+    w->index[w->HEADER.BLOCKS].FIRST = block->FIRST;
+    w->HEADER.BLOCKS++;
+
+    if(++w->BUFFERED == RECORDING_WRITE_BLOCKS)
+        return recording_writerFlush(w);
+    recording_writerBlock(w)->COUNT = 0;
+    return true;
+}
+
+/**
+ *  \brief Create a recording
+ *  
+ *  \param [in] w Writer
+ *  \param [in] pcPath File name, an existing file is replaced
+ *  \param [in] config Device settings, see recording_configGet()
+ *  \return false if the file cannot be created
+ */
+bool recording_writerOpen(tRECORDING_WRITER *w, const char *pcPath, const tRECORDING_CONFIG *config)
+{
+    memset(w, 0, sizeof(*w));
+    memcpy(w->HEADER.MAGIC, RECORDING_MAGIC, sizeof(w->HEADER.MAGIC));
+    w->HEADER.ENDIAN = RECORDING_BYTE_ORDER;
+    w->HEADER.VERSION = RECORDING_VERSION;
+    w->HEADER.HEADER_SIZE = sizeof(tRECORDING_HEADER);
+    w->HEADER.BLOCK_SAMPLES = RECORDING_BLOCK_SAMPLES;
+    w->HEADER.BLOCK_SIZE = RECORDING_BLOCK_SIZE(RECORDING_BLOCK_SAMPLES);
+    w->HEADER.CONFIG = *config;
+
+    w->buffer = calloc(RECORDING_WRITE_BLOCKS, w->HEADER.BLOCK_SIZE);
+    if(!w->buffer)
+        return false;
+
+    w->fd = open(pcPath, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if(w->fd < 0)
+    {
+        free(w->buffer);
+        w->buffer = 0;
+        return false;
+    }
+
+    // BLOCKS, SAMPLES and INDEX_OFFSET stay 0 in the file until the writer is closed
+    if(!recording_write(w, &w->HEADER, sizeof(w->HEADER), -1))
+    {
+        close(w->fd);
+        free(w->buffer);
+        w->buffer = 0;
+        return false;
+    }
+
+    return true;
+}
+
+/**
+ *  \brief Append samples
+ *  
+ *  \param [in] w Writer
+ *  \param [in] samples Samples
+ *  \param [in] pi64TimeNs Time of each sample, not decreasing
+ *  \param [in] ui32Count Number of samples
+ *  \return false if a time decreases or a write failed
+ *  
+ *  \details Copies the samples into the block buffer, writes only when
+ *  RECORDING_WRITE_BLOCKS blocks are complete.
+ */
+bool recording_writerAppend(tRECORDING_WRITER *w, const tMPU6050_MOTION *samples, const int64_t *pi64TimeNs, uint32_t ui32Count)
+{
+    const uint32_t n = w->HEADER.BLOCK_SAMPLES;
+    uint32_t i;
+
+    if(w->ERROR)
+        return false;
+
+    for(i = 0; i < ui32Count; i++)
+    {
+        tRECORDING_BLOCK *block = recording_writerBlock(w);
+        uint32_t *times = (uint32_t*)(block + 1);
+        int16_t *ch = (int16_t*)(times + n);
+        uint32_t k;
+
+        if(w->HEADER.SAMPLES && pi64TimeNs[i] < w->LAST_NS)
+            return false;
+
+        // a pause too long for the sample times ends the block early
+        if(block->COUNT && pi64TimeNs[i] - block->T0_NS > RECORDING_BLOCK_SPAN_NS)
+        {
+            if(!recording_blockEnd(w))
+                return false;
+            block = recording_writerBlock(w);
+            times = (uint32_t*)(block + 1);
+            ch = (int16_t*)(times + n);
+        }
+
+        if(block->COUNT == 0)
+        {
+            memset(block, 0, w->HEADER.BLOCK_SIZE);
+            block->T0_NS = pi64TimeNs[i];
+            block->FIRST = w->HEADER.SAMPLES;
+        }
+        block->LOST += w->LOST;
+        w->LOST = 0;
+
+        k = block->COUNT++;
+        times[k] = (uint32_t)((pi64TimeNs[i] - block->T0_NS) / 1000);
+        ch[RECORDING_CHANNEL_ACCEL_X * n + k] = samples[i].ACCEL.X;
+        ch[RECORDING_CHANNEL_ACCEL_Y * n + k] = samples[i].ACCEL.Y;
+        ch[RECORDING_CHANNEL_ACCEL_Z * n + k] = samples[i].ACCEL.Z;
+        ch[RECORDING_CHANNEL_TEMP * n + k] = samples[i].TEMP;
+        ch[RECORDING_CHANNEL_GYRO_X * n + k] = samples[i].GYRO.X;
+        ch[RECORDING_CHANNEL_GYRO_Y * n + k] = samples[i].GYRO.Y;
+        ch[RECORDING_CHANNEL_GYRO_Z * n + k] = samples[i].GYRO.Z;
+
+        w->HEADER.SAMPLES++;
+        w->LAST_NS = pi64TimeNs[i];
+
+        if(block->COUNT == n && !recording_blockEnd(w))
+            return false;
+    }
+
+    return true;
+}
+
+/**
+ *  \brief Note samples lost before the next sample
+ *  
+ *  \param [in] w Writer
+ *  \param [in] ui32Samples Number of samples lost, e.g. by a FIFO overflow
+ */
+void recording_writerLost(tRECORDING_WRITER *w, uint32_t ui32Samples)
+{
+    w->LOST += ui32Samples;
+}
+
+/**
+ *  \brief Write the complete blocks
+ *  
+ *  \param [in] w Writer
+ *  \return false if the write failed
+ *  
+ *  \details Samples of the incomplete block stay in the buffer. Calling
+ *  it regularly bounds the data lost by a crash.
+ */
+bool recording_writerFlush(tRECORDING_WRITER *w)
+{
+    if(w->ERROR)
+        return false;
+    if(w->BUFFERED == 0)
+        return true;
+
+    if(!recording_write(w, w->buffer, (size_t)w->BUFFERED * w->HEADER.BLOCK_SIZE, -1))
+        return false;
+
+    // move the incomplete block to the start of the buffer
+    if(w->BUFFERED < RECORDING_WRITE_BLOCKS && recording_writerBlock(w)->COUNT)
+        memmove(w->buffer, recording_writerBlock(w), w->HEADER.BLOCK_SIZE);
+    else
+        ((tRECORDING_BLOCK*)w->buffer)->COUNT = 0;
+    w->BUFFERED = 0;
+
+    return true;
+}
+
+/**
+ *  \brief Write the remaining samples, the block index and the header
+ *  
+ *  \param [in] w Writer
+ *  \return false if a write failed, the file holds the blocks written before
+ */
+bool recording_writerClose(tRECORDING_WRITER *w)
+{
+    bool ok = !w->ERROR;
+
+    if(ok && recording_writerBlock(w)->COUNT)
+        ok = recording_blockEnd(w);
+    if(ok)
+        ok = recording_writerFlush(w);
+    if(ok)
+    {
+        w->HEADER.INDEX_OFFSET = w->HEADER.HEADER_SIZE + w->HEADER.BLOCKS * w->HEADER.BLOCK_SIZE;
+        ok = recording_write(w, w->index, w->HEADER.BLOCKS * sizeof(tRECORDING_INDEX), -1)
+             && recording_write(w, &w->HEADER, sizeof(w->HEADER), 0);
+    }
+
+    if(close(w->fd) != 0)
+        ok = false;
+    free(w->buffer);
+    free(w->index);
+    w->buffer = 0;
+    w->index = 0;
+
+    return ok;
+}
+
+/**
+ *  \brief Time buckets for recording_seek()
+ */
+static bool recording_bucketsBuild(tRECORDING_READER *r)
+{
+    int64_t t0 = r->index[0].T0_NS;
+    int64_t span = r->index[r->BLOCKS - 1].T0_NS - t0;
+    uint64_t b = 0, k;
+
+    r->BUCKET_NS = (int64_t)r->header->CONFIG.PERIOD_NS * r->header->BLOCK_SAMPLES;
+    if(r->BUCKET_NS <= 0)
+        r->BUCKET_NS = span / (int64_t)r->BLOCKS + 1;
+    // long pauses would leave most buckets empty
+    if((uint64_t)(span / r->BUCKET_NS) > 4 * r->BLOCKS)
+        r->BUCKET_NS = span / (int64_t)(4 * r->BLOCKS) + 1;
+
+    r->BUCKETS = (uint64_t)(span / r->BUCKET_NS) + 1;
+    r->bucket = malloc(r->BUCKETS * sizeof(uint32_t));
+    if(!r->bucket)
+        return false;
+
+    for(k = 0; k < r->BUCKETS; k++)
+    {
+        int64_t end = t0 + (int64_t)(k + 1) * r->BUCKET_NS;
+
+        while(b + 1 < r->BLOCKS && r->index[b + 1].T0_NS < end)
+            b++;
+        r->bucket[k] = (uint32_t)b;
+    }
+    return true;
+}
+
+/**
+ *  \brief Check the block index against the block size
+ *  
+ *  \details The readers rely on it: block b holds the samples from its
+ *  FIRST up to the FIRST of the next block (SAMPLES for the last block),
+ *  at most BLOCK_SAMPLES of them, and the blocks start in time order.
+ */
+static bool recording_indexValid(const tRECORDING_READER *r)
+{
+    const uint32_t n = r->header->BLOCK_SAMPLES;
+    uint64_t b;
+
+    if(r->BLOCKS == 0)
+        return r->SAMPLES == 0;
+    if(r->index[0].FIRST != 0)
+        return false;
+    for(b = 0; b + 1 < r->BLOCKS; b++)
+    {
+        if(r->index[b + 1].FIRST < r->index[b].FIRST || r->index[b + 1].FIRST - r->index[b].FIRST > n
+            || r->index[b + 1].T0_NS < r->index[b].T0_NS)
+            return false;
+    }
+    return r->SAMPLES >= r->index[b].FIRST && r->SAMPLES - r->index[b].FIRST <= n;
+}
+
+/**
+ *  \brief Open a recording
+ *  
+ *  \param [in] r Reader
+ *  \param [in] pcPath File name
+ *  \return false if the file cannot be mapped, is no recording of this
+ *  version and byte order or its header and block index are inconsistent
+ */
+bool recording_open(tRECORDING_READER *r, const char *pcPath)
+{
+    const tRECORDING_HEADER *h;
+    struct stat st;
+    size_t end;
+    int fd;
+    void *map;
+
+    memset(r, 0, sizeof(*r));
+
+    fd = open(pcPath, O_RDONLY);
+    if(fd < 0)
+        return false;
+    if(fstat(fd, &st) != 0 || (size_t)st.st_size < sizeof(tRECORDING_HEADER))
+    {
+        close(fd);
+        return false;
+    }
+    map = mmap(0, (size_t)st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if(map == MAP_FAILED)
+        return false;
+
+    r->map = map;
+    r->SIZE = (size_t)st.st_size;
+    r->header = h = map;
+
+    if(memcmp(h->MAGIC, RECORDING_MAGIC, sizeof(h->MAGIC)) || h->ENDIAN != RECORDING_BYTE_ORDER
+        || h->VERSION != RECORDING_VERSION || h->HEADER_SIZE < sizeof(tRECORDING_HEADER)
+        || h->HEADER_SIZE > r->SIZE || h->BLOCK_SAMPLES == 0
+        || h->BLOCK_SIZE != RECORDING_BLOCK_SIZE(h->BLOCK_SAMPLES))
+    {
+        recording_close(r);
+        return false;
+    }
+
+    // closed: the blocks end where the index starts
+    end = r->SIZE;
+    if(h->INDEX_OFFSET)
+    {
+        if(h->INDEX_OFFSET < h->HEADER_SIZE || h->BLOCKS > (h->INDEX_OFFSET - h->HEADER_SIZE) / h->BLOCK_SIZE)
+        {
+            recording_close(r);
+            return false;
+        }
+        if(h->INDEX_OFFSET < end)
+            end = (size_t)h->INDEX_OFFSET;
+    }
+
+    if(h->INDEX_OFFSET && h->INDEX_OFFSET <= r->SIZE
+        && h->BLOCKS <= (r->SIZE - h->INDEX_OFFSET) / sizeof(tRECORDING_INDEX))
+    {
+        r->BLOCKS = h->BLOCKS;
+        r->SAMPLES = h->SAMPLES;
+        r->index = (const tRECORDING_INDEX*)(r->map + h->INDEX_OFFSET);
+    }
+    else
+    {
+        // not closed or index cut off: every complete block counts
+        uint64_t b;
+
+        r->BLOCKS = (end - h->HEADER_SIZE) / h->BLOCK_SIZE;
+        r->indexBuilt = malloc((r->BLOCKS ? r->BLOCKS : 1) * sizeof(tRECORDING_INDEX));
+        if(!r->indexBuilt)
+        {
+            recording_close(r);
+            return false;
+        }
+        for(b = 0; b < r->BLOCKS; b++)
+        {
+            const tRECORDING_BLOCK *block = recording_block(r, b);
+
+            if(block->COUNT > h->BLOCK_SAMPLES)
+            {
+                recording_close(r);
+                return false;
+            }
+            r->indexBuilt[b].T0_NS = block->T0_NS;
+            r->indexBuilt[b].FIRST = block->FIRST;
+            r->SAMPLES = block->FIRST + block->COUNT;
+        }
+        r->index = r->indexBuilt;
+    }
+
+    if(!recording_indexValid(r) || (r->BLOCKS && !recording_bucketsBuild(r)))
+    {
+        recording_close(r);
+        return false;
+    }
+
+    return true;
+}
+
+/**
+ *  \brief Close a recording
+ *  
+ *  \param [in] r Reader
+ */
+void recording_close(tRECORDING_READER *r)
+{
+    if(r->map)
+        munmap((void*)r->map, r->SIZE);
+    free(r->indexBuilt);
+    free(r->bucket);
+    memset(r, 0, sizeof(*r));
+}
+
+/**
+ *  \brief Block header
+ *  
+ *  \param [in] r Reader
+ *  \param [in] ui64Block Block number, less than BLOCKS
+ *  \return Block header in the mapped file
+ */
+const tRECORDING_BLOCK *recording_block(const tRECORDING_READER *r, uint64_t ui64Block)
+{
+    return (const tRECORDING_BLOCK*)(r->map + r->header->HEADER_SIZE + ui64Block * r->header->BLOCK_SIZE);
+}
+
+/**
+ *  \brief Sample times of a block
+ *  
+ *  \param [in] r Reader
+ *  \param [in] ui64Block Block number, less than BLOCKS
+ *  \return COUNT times in microseconds after T0_NS of the block, in the mapped file
+ */
+const uint32_t *recording_blockTimes(const tRECORDING_READER *r, uint64_t ui64Block)
+{
+    return (const uint32_t*)(recording_block(r, ui64Block) + 1);
+}
+
+/**
+ *  \brief Values of one channel of a block
+ *  
+ *  \param [in] r Reader
+ *  \param [in] ui64Block Block number, less than BLOCKS
+ *  \param [in] ui8Channel Channel (RECORDING_CHANNEL_x)
+ *  \return COUNT values in the mapped file
+ */
+const int16_t *recording_blockChannel(const tRECORDING_READER *r, uint64_t ui64Block, uint8_t ui8Channel)
+{
+    return (const int16_t*)(recording_blockTimes(r, ui64Block) + r->header->BLOCK_SAMPLES) + (size_t)ui8Channel * r->header->BLOCK_SAMPLES;
+}
+
+/**
+ *  \brief Block of a sample
+ *  
+ *  \param [in] r Reader
+ *  \param [in] ui64Sample Sample number, less than SAMPLES
+ *  \param [in] pui32Index Returns the position of the sample in the block
+ *  \return Block number
+ */
+uint64_t recording_sampleBlock(const tRECORDING_READER *r, uint64_t ui64Sample, uint32_t *pui32Index)
+{
+    uint64_t b = ui64Sample / r->header->BLOCK_SAMPLES;
+
+    // incomplete blocks move samples to later blocks
+    if(b >= r->BLOCKS)
+        b = r->BLOCKS - 1;
+    while(b + 1 < r->BLOCKS && r->index[b + 1].FIRST <= ui64Sample)
+        b++;
+
+    *pui32Index = (uint32_t)(ui64Sample - r->index[b].FIRST);
+    return b;
+}
+
+/**
+ *  \brief Time of a sample
+ *  
+ *  \param [in] r Reader
+ *  \param [in] ui64Sample Sample number, less than SAMPLES
+ *  \return Time in ns
+ */
+int64_t recording_sampleTime(const tRECORDING_READER *r, uint64_t ui64Sample)
+{
+    uint32_t i;
+    uint64_t b = recording_sampleBlock(r, ui64Sample, &i);
+
+    return r->index[b].T0_NS + (int64_t)recording_blockTimes(r, b)[i] * 1000;
+}
+
+/**
+ *  \brief Copy of one sample
+ *  
+ *  \param [in] r Reader
+ *  \param [in] ui64Sample Sample number, less than SAMPLES
+ *  \param [in] sample Returns the sample
+ */
+void recording_sample(const tRECORDING_READER *r, uint64_t ui64Sample, tMPU6050_MOTION *sample)
+{
+    uint32_t i;
+    uint64_t b = recording_sampleBlock(r, ui64Sample, &i);
+    const int16_t *ch = recording_blockChannel(r, b, 0);
+    const uint32_t n = r->header->BLOCK_SAMPLES;
+
+    sample->ACCEL.X = ch[RECORDING_CHANNEL_ACCEL_X * n + i];
+    sample->ACCEL.Y = ch[RECORDING_CHANNEL_ACCEL_Y * n + i];
+    sample->ACCEL.Z = ch[RECORDING_CHANNEL_ACCEL_Z * n + i];
+    sample->TEMP = ch[RECORDING_CHANNEL_TEMP * n + i];
+    sample->GYRO.X = ch[RECORDING_CHANNEL_GYRO_X * n + i];
+    sample->GYRO.Y = ch[RECORDING_CHANNEL_GYRO_Y * n + i];
+    sample->GYRO.Z = ch[RECORDING_CHANNEL_GYRO_Z * n + i];
+}
+
+/**
+ *  \brief First sample at or after a time
+ *  
+ *  \param [in] r Reader
+ *  \param [in] i64TimeNs Time
+ *  \return Sample number, SAMPLES if all samples are earlier
+ */
+uint64_t recording_seek(const tRECORDING_READER *r, int64_t i64TimeNs)
+{
+    const uint32_t *times;
+    int64_t offset;
+    uint64_t b, k;
+    uint32_t lo, hi;
+
+    if(r->BLOCKS == 0 || i64TimeNs <= r->index[0].T0_NS)
+        return 0;
+
+    k = (uint64_t)((i64TimeNs - r->index[0].T0_NS) / r->BUCKET_NS);
+    b = (k < r->BUCKETS) ? r->bucket[k] : r->BLOCKS - 1;
+    while(b > 0 && r->index[b].T0_NS >= i64TimeNs)
+        b--;
+    while(b + 1 < r->BLOCKS && r->index[b + 1].T0_NS < i64TimeNs)
+        b++;
+
+    // first sample of block b at or after the time, the index bounds the count
+    times = recording_blockTimes(r, b);
+    offset = i64TimeNs - r->index[b].T0_NS;
+    lo = 0;
+    hi = (uint32_t)(((b + 1 < r->BLOCKS) ? r->index[b + 1].FIRST : r->SAMPLES) - r->index[b].FIRST);
+    while(lo < hi)
+    {
+        uint32_t mid = (lo + hi) / 2;
+
+        if((int64_t)times[mid] * 1000 < offset)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+
+    return r->index[b].FIRST + lo;
+}
@@ -0,0 +1,175 @@
+/*
+ * This file is part of the MPU6050-Library distribution (https://github.com/jmherzog-de/MPU6050-Library).
+ * Copyright (c) 2021 Jean-Marcel Herzog.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ *  \file recording.h
+ *  \brief Sample Recording headerfile
+ *  \copyright Copyright 2021 Jean-Marcel Herzog. All rights reserved. This project is released under the GNU Public License.
+ */
+
+#ifndef RECORDING_H_
+#define RECORDING_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "mpu6050.h"
+
+#define RECORDING_MAGIC             "MPU6050R"
+#define RECORDING_VERSION           1
+#define RECORDING_BYTE_ORDER        0x01020304u     /**< Reads differently on a host of the other byte order */
+
+#ifndef RECORDING_BLOCK_SAMPLES
+#define RECORDING_BLOCK_SAMPLES     256     /**< Samples per block of new recordings, a multiple of 4 */
+#endif
+
+#ifndef RECORDING_WRITE_BLOCKS
+#define RECORDING_WRITE_BLOCKS      16      /**< Blocks the writer collects for one write() */
+#endif
+
+#define RECORDING_CHANNELS          7       /**< accel x,y,z, temperature, gyro x,y,z */
+#define RECORDING_CHANNEL_ACCEL_X   0
+#define RECORDING_CHANNEL_ACCEL_Y   1
+#define RECORDING_CHANNEL_ACCEL_Z   2
+#define RECORDING_CHANNEL_TEMP      3
+#define RECORDING_CHANNEL_GYRO_X    4
+#define RECORDING_CHANNEL_GYRO_Y    5
+#define RECORDING_CHANNEL_GYRO_Z    6
+
+/** Bytes of a block of ui32Samples samples */
+#define RECORDING_BLOCK_SIZE(ui32Samples)   (sizeof(tRECORDING_BLOCK) + (ui32Samples) * (sizeof(uint32_t) + RECORDING_CHANNELS * sizeof(int16_t)))
+
+/**
+ *  \brief Device configuration at the start of a recording
+ */
+typedef struct
+{
+    uint8_t AFS_SEL;            /**< Accelerometer full scale range */
+    uint8_t FS_SEL;             /**< Gyroscope full scale range */
+    uint8_t DLPF_CFG;           /**< Digital low pass filter setting */
+    uint8_t SMPLRT_DIV;         /**< Sample Rate Divider */
+    uint8_t FIFO_EN;            /**< FIFO Enable register value */
+    uint8_t RESERVED[3];        /**< 0 */
+    uint32_t PERIOD_NS;         /**< Nominal sample period */
+    uint16_t ACCEL_SENS;        /**< Accelerometer sensitivity in LSB/g */
+    uint16_t RESERVED2;         /**< 0 */
+    float GYRO_SENS;            /**< Gyroscope sensitivity in LSB/(deg/s) */
+    float ACCEL_SCALE;          /**< Accelerometer scale in (m/s^2)/LSB */
+    float GYRO_SCALE;           /**< Gyroscope scale in (rad/s)/LSB */
+    int64_t START_NS;           /**< Start of the recording, e.g. wall clock time; informational */
+}
+tRECORDING_CONFIG;
+
+/**
+ *  \brief File header
+ */
+typedef struct
+{
+    char MAGIC[8];              /**< RECORDING_MAGIC without terminating zero */
+    uint32_t ENDIAN;            /**< RECORDING_BYTE_ORDER */
+    uint16_t VERSION;           /**< RECORDING_VERSION */
+    uint16_t HEADER_SIZE;       /**< Offset of the first block */
+    uint32_t BLOCK_SAMPLES;     /**< Samples per block */
+    uint32_t BLOCK_SIZE;        /**< Bytes per block */
+    tRECORDING_CONFIG CONFIG;   /**< Device configuration */
+    uint64_t BLOCKS;            /**< Number of blocks, 0 until the writer is closed */
+    uint64_t SAMPLES;           /**< Number of samples, 0 until the writer is closed */
+    uint64_t INDEX_OFFSET;      /**< Offset of the block index, 0 until the writer is closed */
+}
+tRECORDING_HEADER;
+
+/**
+ *  \brief Block header
+ *  
+ *  Followed by BLOCK_SAMPLES sample times (uint32_t, microseconds after
+ *  T0_NS) and BLOCK_SAMPLES values of each channel (int16_t), channel by
+ *  channel.
+ */
+typedef struct
+{
+    int64_t T0_NS;              /**< Time of the first sample */
+    uint64_t FIRST;             /**< Number of the first sample in the recording */
+    uint32_t COUNT;             /**< Number of samples, less than BLOCK_SAMPLES in the last block or before a long pause */
+    uint32_t LOST;              /**< Samples lost (e.g. FIFO overflows) before or within the block */
+}
+tRECORDING_BLOCK;
+
+/**
+ *  \brief Block index entry
+ */
+typedef struct
+{
+    int64_t T0_NS;              /**< Time of the first sample of the block */
+    uint64_t FIRST;             /**< Number of the first sample of the block */
+}
+tRECORDING_INDEX;
+
+/**
+ *  \brief Recording writer
+ */
+typedef struct
+{
+    int fd;                         /**< File */
+    tRECORDING_HEADER HEADER;       /**< File header */
+    uint8_t *buffer;                /**< RECORDING_WRITE_BLOCKS blocks */
+    uint32_t BUFFERED;              /**< Complete blocks in the buffer */
+    tRECORDING_INDEX *index;        /**< Block index */
+    uint64_t INDEX_SIZE;            /**< Entries the index can hold */
+    int64_t LAST_NS;                /**< Time of the last sample */
+    uint32_t LOST;                  /**< Samples lost since the last sample */
+    uint64_t WRITES;                /**< Number of write() calls */
+    bool ERROR;                     /**< A write failed */
+}
+tRECORDING_WRITER;
+
+/**
+ *  \brief Memory mapped recording
+ */
+typedef struct
+{
+    const uint8_t *map;             /**< File contents */
+    size_t SIZE;                    /**< File size */
+    const tRECORDING_HEADER *header;/**< File header */
+    const tRECORDING_INDEX *index;  /**< Block index */
+    tRECORDING_INDEX *indexBuilt;   /**< Block index built from the blocks of a recording that was not closed */
+    uint64_t BLOCKS;                /**< Number of blocks */
+    uint64_t SAMPLES;               /**< Number of samples */
+    uint32_t *bucket;               /**< Per time bucket: last block that starts before the end of the bucket */
+    uint64_t BUCKETS;               /**< Number of time buckets */
+    int64_t BUCKET_NS;              /**< Duration of a time bucket */
+}
+tRECORDING_READER;
+
+extern void recording_configGet(tMPU6050_DEV*, int64_t i64StartNs, tRECORDING_CONFIG *config);
+
+extern bool recording_writerOpen(tRECORDING_WRITER*, const char *pcPath, const tRECORDING_CONFIG *config);
+extern bool recording_writerAppend(tRECORDING_WRITER*, const tMPU6050_MOTION *samples, const int64_t *pi64TimeNs, uint32_t ui32Count);
+extern void recording_writerLost(tRECORDING_WRITER*, uint32_t ui32Samples);
+extern bool recording_writerFlush(tRECORDING_WRITER*);
+extern bool recording_writerClose(tRECORDING_WRITER*);
+
+extern bool recording_open(tRECORDING_READER*, const char *pcPath);
+extern void recording_close(tRECORDING_READER*);
+extern const tRECORDING_BLOCK *recording_block(const tRECORDING_READER*, uint64_t ui64Block);
+extern const uint32_t *recording_blockTimes(const tRECORDING_READER*, uint64_t ui64Block);
+extern const int16_t *recording_blockChannel(const tRECORDING_READER*, uint64_t ui64Block, uint8_t ui8Channel);
+extern uint64_t recording_sampleBlock(const tRECORDING_READER*, uint64_t ui64Sample, uint32_t *pui32Index);
+extern int64_t recording_sampleTime(const tRECORDING_READER*, uint64_t ui64Sample);
+extern void recording_sample(const tRECORDING_READER*, uint64_t ui64Sample, tMPU6050_MOTION *sample);
+extern uint64_t recording_seek(const tRECORDING_READER*, int64_t i64TimeNs);
+
+#endif
@@ -0,0 +1,242 @@
+/*
+ * This file is part of the MPU6050-Library distribution (https://github.com/jmherzog-de/MPU6050-Library).
+ * Copyright (c) 2021 Jean-Marcel Herzog.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ *  \file replay.c
+ *  \brief Recording Replay
+ *  
+ *  Feeds a recording (see recording.c) through the unchanged library on a
+ *  host computer. The simulated sensor of sim.c takes the recorded samples
+ *  in order as its data source, so every register access of the library is
+ *  answered by the register model: the measurement registers read by
+ *  mpu6050_accelReadReg() and mpu6050_gyroReadReg() hold the latest
+ *  sample, mpu6050_fifoCountReadReg() and mpu6050_fifoRwReadReg() see the
+ *  FIFO filled with the recorded frames, including overflows when the
+ *  application drains too late.
+ *  
+ *  The sensor runs at the Sample Rate of the recorded settings with the
+ *  clock error measured from the recorded sample times. Losses and pauses
+ *  of the recording are closed, the samples follow each other without gap.
+ *  The time is the virtual time of the simulation, so a replay gives the
+ *  same samples at the same virtual times on every run and on every host.
+ *  
+ *  The wall clock only matters for pacing. REPLAY_UNPACED runs as fast as
+ *  the application loop allows: sim_clockAdvance() replaces the sleep of
+ *  the application and returns at once. With a speed factor each sample
+ *  waits for its wall clock time, REPLAY_REALTIME reproduces the timing of
+ *  the recording and a factor of 10 runs ten times faster. LATE counts the
+ *  samples the application could not keep up with.
+ *  
+ *  \copyright Copyright 2021 Jean-Marcel Herzog. All rights reserved. This project is released under the GNU Public License.
+ */
+
+#include <string.h>
+#include <time.h>
+#include "replay.h"
+
+/** Block pairs used to measure the clock error of a recording */
+#define REPLAY_PPM_PAIRS    1024
+
+/**
+ *  \brief Monotonic wall clock
+ *  
+ *  \return Time in ns
+ */
+uint64_t replay_wallClockNs(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000 + (uint64_t)ts.tv_nsec;
+}
+
+/**
+ *  \brief Clock error of the recorded sensor
+ *  
+ *  \return Deviation of the sample rate from the recorded nominal rate in ppm
+ *  
+ *  \details Compares the duration of consecutive complete blocks without
+ *  loss with the nominal period. At most REPLAY_PPM_PAIRS block pairs
+ *  spread over the recording are used, which keeps the initialization of
+ *  long recordings short.
+ */
+static int32_t replay_clockPpm(const tRECORDING_READER *rec)
+{
+    const uint32_t n = rec->header->BLOCK_SAMPLES;
+    const double nominal = (double)rec->header->CONFIG.PERIOD_NS * n;
+    uint64_t step = rec->BLOCKS / REPLAY_PPM_PAIRS + 1;
+    uint64_t b, pairs = 0;
+    double duration = 0;
+
+    if(nominal <= 0)
+        return 0;
+
+    for(b = 0; b + 1 < rec->BLOCKS; b += step)
+    {
+        int64_t d = rec->index[b + 1].T0_NS - rec->index[b].T0_NS;
+
+        // pauses and losses do not count
+        if(rec->index[b + 1].FIRST - rec->index[b].FIRST != n || recording_block(rec, b + 1)->LOST
+            || d <= 0 || (double)d > 1.1 * nominal || (double)d < 0.9 * nominal)
+            continue;
+        duration += (double)d;
+        pairs++;
+    }
+
+    return pairs ? (int32_t)((nominal * pairs / duration - 1.0) * 1e6) : 0;
+}
+
+/**
+ *  \brief Data source of the simulated sensor
+ */
+static void replay_source(void *arg, uint64_t ui64TimeNs, int16_t *pi16Data)
+{
+    tREPLAY *rp = arg;
+    tMPU6050_MOTION sample;
+
+    if(rp->NEXT >= rp->rec->SAMPLES && rp->LOOP)
+        rp->NEXT = 0;
+
+    if(rp->NEXT < rp->rec->SAMPLES)
+    {
+        recording_sample(rp->rec, rp->NEXT++, &sample);
+        rp->DELIVERED++;
+        rp->END = false;
+    }
+    else
+    {
+        // hold the last sample
+        if(rp->rec->SAMPLES)
+            recording_sample(rp->rec, rp->rec->SAMPLES - 1, &sample);
+        else
+            memset(&sample, 0, sizeof(sample));
+        rp->END = true;
+    }
+
+    pi16Data[0] = sample.ACCEL.X;
+    pi16Data[1] = sample.ACCEL.Y;
+    pi16Data[2] = sample.ACCEL.Z;
+    pi16Data[3] = sample.TEMP;
+    pi16Data[4] = sample.GYRO.X;
+    pi16Data[5] = sample.GYRO.Y;
+    pi16Data[6] = sample.GYRO.Z;
+
+    if(rp->SPEED != REPLAY_UNPACED)
+    {
+        uint64_t due = rp->WALL_START_NS + (ui64TimeNs - rp->SIM_START_NS) / rp->SPEED;
+        uint64_t now = replay_wallClockNs();
+
+        if(now < due)
+        {
+            struct timespec ts;
+
+            ts.tv_sec = (time_t)(due / 1000000000);
+            ts.tv_nsec = (long)(due % 1000000000);
+            while(clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, 0) != 0)
+                ;
+        }
+        else if(now - due > sim_samplePeriodNs(&rp->sim) / rp->SPEED)
+        {
+            rp->LATE++;
+        }
+    }
+}
+
+/**
+ *  \brief Replay initialization
+ *  
+ *  \param [in] rp Replay
+ *  \param [in] rec Open recording, must stay open during the replay
+ *  \param [in] ui8SlaveAddr I2C slave address the sensor answers to
+ *  
+ *  \details The replay starts at the first sample, unpaced. The simulated
+ *  sensor is in its reset state, see replay_devInitialization().
+ */
+void replay_initialization(tREPLAY *rp, const tRECORDING_READER *rec, uint8_t ui8SlaveAddr)
+{
+    memset(rp, 0, sizeof(*rp));
+    rp->rec = rec;
+    sim_initialization(&rp->sim, ui8SlaveAddr);
+    sim_sourceSet(&rp->sim, replay_source, rp);
+    rp->sim.i32ClockPpm = replay_clockPpm(rec);
+}
+
+/**
+ *  \brief Set up a device handle and the sensor as recorded
+ *  
+ *  \param [in] rp Replay
+ *  \param [in] dev Device handle to connect to the replay
+ *  
+ *  \details Writes the recorded Sample Rate, DLPF, full scale ranges and
+ *  FIFO sources through the library, wakes the sensor up and enables the
+ *  FIFO if the recording used it. An application with its own setup code
+ *  calls mpu6050_devInitialization() with the transport of the replay
+ *  instead.
+ */
+void replay_devInitialization(tREPLAY *rp, tMPU6050_DEV *dev)
+{
+    const tRECORDING_CONFIG *config = &rp->rec->header->CONFIG;
+    tMPU6050_FIFO_EN fifoEn;
+    tMPU6050_USER_CTRL ctrl = { 0 };
+
+    mpu6050_devInitialization(dev, &rp->sim.transport, rp->sim.ui8SlaveAddr);
+
+    mpu6050_busWrite(dev, MPU6050_SMPRT_DIV, config->SMPLRT_DIV);
+    mpu6050_busWrite(dev, MPU6050_CONFIG, config->DLPF_CFG & 0x07);
+    mpu6050_busWrite(dev, MPU6050_ACCEL_CONFIG, (uint8_t)((config->AFS_SEL & 0x03) << 3));
+    mpu6050_busWrite(dev, MPU6050_GYRO_CONFIG, (uint8_t)((config->FS_SEL & 0x03) << 3));
+    mpu6050_busWrite(dev, MPU6050_PWR_MGMT_1, 0x00);
+
+    fifoEn.RAW = config->FIFO_EN;
+    mpu6050_fifoEnWriteReg(dev, &fifoEn);
+    if(fifoEn.RAW)
+    {
+        ctrl.FIFO_EN = true;
+        mpu6050_userCtrlWriteReg(dev, &ctrl);
+    }
+}
+
+/**
+ *  \brief Set the pacing
+ *  
+ *  \param [in] rp Replay
+ *  \param [in] ui32Speed REPLAY_UNPACED, REPLAY_REALTIME or a factor
+ *  
+ *  \details Pacing starts now at the current virtual time.
+ */
+void replay_paceSet(tREPLAY *rp, uint32_t ui32Speed)
+{
+    rp->SPEED = ui32Speed;
+    rp->WALL_START_NS = replay_wallClockNs();
+    rp->SIM_START_NS = rp->sim.ui64TimeNs;
+    rp->LATE = 0;
+}
+
+/**
+ *  \brief Continue at a time of the recording
+ *  
+ *  \param [in] rp Replay
+ *  \param [in] i64TimeNs Time of the recording, see recording_seek()
+ *  
+ *  \details The next sample taken by the sensor is the first recorded
+ *  sample at or after the time. Samples already in the FIFO stay.
+ */
+void replay_seek(tREPLAY *rp, int64_t i64TimeNs)
+{
+    rp->NEXT = recording_seek(rp->rec, i64TimeNs);
+    rp->END = false;
+}
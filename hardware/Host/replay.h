@@ -0,0 +1,60 @@
+/*
+ * This file is part of the MPU6050-Library distribution (https://github.com/jmherzog-de/MPU6050-Library).
+ * Copyright (c) 2021 Jean-Marcel Herzog.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ *  \file replay.h
+ *  \brief Recording Replay headerfile
+ *  \copyright Copyright 2021 Jean-Marcel Herzog. All rights reserved. This project is released under the GNU Public License.
+ */
+
+#ifndef REPLAY_H_
+#define REPLAY_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "mpu6050.h"
+#include "sim.h"
+#include "recording.h"
+
+#define REPLAY_UNPACED      0       /**< Speed: as fast as possible */
+#define REPLAY_REALTIME     1       /**< Speed: one second of the recording per second */
+
+/**
+ *  \brief Replay of a recording
+ */
+typedef struct
+{
+    tSIM_MPU6050 sim;                   /**< Simulated sensor delivering the recorded samples, its transport answers the library */
+    const tRECORDING_READER *rec;       /**< Recording */
+    uint64_t NEXT;                      /**< Number of the next sample to deliver */
+    bool LOOP;                          /**< Start again at the end of the recording */
+    bool END;                           /**< All samples were delivered, the last one is held */
+    uint32_t SPEED;                     /**< Recording time per wall clock time, REPLAY_UNPACED or a factor */
+    uint64_t WALL_START_NS;             /**< Wall clock time at the start of the pacing */
+    uint64_t SIM_START_NS;              /**< Virtual time at the start of the pacing */
+    uint64_t DELIVERED;                 /**< Number of samples delivered */
+    uint32_t LATE;                      /**< Paced samples delivered more than one sample period late */
+}
+tREPLAY;
+
+extern void replay_initialization(tREPLAY*, const tRECORDING_READER *rec, uint8_t ui8SlaveAddr);
+extern void replay_devInitialization(tREPLAY*, tMPU6050_DEV *dev);
+extern void replay_paceSet(tREPLAY*, uint32_t ui32Speed);
+extern void replay_seek(tREPLAY*, int64_t i64TimeNs);
+extern uint64_t replay_wallClockNs(void);
+
+#endif
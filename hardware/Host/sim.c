@@ -0,0 +1,621 @@
+/*
+ * This file is part of the MPU6050-Library distribution (https://github.com/jmherzog-de/MPU6050-Library).
+ * Copyright (c) 2021 Jean-Marcel Herzog.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ *  \file sim.c
+ *  \brief Simulated MPU6050
+ *  
+ *  Register accurate model of the MPU6050 for host computers. It implements
+ *  the library transport interface, so the library runs unchanged against it.
+ *  
+ *  The model contains the register file from mpu6050_reg.h with its reset
+ *  values, the sample rate clock derived from SMPLRT_DIV and DLPF_CFG (with
+ *  an optional frequency error of the internal oscillator) and
+ *  the 1024 byte FIFO buffer including the overflow behaviour. Time is
+ *  virtual: it advances with every bus transaction (timed at the configured
+ *  bus clock) and with sim_clockAdvance().
+ *  
+ *  Every transaction is counted in the statistics, so the number of bus
+ *  transactions and bytes of an API call can be measured on a host.
+ *  
+ *  Asynchronous transfers are queued like in the interrupt driven Tiva
+ *  driver. They occupy the bus while the virtual time advances and complete
+ *  (register access and callback) at their end time. Blocking calls charge
+ *  the whole bus time to the CPU, asynchronous transfers one interrupt per
+ *  byte, so both driver models can be compared with CPU_BUSY_NS.
+ *  
+ *  The INT pin follows INT_STATUS and INT_ENABLE. With LATCH_INT_EN it
+ *  stays active until INT_STATUS is cleared, otherwise every interrupt is a
+ *  pulse (the 50us pulse width is not modelled). Every activation calls the
+ *  handler set with sim_intHandlerSet() and counts as one interrupt.
+ *  
+ *  \copyright Copyright 2021 Jean-Marcel Herzog. All rights reserved. This project is released under the GNU Public License.
+ */
+
+#include <string.h>
+#include "sim.h"
+
+#define SIM_PWR_MGMT_1_DEVICE_RESET     0x80
+#define SIM_PWR_MGMT_1_SLEEP            0x40
+#define SIM_USER_CTRL_FIFO_EN           0x40
+#define SIM_USER_CTRL_FIFO_RESET        0x04
+#define SIM_USER_CTRL_SIG_COND_RESET    0x01
+#define SIM_INT_PIN_CFG_LATCH_INT_EN    0x20
+#define SIM_INT_PIN_CFG_INT_RD_CLEAR    0x10
+#define SIM_INT_STATUS_FIFO_OFLOW       0x10
+#define SIM_INT_STATUS_DATA_RDY         0x01
+#define SIM_INT_SOURCES                 0x19
+
+/**
+ *  \brief Check if a register can not be written by the host
+ *  
+ *  \param [in] ui8Reg Register address
+ *  \return true if the register is read only
+ */
+static bool sim_regReadOnly(uint8_t ui8Reg)
+{
+    if(ui8Reg >= MPU6050_ACCEL_XOUT_H && ui8Reg <= MPU6050_EXT_SENS_DATA_23)
+        return true;
+
+    switch(ui8Reg)
+    {
+    case MPU6050_I2C_SLV4_DI:
+    case MPU6050_I2C_MST_STATUS:
+    case MPU6050_INT_STATUS:
+    case MPU6050_FIFO_COUNTH:
+    case MPU6050_FIFO_COUNTL:
+    case MPU6050_WHO_AM_I:
+        return true;
+    default:
+        return false;
+    }
+}
+
+/**
+ *  \brief Sample period derived from SMPLRT_DIV and DLPF_CFG
+ *  
+ *  \param [in] sim Simulated sensor
+ *  \return Sample period in nanoseconds
+ *  
+ *  Sample Rate = Gyroscope Output Rate / (1 + SMPLRT_DIV), where the
+ *  gyroscope output rate is 8kHz with disabled DLPF (DLPF_CFG = 0 or 7)
+ *  and 1kHz otherwise. The sensor clock runs i32ClockPpm fast.
+ */
+uint64_t sim_samplePeriodNs(const tSIM_MPU6050 *sim)
+{
+    uint8_t dlpf = sim->pui8Reg[MPU6050_CONFIG] & 0x07;
+    uint64_t gyroPeriodNs = (dlpf == 0 || dlpf == 7) ? 125000 : 1000000;
+    uint64_t periodNs = gyroPeriodNs * (1 + (uint64_t)sim->pui8Reg[MPU6050_SMPRT_DIV]);
+
+    // a fast sensor clock shortens the period
+    return (uint64_t)((int64_t)periodNs * 1000000 / (1000000 + sim->i32ClockPpm));
+}
+
+/**
+ *  \brief Update the INT line
+ *  
+ *  \param [in] sim Simulated sensor
+ *  \param [in] bEvent true if an interrupt has just been generated
+ */
+static void sim_intUpdate(tSIM_MPU6050 *sim, bool bEvent)
+{
+    bool latched = (sim->pui8Reg[MPU6050_INT_PIN_CFG] & SIM_INT_PIN_CFG_LATCH_INT_EN) != 0;
+    bool active = (sim->pui8Reg[MPU6050_INT_STATUS] & sim->pui8Reg[MPU6050_INT_ENABLE] & SIM_INT_SOURCES) != 0;
+    bool edge;
+
+    if(!latched)
+        active = active && bEvent;
+
+    edge = active && !sim->bIntLine;
+
+    // a pulse is over before the handler can access the sensor
+    sim->bIntLine = latched && active;
+
+    if(edge && sim->intHandler)
+    {
+        sim->stats.INTERRUPTS++;
+        sim->stats.CPU_BUSY_NS += sim->ui32IsrNs;
+        sim->intHandler(sim->intArg);
+    }
+}
+
+/**
+ *  \brief Append data to the FIFO, dropping the oldest bytes on overflow
+ */
+static void sim_fifoPush(tSIM_MPU6050 *sim, const uint8_t *pui8Data, uint16_t ui16Count)
+{
+    uint16_t i;
+
+    for(i = 0; i < ui16Count; i++)
+    {
+        if(sim->ui16FifoCount == SIM_FIFO_SIZE)
+        {
+            sim->ui16FifoHead = (sim->ui16FifoHead + 1) % SIM_FIFO_SIZE;
+            sim->ui16FifoCount--;
+            sim->pui8Reg[MPU6050_INT_STATUS] |= SIM_INT_STATUS_FIFO_OFLOW;
+        }
+        sim->pui8Fifo[(sim->ui16FifoHead + sim->ui16FifoCount) % SIM_FIFO_SIZE] = pui8Data[i];
+        sim->ui16FifoCount++;
+    }
+}
+
+/**
+ *  \brief Take one sample: update the measurement registers and the FIFO
+ */
+static void sim_sample(tSIM_MPU6050 *sim)
+{
+    int16_t data[SIM_SOURCE_CHANNELS];
+    uint8_t *reg = &sim->pui8Reg[MPU6050_ACCEL_XOUT_H];
+    uint8_t fifoEn = sim->pui8Reg[MPU6050_FIFO_EN];
+    uint8_t i;
+
+    if(sim->source)
+    {
+        sim->source(sim->sourceArg, sim->ui64TimeNs, data);
+    }
+    else
+    {
+        // sensor at rest: 1g on the Z axis, 25 degrees C
+        memset(data, 0, sizeof(data));
+        data[2] = (int16_t)(16384 >> ((sim->pui8Reg[MPU6050_ACCEL_CONFIG] >> 3) & 0x03));
+        data[3] = (int16_t)((25.0f - 36.53f) * 340.0f);
+    }
+
+    for(i = 0; i < SIM_SOURCE_CHANNELS; i++)
+    {
+        reg[2 * i] = (uint8_t)((uint16_t)data[i] >> 8);
+        reg[2 * i + 1] = (uint8_t)data[i];
+    }
+
+    sim->pui8Reg[MPU6050_INT_STATUS] |= SIM_INT_STATUS_DATA_RDY;
+    sim->ui32Samples++;
+    sim->ui64SampleNs = sim->ui64TimeNs;
+
+    // the FIFO is written in order of register number
+    if(sim->pui8Reg[MPU6050_USER_CTRL] & SIM_USER_CTRL_FIFO_EN)
+    {
+        if(fifoEn & 0x08) sim_fifoPush(sim, &sim->pui8Reg[MPU6050_ACCEL_XOUT_H], 6);
+        if(fifoEn & 0x80) sim_fifoPush(sim, &sim->pui8Reg[MPU6050_TEMP_OUT_H], 2);
+        if(fifoEn & 0x40) sim_fifoPush(sim, &sim->pui8Reg[MPU6050_GYRO_XOUT_H], 2);
+        if(fifoEn & 0x20) sim_fifoPush(sim, &sim->pui8Reg[MPU6050_GYRO_YOUT_H], 2);
+        if(fifoEn & 0x10) sim_fifoPush(sim, &sim->pui8Reg[MPU6050_GYRO_ZOUT_H], 2);
+    }
+
+    sim_intUpdate(sim, true);
+}
+
+/**
+ *  \brief Time of a bus transaction
+ *  
+ *  \param [in] sim Simulated sensor
+ *  \param [in] ui16Bytes Number of bytes on the bus including address bytes
+ *  \param [in] ui8Conditions Number of START, repeated START and STOP conditions
+ *  \return Transaction time in nanoseconds
+ */
+static uint64_t sim_busTimeNs(const tSIM_MPU6050 *sim, uint16_t ui16Bytes, uint8_t ui8Conditions)
+{
+    // every byte takes 8 data bits and one acknowledge bit
+    uint64_t bits = 9 * (uint64_t)ui16Bytes + ui8Conditions;
+
+    return bits * 1000000000ULL / sim->ui32BusClockHz;
+}
+
+/**
+ *  \brief Time of a transfer
+ *  
+ *  Burst read: START, address, register, repeated START, address, data, STOP.
+ *  Burst write: START, address, register, data, STOP. A transfer to another
+ *  slave ends after the NACK of the address byte.
+ */
+static uint64_t sim_transferTimeNs(const tSIM_MPU6050 *sim, uint8_t ui8SlaveAddr, bool bRead, uint16_t ui16Count)
+{
+    if(ui8SlaveAddr != sim->ui8SlaveAddr)
+        return sim_busTimeNs(sim, 1, 2);
+
+    return bRead ? sim_busTimeNs(sim, 3 + ui16Count, 3) : sim_busTimeNs(sim, 2 + ui16Count, 2);
+}
+
+/**
+ *  \brief Register read with side effects
+ */
+static uint8_t sim_regRead(tSIM_MPU6050 *sim, uint8_t ui8Reg)
+{
+    uint8_t value;
+
+    switch(ui8Reg)
+    {
+    case MPU6050_FIFO_COUNTH:
+        value = (uint8_t)(sim->ui16FifoCount >> 8);
+        break;
+    case MPU6050_FIFO_COUNTL:
+        value = (uint8_t)(sim->ui16FifoCount & 0xFF);
+        break;
+    case MPU6050_FIFO_R_W:
+        // an empty FIFO returns the last byte read
+        if(sim->ui16FifoCount)
+        {
+            sim->ui8FifoLast = sim->pui8Fifo[sim->ui16FifoHead];
+            sim->ui16FifoHead = (sim->ui16FifoHead + 1) % SIM_FIFO_SIZE;
+            sim->ui16FifoCount--;
+        }
+        value = sim->ui8FifoLast;
+        break;
+    case MPU6050_INT_STATUS:
+        value = sim->pui8Reg[MPU6050_INT_STATUS];
+        sim->pui8Reg[MPU6050_INT_STATUS] = 0;
+        break;
+    default:
+        value = sim->pui8Reg[ui8Reg & 0x7F];
+        break;
+    }
+
+    if(sim->pui8Reg[MPU6050_INT_PIN_CFG] & SIM_INT_PIN_CFG_INT_RD_CLEAR)
+        sim->pui8Reg[MPU6050_INT_STATUS] = 0;
+
+    return value;
+}
+
+/**
+ *  \brief Register write with side effects
+ */
+static void sim_regWrite(tSIM_MPU6050 *sim, uint8_t ui8Reg, uint8_t ui8Data)
+{
+    ui8Reg &= 0x7F;
+
+    if(sim_regReadOnly(ui8Reg))
+        return;
+
+    switch(ui8Reg)
+    {
+    case MPU6050_FIFO_R_W:
+        sim_fifoPush(sim, &ui8Data, 1);
+        return;
+    case MPU6050_PWR_MGMT_1:
+        if(ui8Data & SIM_PWR_MGMT_1_DEVICE_RESET)
+        {
+            sim_reset(sim);
+            return;
+        }
+        // restart the sample clock when leaving sleep mode
+        if((sim->pui8Reg[MPU6050_PWR_MGMT_1] & SIM_PWR_MGMT_1_SLEEP) && !(ui8Data & SIM_PWR_MGMT_1_SLEEP))
+            sim->ui64NextSampleNs = sim->ui64TimeNs + sim_samplePeriodNs(sim);
+        break;
+    case MPU6050_USER_CTRL:
+        if(ui8Data & SIM_USER_CTRL_FIFO_RESET)
+        {
+            sim->ui16FifoHead = 0;
+            sim->ui16FifoCount = 0;
+        }
+        if(ui8Data & SIM_USER_CTRL_SIG_COND_RESET)
+            memset(&sim->pui8Reg[MPU6050_ACCEL_XOUT_H], 0, MPU6050_GYRO_ZOUT_L - MPU6050_ACCEL_XOUT_H + 1);
+        // reset bits clear automatically
+        ui8Data &= 0x70;
+        break;
+    case MPU6050_SIGNAL_PATH_RESET:
+        // reset bits clear automatically
+        ui8Data = 0;
+        break;
+    default:
+        break;
+    }
+
+    sim->pui8Reg[ui8Reg] = ui8Data;
+}
+
+/**
+ *  \brief Register address after an access within a burst
+ *  
+ *  The register address auto increments, except for FIFO_R_W which
+ *  delivers consecutive FIFO bytes.
+ */
+static uint8_t sim_regNext(uint8_t ui8Reg)
+{
+    return ui8Reg == MPU6050_FIFO_R_W ? ui8Reg : (uint8_t)((ui8Reg + 1) & 0x7F);
+}
+
+//--------------------------------------//
+// MPU6050 transport                    //
+//--------------------------------------//
+
+/**
+ *  \brief Execute the register accesses of a transfer
+ *  
+ *  \return true if the slave acknowledged its address
+ */
+static bool sim_transferExecute(tSIM_MPU6050 *sim, uint8_t ui8SlaveAddr, uint8_t ui8Reg, bool bRead, uint8_t *pui8Data, uint16_t ui16Count)
+{
+    uint16_t i;
+
+    sim->stats.TRANSACTIONS++;
+    sim->stats.BUS_TIME_NS += sim_transferTimeNs(sim, ui8SlaveAddr, bRead, ui16Count);
+
+    if(ui8SlaveAddr != sim->ui8SlaveAddr)
+    {
+        sim->stats.NACKS++;
+        if(bRead)
+            memset(pui8Data, 0xFF, ui16Count);
+        return false;
+    }
+
+    for(i = 0; i < ui16Count; i++)
+    {
+        if(bRead)
+            pui8Data[i] = sim_regRead(sim, ui8Reg);
+        else
+            sim_regWrite(sim, ui8Reg, pui8Data[i]);
+        ui8Reg = sim_regNext(ui8Reg);
+    }
+
+    if(bRead)
+        sim->stats.BYTES_READ += ui16Count;
+    else
+        sim->stats.BYTES_WRITTEN += ui16Count;
+
+    sim_intUpdate(sim, false);
+
+    return true;
+}
+
+/**
+ *  \brief Finish the active asynchronous transfer and start the next one
+ *  
+ *  The Tiva driver takes one interrupt for the register address and one
+ *  for every data byte.
+ */
+static void sim_transferComplete(tSIM_MPU6050 *sim)
+{
+    tMPU6050_TRANSFER *transfer = sim->queueHead;
+    bool ack;
+
+    sim->queueHead = transfer->next;
+    if(sim->queueHead == 0)
+        sim->queueTail = 0;
+
+    ack = sim_transferExecute(sim, transfer->SLAVE_ADDR, transfer->REG, transfer->READ, transfer->DATA, transfer->COUNT);
+
+    sim->stats.INTERRUPTS += ack ? 1 + transfer->COUNT : 1;
+    sim->stats.CPU_BUSY_NS += (uint64_t)(ack ? 1 + transfer->COUNT : 1) * sim->ui32IsrNs;
+
+    // start the next transfer, the callback may queue further transfers
+    if(sim->queueHead)
+        sim->ui64TransferEndNs = sim->ui64TimeNs + sim_transferTimeNs(sim, sim->queueHead->SLAVE_ADDR, sim->queueHead->READ, sim->queueHead->COUNT);
+
+    transfer->ERROR = ack ? 0 : 1;
+    transfer->DONE = true;
+    if(transfer->callback)
+        transfer->callback(transfer);
+}
+
+/**
+ *  \brief Advance the virtual time
+ *  
+ *  \param [in] sim Simulated sensor
+ *  \param [in] ui64Ns Time to advance in nanoseconds
+ *  
+ *  Takes all samples and completes all asynchronous transfers that are due,
+ *  in order of their virtual time.
+ */
+void sim_clockAdvance(tSIM_MPU6050 *sim, uint64_t ui64Ns)
+{
+    uint64_t end = sim->ui64TimeNs + ui64Ns;
+    bool sampleDue;
+    bool transferDue;
+
+    for(;;)
+    {
+        // no samples are taken in sleep mode
+        sampleDue = !(sim->pui8Reg[MPU6050_PWR_MGMT_1] & SIM_PWR_MGMT_1_SLEEP) && sim->ui64NextSampleNs <= end;
+        transferDue = sim->queueHead && sim->ui64TransferEndNs <= end;
+
+        if(transferDue && (!sampleDue || sim->ui64TransferEndNs <= sim->ui64NextSampleNs))
+        {
+            sim->ui64TimeNs = sim->ui64TransferEndNs;
+            sim_transferComplete(sim);
+        }
+        else if(sampleDue)
+        {
+            sim->ui64TimeNs = sim->ui64NextSampleNs;
+            sim_sample(sim);
+            sim->ui64NextSampleNs += sim_samplePeriodNs(sim);
+        }
+        else
+        {
+            break;
+        }
+    }
+
+    if(sim->pui8Reg[MPU6050_PWR_MGMT_1] & SIM_PWR_MGMT_1_SLEEP)
+        sim->ui64NextSampleNs = end + sim_samplePeriodNs(sim);
+
+    sim->ui64TimeNs = end;
+}
+
+/**
+ *  \brief Wait until all asynchronous transfers are done
+ *  
+ *  \param [in] sim Simulated sensor
+ *  
+ *  \details The waiting time is charged to the CPU, like the busy wait of
+ *  a blocking driver call.
+ */
+void sim_queueFlush(tSIM_MPU6050 *sim)
+{
+    uint64_t ns;
+
+    while(sim->queueHead)
+    {
+        ns = sim->ui64TransferEndNs - sim->ui64TimeNs;
+        sim->stats.CPU_BUSY_NS += ns;
+        sim_clockAdvance(sim, ns);
+    }
+}
+
+/**
+ *  \brief Execute a blocking transfer
+ *  
+ *  The bus is released by queued transfers first. The CPU waits for the
+ *  whole transaction.
+ */
+static void sim_transferBlocking(tSIM_MPU6050 *sim, uint8_t ui8SlaveAddr, uint8_t ui8Reg, bool bRead, uint8_t *pui8Data, uint16_t ui16Count)
+{
+    uint64_t ns;
+
+    sim_queueFlush(sim);
+
+    ns = sim_transferTimeNs(sim, ui8SlaveAddr, bRead, ui16Count);
+    sim_transferExecute(sim, ui8SlaveAddr, ui8Reg, bRead, pui8Data, ui16Count);
+
+    sim->stats.CPU_BUSY_NS += ns;
+    sim_clockAdvance(sim, ns);
+}
+
+//--------------------------------------//
+// MPU6050 transport                    //
+//--------------------------------------//
+
+static void sim_transportReadBurst(void *ctx, uint8_t ui8SlaveAddr, uint8_t ui8Reg, uint8_t *pui8Data, uint16_t ui16Count)
+{
+    sim_transferBlocking((tSIM_MPU6050*)ctx, ui8SlaveAddr, ui8Reg, true, pui8Data, ui16Count);
+}
+
+static void sim_transportWriteBurst(void *ctx, uint8_t ui8SlaveAddr, uint8_t ui8Reg, const uint8_t *pui8Data, uint16_t ui16Count)
+{
+    // a write transfer only reads from the buffer
+    sim_transferBlocking((tSIM_MPU6050*)ctx, ui8SlaveAddr, ui8Reg, false, (uint8_t*)pui8Data, ui16Count);
+}
+
+static uint8_t sim_transportRead(void *ctx, uint8_t ui8SlaveAddr, uint8_t ui8Reg)
+{
+    uint8_t value;
+    sim_transportReadBurst(ctx, ui8SlaveAddr, ui8Reg, &value, 1);
+    return value;
+}
+
+static void sim_transportWrite(void *ctx, uint8_t ui8SlaveAddr, uint8_t ui8Reg, uint8_t ui8Data)
+{
+    sim_transportWriteBurst(ctx, ui8SlaveAddr, ui8Reg, &ui8Data, 1);
+}
+
+static void sim_transportSubmit(void *ctx, tMPU6050_TRANSFER *transfer)
+{
+    tSIM_MPU6050 *sim = (tSIM_MPU6050*)ctx;
+
+    transfer->next = 0;
+    transfer->DONE = false;
+    transfer->ERROR = 0;
+
+    if(transfer->COUNT == 0)
+    {
+        transfer->DONE = true;
+        if(transfer->callback)
+            transfer->callback(transfer);
+        return;
+    }
+
+    if(sim->queueTail)
+    {
+        sim->queueTail->next = transfer;
+    }
+    else
+    {
+        sim->queueHead = transfer;
+        sim->ui64TransferEndNs = sim->ui64TimeNs + sim_transferTimeNs(sim, transfer->SLAVE_ADDR, transfer->READ, transfer->COUNT);
+    }
+    sim->queueTail = transfer;
+}
+
+/**
+ *  \brief Reset the register file to the power on values
+ *  
+ *  \param [in] sim Simulated sensor
+ *  
+ *  \details All registers are 0x00 except PWR_MGMT_1 (0x40, sleep mode)
+ *  and WHO_AM_I (0x68). The FIFO is cleared.
+ */
+void sim_reset(tSIM_MPU6050 *sim)
+{
+    memset(sim->pui8Reg, 0, sizeof(sim->pui8Reg));
+    sim->pui8Reg[MPU6050_PWR_MGMT_1] = SIM_PWR_MGMT_1_SLEEP;
+    sim->pui8Reg[MPU6050_WHO_AM_I] = 0x68;
+    sim->ui16FifoHead = 0;
+    sim->ui16FifoCount = 0;
+    sim->ui8FifoLast = 0;
+    sim->ui32Samples = 0;
+    sim->bIntLine = false;
+    sim->ui64NextSampleNs = sim->ui64TimeNs + sim_samplePeriodNs(sim);
+}
+
+/**
+ *  \brief Simulated sensor initialization
+ *  
+ *  \param [in] sim Simulated sensor
+ *  \param [in] ui8SlaveAddr I2C slave address the sensor answers to (0x68 or 0x69)
+ *  
+ *  Resets the sensor and the virtual time and sets up sim->transport.
+ */
+void sim_initialization(tSIM_MPU6050 *sim, uint8_t ui8SlaveAddr)
+{
+    memset(sim, 0, sizeof(*sim));
+    sim->ui8SlaveAddr = ui8SlaveAddr;
+    sim->ui32BusClockHz = SIM_BUS_CLOCK_HZ;
+    sim->ui32IsrNs = SIM_ISR_NS;
+
+    sim->transport.read = sim_transportRead;
+    sim->transport.write = sim_transportWrite;
+    sim->transport.readBurst = sim_transportReadBurst;
+    sim->transport.writeBurst = sim_transportWriteBurst;
+    sim->transport.submit = sim_transportSubmit;
+    sim->transport.ctx = sim;
+
+    sim_reset(sim);
+}
+
+/**
+ *  \brief Set the data source of the measurement registers
+ *  
+ *  \param [in] sim Simulated sensor
+ *  \param [in] source Data source, 0 for a sensor at rest
+ *  \param [in] arg Argument passed to the data source
+ */
+void sim_sourceSet(tSIM_MPU6050 *sim, tSIM_SOURCE source, void *arg)
+{
+    sim->source = source;
+    sim->sourceArg = arg;
+}
+
+/**
+ *  \brief Connect a handler to the INT pin
+ *  
+ *  \param [in] sim Simulated sensor
+ *  \param [in] handler INT pin handler, 0 to disconnect
+ *  \param [in] arg Argument passed to the handler
+ */
+void sim_intHandlerSet(tSIM_MPU6050 *sim, tSIM_INT_HANDLER handler, void *arg)
+{
+    sim->intHandler = handler;
+    sim->intArg = arg;
+}
+
+/**
+ *  \brief Clear the bus statistics
+ *  
+ *  \param [in] sim Simulated sensor
+ */
+void sim_statsReset(tSIM_MPU6050 *sim)
+{
+    memset(&sim->stats, 0, sizeof(sim->stats));
+}
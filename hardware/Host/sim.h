@@ -0,0 +1,108 @@
+/*
+ * This file is part of the MPU6050-Library distribution (https://github.com/jmherzog-de/MPU6050-Library).
+ * Copyright (c) 2021 Jean-Marcel Herzog.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ *  \file sim.h
+ *  \brief Simulated MPU6050 headerfile
+ *  \copyright Copyright 2021 Jean-Marcel Herzog. All rights reserved. This project is released under the GNU Public License.
+ */
+
+#ifndef SIM_H_
+#define SIM_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "mpu6050_transport.h"
+
+#define SIM_FIFO_SIZE           1024
+#define SIM_BUS_CLOCK_HZ        400000
+#define SIM_ISR_NS              500
+
+/** Number of values delivered by a data source: accel x,y,z, temperature, gyro x,y,z */
+#define SIM_SOURCE_CHANNELS     7
+
+/**
+ *  \brief Data source of the simulated sensor
+ *  
+ *  Called once per sample. Fills SIM_SOURCE_CHANNELS raw register values
+ *  for the given virtual time.
+ */
+typedef void (*tSIM_SOURCE)(void *arg, uint64_t ui64TimeNs, int16_t *pi16Data);
+
+/**
+ *  \brief Interrupt handler of the host pin connected to INT
+ *  
+ *  Called on every activation of the INT line, like a host GPIO interrupt.
+ */
+typedef void (*tSIM_INT_HANDLER)(void *arg);
+
+/**
+ *  \brief Bus statistics of the simulated sensor
+ */
+typedef struct
+{
+    uint32_t TRANSACTIONS;      /**< Number of bus transactions (START to STOP) */
+    uint32_t BYTES_READ;        /**< Number of data bytes read from the sensor */
+    uint32_t BYTES_WRITTEN;     /**< Number of data bytes written to the sensor, without register address */
+    uint32_t NACKS;             /**< Number of transactions addressed to another slave */
+    uint64_t BUS_TIME_NS;       /**< Time the bus was busy */
+    uint64_t CPU_BUSY_NS;       /**< Time the CPU spent in the driver (blocking waits and interrupt handlers) */
+    uint32_t INTERRUPTS;        /**< Number of driver interrupts of asynchronous transfers and the INT pin */
+}
+tSIM_STATS;
+
+/**
+ *  \brief Simulated MPU6050 instance
+ */
+typedef struct
+{
+    tMPU6050_TRANSPORT transport;       /**< Transport to pass to mpu6050_transportSet() */
+    uint8_t ui8SlaveAddr;               /**< I2C slave address the sensor answers to */
+    uint8_t pui8Reg[128];               /**< Register file */
+    uint8_t pui8Fifo[SIM_FIFO_SIZE];    /**< FIFO buffer */
+    uint16_t ui16FifoHead;              /**< Index of the oldest FIFO byte */
+    uint16_t ui16FifoCount;             /**< Number of bytes in the FIFO */
+    uint8_t ui8FifoLast;                /**< Last byte read from the FIFO */
+    uint32_t ui32BusClockHz;            /**< I2C bus clock used for timing */
+    uint32_t ui32IsrNs;                 /**< CPU time of one driver interrupt */
+    uint64_t ui64TimeNs;                /**< Virtual time */
+    uint64_t ui64NextSampleNs;          /**< Virtual time of the next sample */
+    uint32_t ui32Samples;               /**< Number of samples taken since reset */
+    uint64_t ui64SampleNs;              /**< Virtual time of the last sample */
+    int32_t i32ClockPpm;                /**< Deviation of the sensor clock from nominal in ppm */
+    tSIM_SOURCE source;                 /**< Data source, 0 for a sensor at rest */
+    void *sourceArg;                    /**< Argument passed to the data source */
+    tMPU6050_TRANSFER *queueHead;       /**< Active asynchronous transfer */
+    tMPU6050_TRANSFER *queueTail;       /**< Last queued asynchronous transfer */
+    uint64_t ui64TransferEndNs;         /**< Virtual time the active transfer finishes */
+    bool bIntLine;                      /**< INT line active */
+    tSIM_INT_HANDLER intHandler;        /**< Handler of the INT pin, 0 if not connected */
+    void *intArg;                       /**< Argument passed to the INT handler */
+    tSIM_STATS stats;                   /**< Bus statistics */
+}
+tSIM_MPU6050;
+
+void sim_initialization(tSIM_MPU6050 *sim, uint8_t ui8SlaveAddr);
+void sim_reset(tSIM_MPU6050 *sim);
+void sim_sourceSet(tSIM_MPU6050 *sim, tSIM_SOURCE source, void *arg);
+void sim_intHandlerSet(tSIM_MPU6050 *sim, tSIM_INT_HANDLER handler, void *arg);
+void sim_clockAdvance(tSIM_MPU6050 *sim, uint64_t ui64Ns);
+uint64_t sim_samplePeriodNs(const tSIM_MPU6050 *sim);
+void sim_statsReset(tSIM_MPU6050 *sim);
+void sim_queueFlush(tSIM_MPU6050 *sim);
+
+#endif
@@ -0,0 +1,88 @@
+/*
+ * This file is part of the MPU6050-Library distribution (https://github.com/jmherzog-de/MPU6050-Library).
+ * Copyright (c) 2021 Jean-Marcel Herzog.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ *  \file telemetryDump.c
+ *  \brief Host side telemetry decoder
+ *  
+ *  Reads a binary telemetry stream (see telemetry.c) from a file or the
+ *  standard input, e.g. a serial port, and prints one CSV line per sample:
+ *  
+ *      channel,sequence,accel x,accel y,accel z,temperature,gyro x,gyro y,gyro z
+ *  
+ *  Damaged frames are skipped. The frame statistics are printed to the
+ *  standard error at the end of the stream.
+ *  
+ *  Build and run on a host computer:
+ *  
+ *      gcc -Ilib -Ihardware hardware/Host/telemetryDump.c hardware/telemetry.c -o telemetryDump
+ *      stty -F /dev/ttyACM0 115200 raw && ./telemetryDump /dev/ttyACM0
+ *  
+ *  \copyright Copyright 2021 Jean-Marcel Herzog. All rights reserved. This project is released under the GNU Public License.
+ */
+
+#include <stdio.h>
+#include "telemetry.h"
+
+/**
+ *  \brief Print the samples of one valid frame
+ */
+static void telemetryDump_frame(const tTELEMETRY_DECODER *dec)
+{
+    static tMPU6050_MOTION raw[TELEMETRY_PAYLOAD_MAX / TELEMETRY_RAW_SIZE];
+    static tMPU6050_MOTION_SI scaled[TELEMETRY_PAYLOAD_MAX / TELEMETRY_SCALED_SIZE];
+    uint16_t n, i;
+
+    if(dec->CHANNEL == TELEMETRY_CHANNEL_RAW)
+    {
+        n = telemetry_rawUnpack(dec->payload, dec->PAYLOAD_LEN, raw);
+        for(i = 0; i < n; i++)
+            printf("%u,%u,%d,%d,%d,%d,%d,%d,%d\n", dec->CHANNEL, dec->SEQ,
+                   raw[i].ACCEL.X, raw[i].ACCEL.Y, raw[i].ACCEL.Z, raw[i].TEMP,
+                   raw[i].GYRO.X, raw[i].GYRO.Y, raw[i].GYRO.Z);
+    }
+    else if(dec->CHANNEL == TELEMETRY_CHANNEL_SCALED)
+    {
+        n = telemetry_scaledUnpack(dec->payload, dec->PAYLOAD_LEN, scaled);
+        for(i = 0; i < n; i++)
+            printf("%u,%u,%g,%g,%g,%g,%g,%g,%g\n", dec->CHANNEL, dec->SEQ,
+                   scaled[i].ACCEL.X, scaled[i].ACCEL.Y, scaled[i].ACCEL.Z, scaled[i].TEMP,
+                   scaled[i].GYRO.X, scaled[i].GYRO.Y, scaled[i].GYRO.Z);
+    }
+}
+
+int main(int argc, char **argv)
+{
+    static tTELEMETRY_DECODER dec;
+    FILE *in = stdin;
+    int c;
+
+    if(argc > 1 && !(in = fopen(argv[1], "rb")))
+    {
+        perror(argv[1]);
+        return 1;
+    }
+
+    telemetry_decoderInitialization(&dec);
+    while((c = fgetc(in)) != EOF)
+        if(telemetry_decodeByte(&dec, (uint8_t)c))
+            telemetryDump_frame(&dec);
+
+    fprintf(stderr, "%u frames, %u CRC errors, %u format errors, %u lost\n",
+            (unsigned)dec.FRAMES, (unsigned)dec.CRC_ERRORS, (unsigned)dec.FORMAT_ERRORS, (unsigned)dec.LOST);
+    return 0;
+}
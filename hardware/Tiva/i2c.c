@@ -22,94 +22,342 @@
  *  I2C implementation for Tiva TM4C microcontrollers. It contain a function
  *  for I2C hardware initialization, sending and receive data.
  *  
+ *  Every I2C module is described by a tI2C_BUS instance: i2c_bus0 (I2C0 on
+ *  PB2/PB3) and i2c_bus1 (I2C1 on PA6/PA7). Pass &bus->transport to
+ *  mpu6050_devInitialization() for every sensor on that bus.
+ *  
+ *  All transfers are executed by an interrupt driven state machine. Transfers
+ *  submitted with i2c_submit() are queued and processed one after another in
+ *  the I2C master interrupt, which calls the completion callback of each
+ *  transfer. The CPU is free while the bytes are on the bus.
+ *  
+ *  The blocking functions i2c_receive(), i2c_write(), i2c_receiveBurst() and
+ *  i2c_writeBurst() are thin wrappers: they submit a transfer and wait until
+ *  it is done. Do not call them from an interrupt with a priority equal to or
+ *  higher than the I2C interrupt.
+ *  
+ *  i2c0_interruptHandler() and i2c1_interruptHandler() must be placed in the
+ *  vector table for I2C0 and I2C1.
+ *  
  *  \copyright Copyright 2021 Jean-Marcel Herzog. All rights reserved. This project is released under the GNU Public License.
  */
 
 #include "i2c.h"
 
-#define I2C_SYSCTL_PERIPH       SYSCTL_PERIPH_I2C0
-#define I2C_BASE                I2C0_BASE
-#define I2C_PERIPH_PORT         SYSCTL_PERIPH_GPIOB
-#define I2C_PORT_BASE           GPIO_PORTB_BASE
-#define I2C_PIN_SCL             GPIO_PIN_2
-#define I2C_PIN_SDA             GPIO_PIN_3
+static uint8_t i2c_transportRead(void *ctx, uint8_t ui8SlaveAddr, uint8_t ui8Reg);
+static void i2c_transportWrite(void *ctx, uint8_t ui8SlaveAddr, uint8_t ui8Reg, uint8_t ui8Data);
+static void i2c_transportReadBurst(void *ctx, uint8_t ui8SlaveAddr, uint8_t ui8Reg, uint8_t *pui8Data, uint16_t ui16Count);
+static void i2c_transportWriteBurst(void *ctx, uint8_t ui8SlaveAddr, uint8_t ui8Reg, const uint8_t *pui8Data, uint16_t ui16Count);
+static void i2c_transportSubmit(void *ctx, tMPU6050_TRANSFER *transfer);
+
+/**
+ *  \brief I2C0 on PORTB at PIN2 (SCL) and PIN3 (SDA)
+ */
+tI2C_BUS i2c_bus0 =
+{
+    { i2c_transportRead, i2c_transportWrite, i2c_transportReadBurst, i2c_transportWriteBurst, i2c_transportSubmit, &i2c_bus0 },
+    SYSCTL_PERIPH_I2C0, I2C0_BASE,
+    SYSCTL_PERIPH_GPIOB, GPIO_PORTB_BASE, GPIO_PB2_I2C0SCL, GPIO_PB3_I2C0SDA, GPIO_PIN_2, GPIO_PIN_3,
+    INT_I2C0,
+    0, 0, I2C_STATE_IDLE, 0
+};
 
+/**
+ *  \brief I2C1 on PORTA at PIN6 (SCL) and PIN7 (SDA)
+ */
+tI2C_BUS i2c_bus1 =
+{
+    { i2c_transportRead, i2c_transportWrite, i2c_transportReadBurst, i2c_transportWriteBurst, i2c_transportSubmit, &i2c_bus1 },
+    SYSCTL_PERIPH_I2C1, I2C1_BASE,
+    SYSCTL_PERIPH_GPIOA, GPIO_PORTA_BASE, GPIO_PA6_I2C1SCL, GPIO_PA7_I2C1SDA, GPIO_PIN_6, GPIO_PIN_7,
+    INT_I2C1,
+    0, 0, I2C_STATE_IDLE, 0
+};
 
 /**
  *  \brief Tiva I2C hardware initialization
  *  
- *  This functions initializes the I2C0 on PORTB at PIN2 and PIN3.
- *  Edit the define variables to change it.
+ *  \param [in] bus I2C bus to initialize
+ *  
+ *  This functions initializes the I2C module and its GPIO pins.
+ *  Edit the bus instances to change it.
  */
-void i2c_initialization()
+void i2c_initialization(tI2C_BUS *bus)
 {
     // GPIO configuration
-    SysCtlPeripheralEnable(I2C_PERIPH_PORT);
+    SysCtlPeripheralEnable(bus->ui32GpioPeriph);
 
     // enable I2C peripheral for GPIO
-    SysCtlPeripheralEnable(I2C_SYSCTL_PERIPH);
+    SysCtlPeripheralEnable(bus->ui32SysctlPeriph);
 
-    GPIOPinConfigure(GPIO_PB2_I2C0SCL);
-    GPIOPinConfigure(GPIO_PB3_I2C0SDA);
+    GPIOPinConfigure(bus->ui32SclPinConfig);
+    GPIOPinConfigure(bus->ui32SdaPinConfig);
 
     // select the I2C function for these pins
-    GPIOPinTypeI2CSCL(I2C_PORT_BASE, I2C_PIN_SCL);
-    GPIOPinTypeI2C(I2C_PORT_BASE, I2C_PIN_SDA);
+    GPIOPinTypeI2CSCL(bus->ui32GpioBase, bus->ui8SclPin);
+    GPIOPinTypeI2C(bus->ui32GpioBase, bus->ui8SdaPin);
 
     // reset module
-    SysCtlPeripheralReset(I2C_SYSCTL_PERIPH);
+    SysCtlPeripheralReset(bus->ui32SysctlPeriph);
 
     // wait for the I2C bus to be ready
-    while(!SysCtlPeripheralReady(I2C_SYSCTL_PERIPH)){}
+    while(!SysCtlPeripheralReady(bus->ui32SysctlPeriph)){}
 
     // initialize master and slave
-    I2CMasterInitExpClk(I2C_BASE, SysCtlClockGet(), true);
+    I2CMasterInitExpClk(bus->ui32Base, SysCtlClockGet(), true);
 
     // Clear I2C FIFOs
-    I2CRxFIFOFlush(I2C_BASE);
+    I2CRxFIFOFlush(bus->ui32Base);
+
+    bus->queueHead = 0;
+    bus->queueTail = 0;
+    bus->state = I2C_STATE_IDLE;
+
+    // interrupt after every byte on the bus
+    I2CMasterIntClear(bus->ui32Base);
+    I2CMasterIntEnable(bus->ui32Base);
+    IntEnable(bus->ui32Int);
 }
 
 /**
- *  \brief Tiva I2C receive register data
+ *  \brief Start the transfer at the head of the queue
  *  
- *  \param [in] ui8SlaveAddr I2C slave address of the MPU6050 sensor
- *  \param [in] ui8Reg Register address to read from
- *  \return Received data from sensor
- *  
- *  Transmit a burst command with the register address and read
- *  the incomming data.
+ *  Sends the register address. The following bytes are handled by
+ *  i2c_interruptHandler().
  */
- uint32_t i2c_receive(uint8_t ui8SlaveAddr, uint8_t ui8Reg)
+static void i2c_start(tI2C_BUS *bus)
 {
+    tMPU6050_TRANSFER *transfer = bus->queueHead;
+
+    if(transfer == 0)
+    {
+        bus->state = I2C_STATE_IDLE;
+        return;
+    }
+
     // specify that we are writing (a register address) to the
     // slave device
-    I2CMasterSlaveAddrSet(I2C0_BASE, ui8SlaveAddr, false);
+    I2CMasterSlaveAddrSet(bus->ui32Base, transfer->SLAVE_ADDR, false);
+    I2CMasterDataPut(bus->ui32Base, transfer->REG);
+
+    bus->state = I2C_STATE_REG;
+    bus->ui16Index = 0;
+    I2CMasterControl(bus->ui32Base, I2C_MASTER_CMD_BURST_SEND_START);
+}
+
+/**
+ *  \brief Finish the active transfer and start the next one
+ *  
+ *  \param [in] bus I2C bus
+ *  \param [in] ui32Error Error code of the active transfer
+ */
+static void i2c_complete(tI2C_BUS *bus, uint32_t ui32Error)
+{
+    tMPU6050_TRANSFER *transfer = bus->queueHead;
+
+    bus->queueHead = transfer->next;
+    if(bus->queueHead == 0)
+        bus->queueTail = 0;
+
+    transfer->ERROR = ui32Error;
+    transfer->DONE = true;
+    if(transfer->callback)
+        transfer->callback(transfer);
+
+    i2c_start(bus);
+}
+
+/**
+ *  \brief Tiva I2C master interrupt handler
+ *  
+ *  \param [in] bus I2C bus of the interrupt
+ *  
+ *  Called after every byte on the bus. Issues the next command of the
+ *  active transfer.
+ */
+void i2c_interruptHandler(tI2C_BUS *bus)
+{
+    tMPU6050_TRANSFER *transfer = bus->queueHead;
+    uint32_t error;
+
+    I2CMasterIntClear(bus->ui32Base);
+
+    if(transfer == 0)
+        return;
+
+    error = I2CMasterErr(bus->ui32Base);
+    if(error != I2C_MASTER_ERR_NONE)
+    {
+        I2CMasterControl(bus->ui32Base, bus->state == I2C_STATE_READ ? I2C_MASTER_CMD_BURST_RECEIVE_ERROR_STOP : I2C_MASTER_CMD_BURST_SEND_ERROR_STOP);
+        i2c_complete(bus, error);
+        return;
+    }
+
+    switch(bus->state)
+    {
+    case I2C_STATE_REG:
+        if(transfer->READ)
+        {
+            // repeated start and read from the slave device
+            I2CMasterSlaveAddrSet(bus->ui32Base, transfer->SLAVE_ADDR, true);
+            bus->state = I2C_STATE_READ;
+            I2CMasterControl(bus->ui32Base, transfer->COUNT == 1 ? I2C_MASTER_CMD_SINGLE_RECEIVE : I2C_MASTER_CMD_BURST_RECEIVE_START);
+        }
+        else
+        {
+            I2CMasterDataPut(bus->ui32Base, transfer->DATA[bus->ui16Index++]);
+            bus->state = I2C_STATE_WRITE;
+            I2CMasterControl(bus->ui32Base, bus->ui16Index == transfer->COUNT ? I2C_MASTER_CMD_BURST_SEND_FINISH : I2C_MASTER_CMD_BURST_SEND_CONT);
+        }
+        break;
+
+    case I2C_STATE_READ:
+        transfer->DATA[bus->ui16Index++] = I2CMasterDataGet(bus->ui32Base);
+        if(bus->ui16Index == transfer->COUNT)
+            i2c_complete(bus, 0);
+        else
+            // the last byte is received with NACK and stop condition
+            I2CMasterControl(bus->ui32Base, bus->ui16Index == transfer->COUNT - 1 ? I2C_MASTER_CMD_BURST_RECEIVE_FINISH : I2C_MASTER_CMD_BURST_RECEIVE_CONT);
+        break;
+
+    case I2C_STATE_WRITE:
+        if(bus->ui16Index == transfer->COUNT)
+        {
+            i2c_complete(bus, 0);
+        }
+        else
+        {
+            I2CMasterDataPut(bus->ui32Base, transfer->DATA[bus->ui16Index++]);
+            I2CMasterControl(bus->ui32Base, bus->ui16Index == transfer->COUNT ? I2C_MASTER_CMD_BURST_SEND_FINISH : I2C_MASTER_CMD_BURST_SEND_CONT);
+        }
+        break;
+
+    default:
+        break;
+    }
+}
+
+/**
+ *  \brief I2C0 interrupt vector
+ */
+void i2c0_interruptHandler(void)
+{
+    i2c_interruptHandler(&i2c_bus0);
+}
+
+/**
+ *  \brief I2C1 interrupt vector
+ */
+void i2c1_interruptHandler(void)
+{
+    i2c_interruptHandler(&i2c_bus1);
+}
+
+/**
+ *  \brief Tiva I2C queue a transfer
+ *  
+ *  \param [in] bus I2C bus
+ *  \param [in] transfer Transfer to execute
+ *  
+ *  Append the transfer to the queue and return immediately. The transfer
+ *  callback is called from the I2C interrupt when the transfer is done.
+ *  Transfers with a zero byte count complete immediately. May be called
+ *  from any interrupt, e.g. the INT pin interrupt.
+ */
+void i2c_submit(tI2C_BUS *bus, tMPU6050_TRANSFER *transfer)
+{
+    bool masked;
+
+    transfer->next = 0;
+    transfer->DONE = false;
+    transfer->ERROR = 0;
+
+    if(transfer->COUNT == 0)
+    {
+        transfer->DONE = true;
+        if(transfer->callback)
+            transfer->callback(transfer);
+        return;
+    }
+
+    // the queue is shared with the I2C interrupt and other submitting interrupts
+    masked = IntMasterDisable();
+
+    if(bus->queueTail)
+        bus->queueTail->next = transfer;
+    else
+        bus->queueHead = transfer;
+    bus->queueTail = transfer;
+
+    if(bus->state == I2C_STATE_IDLE)
+        i2c_start(bus);
+
+    if(!masked)
+        IntMasterEnable();
+}
 
-    // specify register to be read
-    I2CMasterDataPut(I2C0_BASE, ui8Reg);
+/**
+ *  \brief Execute a transfer and wait until it is done
+ */
+static void i2c_transferBlocking(tI2C_BUS *bus, uint8_t ui8SlaveAddr, uint8_t ui8Reg, bool bRead, uint8_t *pui8Data, uint16_t ui16Count)
+{
+    tMPU6050_TRANSFER transfer;
 
-    // send control byte and register address byte to slave device
-    I2CMasterControl(I2C0_BASE, I2C_MASTER_CMD_BURST_SEND_START);
+    transfer.SLAVE_ADDR = ui8SlaveAddr;
+    transfer.REG = ui8Reg;
+    transfer.READ = bRead;
+    transfer.DATA = pui8Data;
+    transfer.COUNT = ui16Count;
+    transfer.callback = 0;
+    transfer.arg = 0;
 
-    // wait for MCU to finish transaction
-    while(I2CMasterBusy(I2C0_BASE));
+    i2c_submit(bus, &transfer);
 
-    // specify that we are going to read from slave device
-    I2CMasterSlaveAddrSet(I2C0_BASE, ui8SlaveAddr, true);
+    // wait for the interrupt handler to finish the transaction
+    while(!transfer.DONE);
+}
 
-    // send control byte and read from the register we specified
-    I2CMasterControl(I2C0_BASE, I2C_MASTER_CMD_SINGLE_RECEIVE);
+/**
+ *  \brief Tiva I2C receive register data
+ *  
+ *  \param [in] bus I2C bus
+ *  \param [in] ui8SlaveAddr I2C slave address of the MPU6050 sensor
+ *  \param [in] ui8Reg Register address to read from
+ *  \return Received data from sensor
+ *  
+ *  Transmit a burst command with the register address and read
+ *  the incomming data.
+ */
+uint32_t i2c_receive(tI2C_BUS *bus, uint8_t ui8SlaveAddr, uint8_t ui8Reg)
+{
+    uint8_t data;
 
-    // wait for MCU to finish transaction
-    while(I2CMasterBusy(I2C0_BASE));
+    i2c_transferBlocking(bus, ui8SlaveAddr, ui8Reg, true, &data, 1);
+    return data;
+}
 
-    // return data pulled from the specified register
-    return I2CMasterDataGet(I2C0_BASE);
+/**
+ *  \brief Tiva I2C receive multiple register data
+ *  
+ *  \param [in] bus I2C bus
+ *  \param [in] ui8SlaveAddr I2C slave address of the MPU6050 sensor
+ *  \param [in] ui8Reg First register address to read from
+ *  \param [out] pui8Data Buffer to store the received data
+ *  \param [in] ui16Count Number of bytes to read
+ *  
+ *  Transmit the start register address and read ui16Count bytes with a
+ *  repeated start. The sensor auto increments the register address, so
+ *  consecutive registers are read within one bus transaction.
+ */
+void i2c_receiveBurst(tI2C_BUS *bus, uint8_t ui8SlaveAddr, uint8_t ui8Reg, uint8_t *pui8Data, uint16_t ui16Count)
+{
+    i2c_transferBlocking(bus, ui8SlaveAddr, ui8Reg, true, pui8Data, ui16Count);
 }
 
 /**
  *  \brief Tiva I2C write register data
  *  
+ *  \param [in] bus I2C bus
  *  \param [in] ui8SlaveAddr I2C slave address of the MPU6050 sensor
  *  \param [in] ui8Reg Register address to write
  *  \param [in] ui8Data Data to transmit into register
@@ -117,27 +365,54 @@ void i2c_initialization()
  *  Transmit two bytes. First databyte contain the register address where
  *  to store the new data. Second byte contains the data.
  */
-void i2c_write(uint8_t ui8SlaveAddr, uint8_t ui8Reg, uint8_t ui8Data)
+void i2c_write(tI2C_BUS *bus, uint8_t ui8SlaveAddr, uint8_t ui8Reg, uint8_t ui8Data)
+{
+    i2c_transferBlocking(bus, ui8SlaveAddr, ui8Reg, false, &ui8Data, 1);
+}
+
+/**
+ *  \brief Tiva I2C write multiple register data
+ *  
+ *  \param [in] bus I2C bus
+ *  \param [in] ui8SlaveAddr I2C slave address of the MPU6050 sensor
+ *  \param [in] ui8Reg First register address to write
+ *  \param [in] pui8Data Data to transmit into the registers
+ *  \param [in] ui16Count Number of bytes to write
+ *  
+ *  Transmit the start register address followed by all data bytes in
+ *  one bus transaction. The sensor auto increments the register address.
+ */
+void i2c_writeBurst(tI2C_BUS *bus, uint8_t ui8SlaveAddr, uint8_t ui8Reg, const uint8_t *pui8Data, uint16_t ui16Count)
 {
-    // Tell the master module what address it will be place on the bus when
-    // communicating with the slave
-    I2CMasterSlaveAddrSet(I2C0_BASE, ui8SlaveAddr, false);
+    // the driver only reads from the buffer of a write transfer
+    i2c_transferBlocking(bus, ui8SlaveAddr, ui8Reg, false, (uint8_t*)pui8Data, ui16Count);
+}
 
-    // put data to be sent into FIFO
-    I2CMasterDataPut(I2C0_BASE, ui8Reg);
+//--------------------------------------//
+// MPU6050 transport                    //
+//--------------------------------------//
 
-    // initiate send of data from the MCU
-    I2CMasterControl(I2C0_BASE, I2C_MASTER_CMD_BURST_SEND_START);
+static uint8_t i2c_transportRead(void *ctx, uint8_t ui8SlaveAddr, uint8_t ui8Reg)
+{
+    return (uint8_t)i2c_receive((tI2C_BUS*)ctx, ui8SlaveAddr, ui8Reg);
+}
 
-    // wait until MCU is done transferring.
-    while(I2CMasterBusy(I2C0_BASE));
+static void i2c_transportWrite(void *ctx, uint8_t ui8SlaveAddr, uint8_t ui8Reg, uint8_t ui8Data)
+{
+    i2c_write((tI2C_BUS*)ctx, ui8SlaveAddr, ui8Reg, ui8Data);
+}
 
-    // put next piece of data into I2C FIFO
-    I2CMasterDataPut(I2C0_BASE, ui8Data);
+static void i2c_transportReadBurst(void *ctx, uint8_t ui8SlaveAddr, uint8_t ui8Reg, uint8_t *pui8Data, uint16_t ui16Count)
+{
+    i2c_receiveBurst((tI2C_BUS*)ctx, ui8SlaveAddr, ui8Reg, pui8Data, ui16Count);
+}
 
-    // send next data that was just placed into FIFO
-    I2CMasterControl(I2C0_BASE, I2C_MASTER_CMD_BURST_SEND_FINISH);
+static void i2c_transportWriteBurst(void *ctx, uint8_t ui8SlaveAddr, uint8_t ui8Reg, const uint8_t *pui8Data, uint16_t ui16Count)
+{
+    i2c_writeBurst((tI2C_BUS*)ctx, ui8SlaveAddr, ui8Reg, pui8Data, ui16Count);
+}
 
-    // wait until MCU is done transferring.
-    while(I2CMasterBusy(I2C0_BASE));
-}
\ No newline at end of file
+static void i2c_transportSubmit(void *ctx, tMPU6050_TRANSFER *transfer)
+{
+    i2c_submit((tI2C_BUS*)ctx, transfer);
+}
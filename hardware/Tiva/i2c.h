@@ -28,13 +28,61 @@
 #include <stdbool.h>
 #include "inc/hw_i2c.h"
 #include "inc/hw_memmap.h"
+#include "inc/hw_ints.h"
 #include "driverlib/i2c.h"
+#include "driverlib/interrupt.h"
 #include "driverlib/sysctl.h"
 #include "driverlib/gpio.h"
 #include "driverlib/pin_map.h"
+#include "mpu6050_transport.h"
 
-void i2c_initialization();
-uint32_t i2c_receive(uint8_t ui8SlaveAddr, uint8_t ui8Reg);
-void i2c_write(uint8_t ui8SlaveAddr, uint8_t ui8Reg, uint8_t ui8Data);
+/**
+ *  \brief States of the transfer state machine
+ */
+typedef enum
+{
+    I2C_STATE_IDLE,     /**< No transfer active */
+    I2C_STATE_REG,      /**< Register address is being sent */
+    I2C_STATE_READ,     /**< Data bytes are being received */
+    I2C_STATE_WRITE     /**< Data bytes are being sent */
+}
+tI2C_STATE;
+
+/**
+ *  \brief I2C bus instance
+ *  
+ *  Hardware configuration and transfer queue of one I2C module.
+ */
+typedef struct
+{
+    tMPU6050_TRANSPORT transport;           /**< Transport to pass to mpu6050_devInitialization() */
+    uint32_t ui32SysctlPeriph;              /**< I2C peripheral */
+    uint32_t ui32Base;                      /**< I2C module base address */
+    uint32_t ui32GpioPeriph;                /**< GPIO port peripheral */
+    uint32_t ui32GpioBase;                  /**< GPIO port base address */
+    uint32_t ui32SclPinConfig;              /**< Pin mux configuration of SCL */
+    uint32_t ui32SdaPinConfig;              /**< Pin mux configuration of SDA */
+    uint8_t ui8SclPin;                      /**< SCL pin */
+    uint8_t ui8SdaPin;                      /**< SDA pin */
+    uint32_t ui32Int;                       /**< Interrupt number */
+    tMPU6050_TRANSFER *volatile queueHead;  /**< Active transfer */
+    tMPU6050_TRANSFER *volatile queueTail;  /**< Last queued transfer */
+    volatile tI2C_STATE state;              /**< State of the active transfer */
+    volatile uint16_t ui16Index;            /**< Data byte index of the active transfer */
+}
+tI2C_BUS;
+
+extern tI2C_BUS i2c_bus0;
+extern tI2C_BUS i2c_bus1;
+
+void i2c_initialization(tI2C_BUS *bus);
+uint32_t i2c_receive(tI2C_BUS *bus, uint8_t ui8SlaveAddr, uint8_t ui8Reg);
+void i2c_receiveBurst(tI2C_BUS *bus, uint8_t ui8SlaveAddr, uint8_t ui8Reg, uint8_t *pui8Data, uint16_t ui16Count);
+void i2c_write(tI2C_BUS *bus, uint8_t ui8SlaveAddr, uint8_t ui8Reg, uint8_t ui8Data);
+void i2c_writeBurst(tI2C_BUS *bus, uint8_t ui8SlaveAddr, uint8_t ui8Reg, const uint8_t *pui8Data, uint16_t ui16Count);
+void i2c_submit(tI2C_BUS *bus, tMPU6050_TRANSFER *transfer);
+void i2c_interruptHandler(tI2C_BUS *bus);
+void i2c0_interruptHandler(void);
+void i2c1_interruptHandler(void);
 
 #endif
\ No newline at end of file
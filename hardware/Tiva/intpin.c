@@ -0,0 +1,96 @@
+/*
+ * This file is part of the MPU6050-Library distribution (https://github.com/jmherzog-de/MPU6050-Library).
+ * Copyright (c) 2021 Jean-Marcel Herzog.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+/**
+ *  \file intpin.c
+ *  \brief Tiva INT pin
+ *  
+ *  Rising edge interrupt of the GPIO pin connected to the MPU6050 INT pin.
+ *  The sensor drives INT active high and push-pull as configured by
+ *  mpu6050_acqStart(), so no pull resistor is needed.
+ *  
+ *  intpin0 is the INT pin of the sensor on i2c_bus0, connected to PB4.
+ *  gpiob_interruptHandler() must be placed in the vector table for GPIO
+ *  port B.
+ *  
+ *  Example:
+ *  
+ *      static void intEdge(void *arg) { mpu6050_acqIntEdge((tMPU6050_ACQ*)arg); }
+ *      
+ *      intpin_initialization(&intpin0, intEdge, &acq);
+ *      mpu6050_acqStart(&dev, &acq, clock, sampleReady, 0);
+ *  
+ *  \copyright Copyright 2021 Jean-Marcel Herzog. All rights reserved. This project is released under the GNU Public License.
+ */
+
+#include "intpin.h"
+
+/**
+ *  \brief INT pin on PORTB at PIN4
+ */
+tINTPIN intpin0 =
+{
+    SYSCTL_PERIPH_GPIOB, GPIO_PORTB_BASE, GPIO_PIN_4,
+    INT_GPIOB,
+    0, 0
+};
+
+/**
+ *  \brief Tiva INT pin initialization
+ *  
+ *  \param [in] pin INT pin to initialize
+ *  \param [in] handler Edge handler
+ *  \param [in] arg Argument passed to the handler
+ *  
+ *  Configures the pin as input with a rising edge interrupt.
+ */
+void intpin_initialization(tINTPIN *pin, tINTPIN_HANDLER handler, void *arg)
+{
+    pin->handler = handler;
+    pin->arg = arg;
+
+    SysCtlPeripheralEnable(pin->ui32GpioPeriph);
+    while(!SysCtlPeripheralReady(pin->ui32GpioPeriph)){}
+
+    GPIOPinTypeGPIOInput(pin->ui32GpioBase, pin->ui8Pin);
+    GPIOIntTypeSet(pin->ui32GpioBase, pin->ui8Pin, GPIO_RISING_EDGE);
+    GPIOIntClear(pin->ui32GpioBase, pin->ui8Pin);
+    GPIOIntEnable(pin->ui32GpioBase, pin->ui8Pin);
+    IntEnable(pin->ui32Int);
+}
+
+/**
+ *  \brief Tiva INT pin interrupt handler
+ *  
+ *  \param [in] pin INT pin
+ */
+void intpin_interruptHandler(tINTPIN *pin)
+{
+    uint32_t status = GPIOIntStatus(pin->ui32GpioBase, true);
+
+    GPIOIntClear(pin->ui32GpioBase, status & pin->ui8Pin);
+
+    if((status & pin->ui8Pin) && pin->handler)
+        pin->handler(pin->arg);
+}
+
+/**
+ *  \brief GPIO port B interrupt vector
+ */
+void gpiob_interruptHandler(void)
+{
+    intpin_interruptHandler(&intpin0);
+}
@@ -0,0 +1,61 @@
+/*
+ * This file is part of the MPU6050-Library distribution (https://github.com/jmherzog-de/MPU6050-Library).
+ * Copyright (c) 2021 Jean-Marcel Herzog.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+/**
+ *  \file intpin.h
+ *  \brief Tiva INT pin headerfile
+ *  \copyright Copyright 2021 Jean-Marcel Herzog. All rights reserved. This project is released under the GNU Public License.
+ */
+
+#ifndef INTPIN_H_
+#define INTPIN_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "inc/hw_memmap.h"
+#include "inc/hw_ints.h"
+#include "driverlib/interrupt.h"
+#include "driverlib/sysctl.h"
+#include "driverlib/gpio.h"
+
+/**
+ *  \brief Handler of an INT pin edge
+ *  
+ *  Called from the GPIO interrupt, e.g. mpu6050_acqIntEdge().
+ */
+typedef void (*tINTPIN_HANDLER)(void *arg);
+
+/**
+ *  \brief GPIO pin connected to the INT pin of a sensor
+ */
+typedef struct
+{
+    uint32_t ui32GpioPeriph;            /**< GPIO port peripheral */
+    uint32_t ui32GpioBase;              /**< GPIO port base address */
+    uint8_t ui8Pin;                     /**< GPIO pin */
+    uint32_t ui32Int;                   /**< Interrupt number of the GPIO port */
+    tINTPIN_HANDLER handler;            /**< Edge handler */
+    void *arg;                          /**< Argument passed to the handler */
+}
+tINTPIN;
+
+extern tINTPIN intpin0;
+
+void intpin_initialization(tINTPIN *pin, tINTPIN_HANDLER handler, void *arg);
+void intpin_interruptHandler(tINTPIN *pin);
+void gpiob_interruptHandler(void);
+
+#endif
@@ -17,10 +17,36 @@
 
 /**
  *  \file uart.c
- *  \brief Brief description
+ *  \brief Tiva UART
  *  
  *  UART implementation for Tiva TM4C microcontrollers. It contain a function
- *  for UART hardware initialization, sending and receive data.
+ *  for UART hardware initialization and functions to send data.
+ *  
+ *  Transmission is interrupt driven: uart_write() copies the data into a
+ *  ring buffer of UART_TX_BUFFER_SIZE bytes and returns, the UART TX
+ *  interrupt moves it into the hardware FIFO whenever the FIFO is half
+ *  empty. If the ring buffer is full, the policy set with
+ *  uart_txPolicySet() decides: drop the oldest bytes (a live telemetry
+ *  stream keeps the latest data), drop the new write, or block until the
+ *  interrupt made room (the default, no data is lost). Both drop policies
+ *  buffer a write whole or not at all; a write larger than the buffer is
+ *  always dropped.
+ *  
+ *  uart0_interruptHandler() must be placed in the vector table for UART0.
+ *  
+ *  Example for the binary telemetry:
+ *  
+ *      static void telemetryWrite(const uint8_t *pui8Data, uint16_t ui16Count) { uart_write(pui8Data, ui16Count); }
+ *      
+ *      uart_initialization();
+ *      uart_txPolicySet(UART_TX_DROP_NEWEST);
+ *      telemetry_initialization(&tel, telemetryWrite);
+ *  
+ *  With UART_TX_DROP_NEWEST a frame that does not fit is discarded; the
+ *  sequence numbers show the loss. UART_TX_DROP_OLDEST cuts the oldest
+ *  queued frames instead, the first of them possibly in the middle while
+ *  its start is already on the line. The receiver sees a corrupt frame up
+ *  to the next delimiter, which fails the CRC and is rejected.
  *  
  *  \copyright Copyright 2021 Jean-Marcel Herzog. All rights reserved. This project is released under the GNU Public License.
  */
@@ -32,11 +58,26 @@
 #define UART_GPIO_PINS      (GPIO_PIN_0 | GPIO_PIN_1)
 #define UART_PORT_BASE      GPIO_PORTA_BASE
 #define UART_BASE           UART0_BASE
+#define UART_INT            INT_UART0
 #define UART_GPIO_RX        GPIO_PA0_U0RX
 #define UART_GPIO_TX        GPIO_PA1_U0TX
+#ifndef UART_BAUDRATE
 #define UART_BAUDRATE       115200
+#endif
 #define UART_CONFIG         (UART_CONFIG_WLEN_8 | UART_CONFIG_STOP_ONE | UART_CONFIG_PAR_NONE)
 
+#define UART_TX_MASK        (UART_TX_BUFFER_SIZE - 1)
+
+#if (UART_TX_BUFFER_SIZE & UART_TX_MASK) || UART_TX_BUFFER_SIZE > 32768
+#error "UART_TX_BUFFER_SIZE must be a power of two up to 32768"
+#endif
+
+static uint8_t txBuffer[UART_TX_BUFFER_SIZE];
+static volatile uint16_t txHead;    /**< Next index to write */
+static volatile uint16_t txTail;    /**< Next index to send */
+static volatile uint8_t txPolicy = UART_TX_BLOCK;
+static volatile tUART_TX_STATS txStats;
+
 /**
  *  \brief Tiva UART hardware initialization
  *  
@@ -49,8 +90,157 @@ void uart_initialization()
     SysCtlPeripheralEnable(UART_PERIPH_GPIO);
     GPIOPinConfigure(UART_GPIO_RX);
     GPIOPinConfigure(UART_GPIO_TX);
-    GPIOPinTypeUART(UART_PORT_BASE, UART_CLOCK_SYSTEM);
+    GPIOPinTypeUART(UART_PORT_BASE, UART_GPIO_PINS);
     UARTConfigSetExpClk(UART_BASE, SysCtlClockGet(), UART_BAUDRATE, UART_CONFIG);
+
+    // interrupt when the TX FIFO drops to half full, enabled while data is pending
+    txHead = txTail = 0;
+    UARTFIFOEnable(UART_BASE);
+    UARTFIFOLevelSet(UART_BASE, UART_FIFO_TX4_8, UART_FIFO_RX4_8);
+    UARTTxIntModeSet(UART_BASE, UART_TXINT_MODE_FIFO);
+    UARTIntDisable(UART_BASE, UART_INT_TX);
+    UARTIntClear(UART_BASE, UART_INT_TX);
+    IntEnable(UART_INT);
+}
+
+/**
+ *  \brief Set the full buffer policy
+ *  
+ *  \param [in] ui8Policy UART_TX_DROP_OLDEST, UART_TX_DROP_NEWEST or UART_TX_BLOCK
+ *  
+ *  \details With UART_TX_BLOCK, uart_write() called from an interrupt
+ *  handler with a priority at or above the UART interrupt busy-waits on
+ *  the hardware FIFO.
+ */
+void uart_txPolicySet(uint8_t ui8Policy)
+{
+    txPolicy = ui8Policy;
+}
+
+/**
+ *  \brief Move buffered bytes into the hardware FIFO
+ *  
+ *  Runs in the interrupt handler or with interrupts disabled. Disables the
+ *  TX interrupt when the buffer is empty.
+ */
+static void uart_txPump(void)
+{
+    uint16_t tail = txTail;
+
+    while(tail != txHead && UARTSpaceAvail(UART_BASE))
+    {
+        UARTCharPutNonBlocking(UART_BASE, txBuffer[tail]);
+        tail = (tail + 1) & UART_TX_MASK;
+        txStats.BYTES_SENT++;
+    }
+    txTail = tail;
+
+    if(tail == txHead)
+        UARTIntDisable(UART_BASE, UART_INT_TX);
+    else
+        UARTIntEnable(UART_BASE, UART_INT_TX);
+}
+
+/**
+ *  \brief Number of free bytes in the transmit buffer
+ */
+uint16_t uart_txFree(void)
+{
+    return (uint16_t)(UART_TX_MASK - ((txHead - txTail) & UART_TX_MASK));
+}
+
+/**
+ *  \brief Tiva UART send data
+ *  
+ *  \param [in] pui8Data Data to transmit
+ *  \param [in] ui16Count Number of bytes
+ *  \return Number of bytes buffered, 0 if the full buffer policy dropped the write
+ *  
+ *  Copies the data into the transmit buffer and starts the transmission.
+ *  Returns without waiting unless the buffer is full and the policy is
+ *  UART_TX_BLOCK. Can be called from interrupt handlers.
+ */
+uint16_t uart_write(const uint8_t *pui8Data, uint16_t ui16Count)
+{
+    uint16_t n = 0, free;
+    bool masked;
+
+    while(n < ui16Count)
+    {
+        masked = IntMasterDisable();
+
+        free = uart_txFree();
+        if(free < ui16Count - n && txPolicy != UART_TX_BLOCK)
+        {
+            // nothing is buffered yet (n == 0): keep the write whole
+            if(txPolicy == UART_TX_DROP_OLDEST && ui16Count <= UART_TX_MASK)
+            {
+                txTail = (txTail + ui16Count - free) & UART_TX_MASK;
+                txStats.BYTES_DROPPED += ui16Count - free;
+                free = ui16Count;
+            }
+            else
+            {
+                txStats.BYTES_DROPPED += ui16Count;
+                ui16Count = 0;
+            }
+        }
+
+        // copy as much as fits in one go
+        while(free-- && n < ui16Count)
+        {
+            txBuffer[txHead] = pui8Data[n++];
+            txHead = (txHead + 1) & UART_TX_MASK;
+        }
+        uart_txPump();
+
+        if(!masked)
+            IntMasterEnable();
+
+        // UART_TX_BLOCK: wait for room. Pump with interrupts masked, the
+        // UART interrupt can not run if the caller is a handler at or above its priority
+        while(n < ui16Count && uart_txFree() == 0)
+        {
+            masked = IntMasterDisable();
+            uart_txPump();
+            if(!masked)
+                IntMasterEnable();
+        }
+    }
+
+    return n;
+}
+
+/**
+ *  \brief Wait until all buffered bytes are handed to the UART
+ *  
+ *  \details Waits until the transmitter is idle, so the last byte is on the line.
+ *  Can be called from interrupt handlers.
+ */
+void uart_flush(void)
+{
+    bool masked;
+
+    // pump with interrupts masked like uart_write(), the UART interrupt may not run
+    while(txTail != txHead)
+    {
+        masked = IntMasterDisable();
+        uart_txPump();
+        if(!masked)
+            IntMasterEnable();
+    }
+    while(UARTBusy(UART_BASE)){}
+}
+
+/**
+ *  \brief Get the transmit statistics
+ *  
+ *  \param [in] stats Datatype pointer to return the statistics
+ */
+void uart_txStatsGet(tUART_TX_STATS *stats)
+{
+    stats->BYTES_SENT = txStats.BYTES_SENT;
+    stats->BYTES_DROPPED = txStats.BYTES_DROPPED;
 }
 
 /**
@@ -63,10 +253,13 @@ void uart_initialization()
  */
 void uart_puts(const unsigned char* pucBuffer)
 {
-    while(*pucBuffer != '\0')
-        UARTCharPut(UART_BASE, *pucBuffer);
+    const unsigned char *end = pucBuffer;
+
+    while(*end != '\0')
+        end++;
 
-    UARTCharPut(UART_BASE, '\n');
+    uart_write(pucBuffer, (uint16_t)(end - pucBuffer));
+    uart_putc('\n');
 }
 
 /**
@@ -78,5 +271,14 @@ void uart_puts(const unsigned char* pucBuffer)
  */
 void uart_putc(unsigned char character)
 {
-    UARTCharPut(UART_BASE, character);
+    uart_write(&character, 1);
+}
+
+/**
+ *  \brief UART0 interrupt vector
+ */
+void uart0_interruptHandler(void)
+{
+    UARTIntClear(UART_BASE, UARTIntStatus(UART_BASE, true));
+    uart_txPump();
 }
\ No newline at end of file
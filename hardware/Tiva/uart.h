@@ -14,7 +14,7 @@
  * You should have received a copy of the GNU General Public License
  * along with this program. If not, see <http://www.gnu.org/licenses/>.
  */
- 
+
  /**
  *  \file uart.h
  *  \brief Tiva UART headerfile
@@ -27,14 +27,40 @@
 #include <stdint.h>
 #include <stdbool.h>
 #include "inc/hw_memmap.h"
+#include "inc/hw_ints.h"
+#include "driverlib/interrupt.h"
 #include "driverlib/sysctl.h"
 #include "driverlib/gpio.h"
 #include "driverlib/pin_map.h"
 #include "driverlib/uart.h"
 #include "uart_ascii.h"
 
+#ifndef UART_TX_BUFFER_SIZE
+#define UART_TX_BUFFER_SIZE     1024    /**< Size of the transmit ring buffer, a power of two */
+#endif
+
+#define UART_TX_DROP_OLDEST     0       /**< Full buffer: discard the oldest bytes not yet sent to make room for the whole write */
+#define UART_TX_DROP_NEWEST     1       /**< Full buffer: discard the whole write if it does not fit */
+#define UART_TX_BLOCK           2       /**< Full buffer: wait until the interrupt made room */
+
+/**
+ *  \brief Transmit statistics
+ */
+typedef struct
+{
+    uint32_t BYTES_SENT;        /**< Bytes handed to the UART */
+    uint32_t BYTES_DROPPED;     /**< Bytes discarded by the full buffer policy */
+}
+tUART_TX_STATS;
+
 void uart_initialization();
+void uart_txPolicySet(uint8_t ui8Policy);
+uint16_t uart_write(const uint8_t *pui8Data, uint16_t ui16Count);
+uint16_t uart_txFree(void);
+void uart_flush(void);
+void uart_txStatsGet(tUART_TX_STATS *stats);
 void uart_puts(const unsigned char* pucBuffer);
 void uart_putc(unsigned char character);
+void uart0_interruptHandler(void);
 
 #endif
\ No newline at end of file
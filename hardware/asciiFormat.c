@@ -0,0 +1,391 @@
+/*
+ * This file is part of the MPU6050-Library distribution (https://github.com/jmherzog-de/MPU6050-Library).
+ * Copyright (c) 2021 Jean-Marcel Herzog.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ *  \file asciiFormat.c
+ *  \brief ASCII Formatting
+ *  
+ *  Renders numbers as ASCII text into a caller buffer. Decimals are
+ *  converted two digits at a time: one division by 100 and a lookup in a
+ *  table of the digit pairs "00" to "99", so a 16 bit value needs at most
+ *  three divisions. Hex values use a table of the byte values "00" to "FF".
+ *  
+ *  The ascii_format* functions write to a plain buffer and return the end
+ *  of the text. The ascii_put* functions append to a record (e.g. one CSV
+ *  line), which is sent with one bulk transmit call, see uart_putRecord().
+ *  A value that does not fit into the record is left out and flagged.
+ *  
+ *  \copyright Copyright 2021 Jean-Marcel Herzog. All rights reserved. This project is released under the GNU Public License.
+ */
+
+#include <string.h>
+#include "asciiFormat.h"
+
+/** Decimal digit pairs "00" to "99" */
+static const char digitPairs[200] =
+    "00010203040506070809"
+    "10111213141516171819"
+    "20212223242526272829"
+    "30313233343536373839"
+    "40414243444546474849"
+    "50515253545556575859"
+    "60616263646566676869"
+    "70717273747576777879"
+    "80818283848586878889"
+    "90919293949596979899";
+
+/** Hex digit pairs "00" to "FF" */
+static const char hexPairs[512] =
+    "000102030405060708090A0B0C0D0E0F"
+    "101112131415161718191A1B1C1D1E1F"
+    "202122232425262728292A2B2C2D2E2F"
+    "303132333435363738393A3B3C3D3E3F"
+    "404142434445464748494A4B4C4D4E4F"
+    "505152535455565758595A5B5C5D5E5F"
+    "606162636465666768696A6B6C6D6E6F"
+    "707172737475767778797A7B7C7D7E7F"
+    "808182838485868788898A8B8C8D8E8F"
+    "909192939495969798999A9B9C9D9E9F"
+    "A0A1A2A3A4A5A6A7A8A9AAABACADAEAF"
+    "B0B1B2B3B4B5B6B7B8B9BABBBCBDBEBF"
+    "C0C1C2C3C4C5C6C7C8C9CACBCCCDCECF"
+    "D0D1D2D3D4D5D6D7D8D9DADBDCDDDEDF"
+    "E0E1E2E3E4E5E6E7E8E9EAEBECEDEEEF"
+    "F0F1F2F3F4F5F6F7F8F9FAFBFCFDFEFF";
+
+/** Powers of ten for the fixed-point decimals */
+static const uint32_t powersOf10[10] =
+{
+    1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000, 1000000000
+};
+
+/**
+ *  \brief Render an unsigned decimal
+ *  
+ *  \param [in] pcDst Buffer for at least ASCII_U32_MAX characters
+ *  \param [in] ui32Val Value
+ *  \return End of the text (not terminated)
+ */
+char *ascii_formatU32(char *pcDst, uint32_t ui32Val)
+{
+    char tmp[ASCII_U32_MAX];
+    char *t = tmp + ASCII_U32_MAX;
+    uint32_t q;
+    uint8_t len;
+
+    while(ui32Val >= 100)
+    {
+        q = ui32Val / 100;
+        t -= 2;
+        memcpy(t, &digitPairs[2 * (ui32Val - q * 100)], 2);
+        ui32Val = q;
+    }
+
+    if(ui32Val >= 10)
+    {
+        t -= 2;
+        memcpy(t, &digitPairs[2 * ui32Val], 2);
+    }
+    else
+    {
+        *--t = (char)('0' + ui32Val);
+    }
+
+    len = (uint8_t)(tmp + ASCII_U32_MAX - t);
+    memcpy(pcDst, t, len);
+    return pcDst + len;
+}
+
+/**
+ *  \brief Render a signed decimal
+ *  
+ *  \param [in] pcDst Buffer for at least ASCII_S32_MAX characters
+ *  \param [in] i32Val Value
+ *  \return End of the text (not terminated)
+ */
+char *ascii_formatS32(char *pcDst, int32_t i32Val)
+{
+    uint32_t magnitude = (uint32_t)i32Val;
+
+    if(i32Val < 0)
+    {
+        *pcDst++ = '-';
+        magnitude = 0u - magnitude;
+    }
+
+    return ascii_formatU32(pcDst, magnitude);
+}
+
+/**
+ *  \brief Render a fixed-point decimal
+ *  
+ *  \param [in] pcDst Buffer for at least ASCII_FIXED_MAX characters
+ *  \param [in] i32Val Value in units of 10^-ui8Decimals, e.g. 12345 with 3 decimals is 12.345
+ *  \param [in] ui8Decimals Number of decimals, up to 9
+ *  \return End of the text (not terminated)
+ */
+char *ascii_formatFixed(char *pcDst, int32_t i32Val, uint8_t ui8Decimals)
+{
+    uint32_t magnitude = (uint32_t)i32Val;
+    uint32_t integer, fraction;
+    char *end;
+    uint8_t len;
+
+    if(ui8Decimals == 0)
+        return ascii_formatS32(pcDst, i32Val);
+    if(ui8Decimals > 9)
+        ui8Decimals = 9;
+
+    if(i32Val < 0)
+    {
+        *pcDst++ = '-';
+        magnitude = 0u - magnitude;
+    }
+
+    integer = magnitude / powersOf10[ui8Decimals];
+    fraction = magnitude - integer * powersOf10[ui8Decimals];
+
+    pcDst = ascii_formatU32(pcDst, integer);
+    *pcDst++ = '.';
+
+    // leading zeros of the fraction
+    end = ascii_formatU32(pcDst, fraction);
+    len = (uint8_t)(end - pcDst);
+    if(len < ui8Decimals)
+    {
+        memmove(pcDst + ui8Decimals - len, pcDst, len);
+        memset(pcDst, '0', ui8Decimals - len);
+    }
+
+    return pcDst + ui8Decimals;
+}
+
+/**
+ *  \brief Render a hex value with upper case digits
+ *  
+ *  \param [in] pcDst Buffer for at least ui8Digits characters
+ *  \param [in] ui32Val Value
+ *  \param [in] ui8Digits Number of digits, 1 to 8, with leading zeros
+ *  \return End of the text (not terminated)
+ */
+char *ascii_formatHex(char *pcDst, uint32_t ui32Val, uint8_t ui8Digits)
+{
+    char *t;
+
+    if(ui8Digits == 0)
+        ui8Digits = 1;
+    if(ui8Digits > 8)
+        ui8Digits = 8;
+
+    t = pcDst + ui8Digits;
+    while(t - pcDst >= 2)
+    {
+        t -= 2;
+        memcpy(t, &hexPairs[2 * (ui32Val & 0xFF)], 2);
+        ui32Val >>= 8;
+    }
+    if(t != pcDst)
+        *pcDst = hexPairs[2 * (ui32Val & 0x0F) + 1];
+
+    return pcDst + ui8Digits;
+}
+
+/**
+ *  \brief Record initialization
+ *  
+ *  \param [in] rec Record
+ *  \param [in] pcBuffer Buffer of the record
+ *  \param [in] ui16Size Size of pcBuffer
+ */
+void ascii_recordInitialization(tASCII_RECORD *rec, char *pcBuffer, uint16_t ui16Size)
+{
+    rec->pcBuffer = pcBuffer;
+    rec->ui16Size = ui16Size;
+    ascii_recordClear(rec);
+}
+
+/**
+ *  \brief Empty a record for the next one
+ *  
+ *  \param [in] rec Record
+ */
+void ascii_recordClear(tASCII_RECORD *rec)
+{
+    rec->ui16Len = 0;
+    rec->bOverflow = false;
+}
+
+/**
+ *  \brief Check the space for a value of up to ui16Max characters
+ */
+static char *ascii_recordSpace(tASCII_RECORD *rec, uint16_t ui16Max)
+{
+    if(rec->ui16Size - rec->ui16Len < ui16Max)
+    {
+        rec->bOverflow = true;
+        return 0;
+    }
+
+    return rec->pcBuffer + rec->ui16Len;
+}
+
+/**
+ *  \brief Append a character
+ *  
+ *  \param [in] rec Record
+ *  \param [in] cVal Character
+ */
+void ascii_putChar(tASCII_RECORD *rec, char cVal)
+{
+    char *p = ascii_recordSpace(rec, 1);
+
+    if(p)
+    {
+        *p = cVal;
+        rec->ui16Len++;
+    }
+}
+
+/**
+ *  \brief Append a string
+ *  
+ *  \param [in] rec Record
+ *  \param [in] pcVal Zero terminated string
+ */
+void ascii_putString(tASCII_RECORD *rec, const char *pcVal)
+{
+    uint16_t len = (uint16_t)strlen(pcVal);
+    char *p = ascii_recordSpace(rec, len);
+
+    if(p)
+    {
+        memcpy(p, pcVal, len);
+        rec->ui16Len += len;
+    }
+}
+
+/**
+ *  \brief Append an unsigned decimal
+ *  
+ *  \param [in] rec Record
+ *  \param [in] ui32Val Value
+ */
+void ascii_putU32(tASCII_RECORD *rec, uint32_t ui32Val)
+{
+    char *p = ascii_recordSpace(rec, ASCII_U32_MAX);
+
+    if(p)
+        rec->ui16Len = (uint16_t)(ascii_formatU32(p, ui32Val) - rec->pcBuffer);
+}
+
+/**
+ *  \brief Append a signed decimal
+ *  
+ *  \param [in] rec Record
+ *  \param [in] i32Val Value
+ */
+void ascii_putS32(tASCII_RECORD *rec, int32_t i32Val)
+{
+    char *p = ascii_recordSpace(rec, ASCII_S32_MAX);
+
+    if(p)
+        rec->ui16Len = (uint16_t)(ascii_formatS32(p, i32Val) - rec->pcBuffer);
+}
+
+/**
+ *  \brief Append a fixed-point decimal
+ *  
+ *  \param [in] rec Record
+ *  \param [in] i32Val Value in units of 10^-ui8Decimals
+ *  \param [in] ui8Decimals Number of decimals, up to 9
+ */
+void ascii_putFixed(tASCII_RECORD *rec, int32_t i32Val, uint8_t ui8Decimals)
+{
+    char *p = ascii_recordSpace(rec, ASCII_FIXED_MAX);
+
+    if(p)
+        rec->ui16Len = (uint16_t)(ascii_formatFixed(p, i32Val, ui8Decimals) - rec->pcBuffer);
+}
+
+/**
+ *  \brief Append a Q16.16 value as decimal
+ *  
+ *  \param [in] rec Record
+ *  \param [in] i32Q16 Value in Q16.16, see mpu6050_fixedMeasurements.h
+ *  \param [in] ui8Decimals Number of decimals, up to 4
+ *  
+ *  \details The value is rounded to the last decimal.
+ */
+void ascii_putQ16(tASCII_RECORD *rec, int32_t i32Q16, uint8_t ui8Decimals)
+{
+    int64_t scaled;
+
+    if(ui8Decimals > 4)
+        ui8Decimals = 4;
+
+    scaled = (int64_t)i32Q16 * powersOf10[ui8Decimals];
+    scaled = (scaled + (scaled < 0 ? -32768 : 32768)) / 65536;
+    ascii_putFixed(rec, (int32_t)scaled, ui8Decimals);
+}
+
+/**
+ *  \brief Append a hex value with upper case digits
+ *  
+ *  \param [in] rec Record
+ *  \param [in] ui32Val Value
+ *  \param [in] ui8Digits Number of digits, 1 to 8, with leading zeros
+ */
+void ascii_putHex(tASCII_RECORD *rec, uint32_t ui32Val, uint8_t ui8Digits)
+{
+    char *p = ascii_recordSpace(rec, 8);
+
+    if(p)
+        rec->ui16Len = (uint16_t)(ascii_formatHex(p, ui32Val, ui8Digits) - rec->pcBuffer);
+}
+
+/**
+ *  \brief Append a raw sample as seven decimals
+ *  
+ *  \param [in] rec Record
+ *  \param [in] sample Sample
+ *  \param [in] cSeparator Character between the values, e.g. ','
+ *  
+ *  \details Order: accelerometer x, y, z, temperature, gyroscope x, y, z.
+ */
+void ascii_putMotion(tASCII_RECORD *rec, const tMPU6050_MOTION *sample, char cSeparator)
+{
+    char *p = ascii_recordSpace(rec, 7 * 7);
+
+    if(!p)
+        return;
+
+    p = ascii_formatS32(p, sample->ACCEL.X);
+    *p++ = cSeparator;
+    p = ascii_formatS32(p, sample->ACCEL.Y);
+    *p++ = cSeparator;
+    p = ascii_formatS32(p, sample->ACCEL.Z);
+    *p++ = cSeparator;
+    p = ascii_formatS32(p, sample->TEMP);
+    *p++ = cSeparator;
+    p = ascii_formatS32(p, sample->GYRO.X);
+    *p++ = cSeparator;
+    p = ascii_formatS32(p, sample->GYRO.Y);
+    *p++ = cSeparator;
+    p = ascii_formatS32(p, sample->GYRO.Z);
+
+    rec->ui16Len = (uint16_t)(p - rec->pcBuffer);
+}
\ No newline at end of file
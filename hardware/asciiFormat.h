@@ -0,0 +1,63 @@
+/*
+ * This file is part of the MPU6050-Library distribution (https://github.com/jmherzog-de/MPU6050-Library).
+ * Copyright (c) 2021 Jean-Marcel Herzog.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ *  \file asciiFormat.h
+ *  \brief ASCII Formatting headerfile
+ *  \copyright Copyright 2021 Jean-Marcel Herzog. All rights reserved. This project is released under the GNU Public License.
+ */
+
+#ifndef ASCIIFORMAT_H_
+#define ASCIIFORMAT_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "mpu6050_motionMeasurements.h"
+
+#define ASCII_U32_MAX       10      /**< Longest unsigned 32 bit decimal */
+#define ASCII_S32_MAX       11      /**< Longest signed 32 bit decimal */
+#define ASCII_FIXED_MAX     21      /**< Longest fixed-point decimal with 9 decimals */
+
+/**
+ *  \brief Text record rendered into a caller buffer
+ */
+typedef struct
+{
+    char *pcBuffer;         /**< Buffer of the record */
+    uint16_t ui16Size;      /**< Size of pcBuffer */
+    uint16_t ui16Len;       /**< Number of characters in the record */
+    bool bOverflow;         /**< A value did not fit and was left out */
+}
+tASCII_RECORD;
+
+extern char *ascii_formatU32(char *pcDst, uint32_t ui32Val);
+extern char *ascii_formatS32(char *pcDst, int32_t i32Val);
+extern char *ascii_formatFixed(char *pcDst, int32_t i32Val, uint8_t ui8Decimals);
+extern char *ascii_formatHex(char *pcDst, uint32_t ui32Val, uint8_t ui8Digits);
+
+extern void ascii_recordInitialization(tASCII_RECORD*, char *pcBuffer, uint16_t ui16Size);
+extern void ascii_recordClear(tASCII_RECORD*);
+extern void ascii_putChar(tASCII_RECORD*, char cVal);
+extern void ascii_putString(tASCII_RECORD*, const char *pcVal);
+extern void ascii_putU32(tASCII_RECORD*, uint32_t ui32Val);
+extern void ascii_putS32(tASCII_RECORD*, int32_t i32Val);
+extern void ascii_putFixed(tASCII_RECORD*, int32_t i32Val, uint8_t ui8Decimals);
+extern void ascii_putQ16(tASCII_RECORD*, int32_t i32Q16, uint8_t ui8Decimals);
+extern void ascii_putHex(tASCII_RECORD*, uint32_t ui32Val, uint8_t ui8Digits);
+extern void ascii_putMotion(tASCII_RECORD*, const tMPU6050_MOTION *sample, char cSeparator);
+
+#endif
\ No newline at end of file
@@ -0,0 +1,496 @@
+/*
+ * This file is part of the MPU6050-Library distribution (https://github.com/jmherzog-de/MPU6050-Library).
+ * Copyright (c) 2021 Jean-Marcel Herzog.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ *  \file telemetry.c
+ *  \brief Binary Telemetry
+ *  
+ *  Compact binary framing for streaming samples over a serial link. A frame
+ *  before encoding is
+ *  
+ *  | Byte      | Content                                       |
+ *  |:---------:|:---------------------------------------------:|
+ *  | 0         | Channel                                       |
+ *  | 1         | Sequence number, counts frames per channel    |
+ *  | 2..n+1    | Payload, up to TELEMETRY_PAYLOAD_MAX bytes    |
+ *  | n+2, n+3  | CRC-16/CCITT of bytes 0..n+1, little endian   |
+ *  
+ *  The frame is COBS encoded (Consistent Overhead Byte Stuffing), which
+ *  removes all zero bytes at a cost of one byte for frames up to 254 bytes,
+ *  and terminated with a zero byte. A receiver synchronizes at the next zero
+ *  byte after any error. A frame costs 6 bytes on top of its payload, so a
+ *  frame of 17 raw samples needs 1.03 wire bytes per payload byte where the
+ *  ASCII hex output of uart_ascii.c needs about 3.
+ *  
+ *  The encoder runs on the target and hands every frame to a byte sink in
+ *  one call. The decoder is byte driven and runs on the host.
+ *  
+ *  \copyright Copyright 2021 Jean-Marcel Herzog. All rights reserved. This project is released under the GNU Public License.
+ */
+
+#include <string.h>
+#include "telemetry.h"
+
+/** Raw samples per frame */
+#define TELEMETRY_RAW_PER_FRAME     (TELEMETRY_PAYLOAD_MAX / TELEMETRY_RAW_SIZE)
+/** Scaled samples per frame */
+#define TELEMETRY_SCALED_PER_FRAME  (TELEMETRY_PAYLOAD_MAX / TELEMETRY_SCALED_SIZE)
+/** Largest frame before COBS encoding */
+#define TELEMETRY_FRAME_MAX         (TELEMETRY_HEADER_SIZE + TELEMETRY_PAYLOAD_MAX + TELEMETRY_CRC_SIZE)
+
+/** CRC-16/CCITT (polynomial 0x1021) lookup table */
+static const uint16_t crcTable[256] =
+{
+    0x0000, 0x1021, 0x2042, 0x3063, 0x4084, 0x50A5, 0x60C6, 0x70E7,
+    0x8108, 0x9129, 0xA14A, 0xB16B, 0xC18C, 0xD1AD, 0xE1CE, 0xF1EF,
+    0x1231, 0x0210, 0x3273, 0x2252, 0x52B5, 0x4294, 0x72F7, 0x62D6,
+    0x9339, 0x8318, 0xB37B, 0xA35A, 0xD3BD, 0xC39C, 0xF3FF, 0xE3DE,
+    0x2462, 0x3443, 0x0420, 0x1401, 0x64E6, 0x74C7, 0x44A4, 0x5485,
+    0xA56A, 0xB54B, 0x8528, 0x9509, 0xE5EE, 0xF5CF, 0xC5AC, 0xD58D,
+    0x3653, 0x2672, 0x1611, 0x0630, 0x76D7, 0x66F6, 0x5695, 0x46B4,
+    0xB75B, 0xA77A, 0x9719, 0x8738, 0xF7DF, 0xE7FE, 0xD79D, 0xC7BC,
+    0x48C4, 0x58E5, 0x6886, 0x78A7, 0x0840, 0x1861, 0x2802, 0x3823,
+    0xC9CC, 0xD9ED, 0xE98E, 0xF9AF, 0x8948, 0x9969, 0xA90A, 0xB92B,
+    0x5AF5, 0x4AD4, 0x7AB7, 0x6A96, 0x1A71, 0x0A50, 0x3A33, 0x2A12,
+    0xDBFD, 0xCBDC, 0xFBBF, 0xEB9E, 0x9B79, 0x8B58, 0xBB3B, 0xAB1A,
+    0x6CA6, 0x7C87, 0x4CE4, 0x5CC5, 0x2C22, 0x3C03, 0x0C60, 0x1C41,
+    0xEDAE, 0xFD8F, 0xCDEC, 0xDDCD, 0xAD2A, 0xBD0B, 0x8D68, 0x9D49,
+    0x7E97, 0x6EB6, 0x5ED5, 0x4EF4, 0x3E13, 0x2E32, 0x1E51, 0x0E70,
+    0xFF9F, 0xEFBE, 0xDFDD, 0xCFFC, 0xBF1B, 0xAF3A, 0x9F59, 0x8F78,
+    0x9188, 0x81A9, 0xB1CA, 0xA1EB, 0xD10C, 0xC12D, 0xF14E, 0xE16F,
+    0x1080, 0x00A1, 0x30C2, 0x20E3, 0x5004, 0x4025, 0x7046, 0x6067,
+    0x83B9, 0x9398, 0xA3FB, 0xB3DA, 0xC33D, 0xD31C, 0xE37F, 0xF35E,
+    0x02B1, 0x1290, 0x22F3, 0x32D2, 0x4235, 0x5214, 0x6277, 0x7256,
+    0xB5EA, 0xA5CB, 0x95A8, 0x8589, 0xF56E, 0xE54F, 0xD52C, 0xC50D,
+    0x34E2, 0x24C3, 0x14A0, 0x0481, 0x7466, 0x6447, 0x5424, 0x4405,
+    0xA7DB, 0xB7FA, 0x8799, 0x97B8, 0xE75F, 0xF77E, 0xC71D, 0xD73C,
+    0x26D3, 0x36F2, 0x0691, 0x16B0, 0x6657, 0x7676, 0x4615, 0x5634,
+    0xD94C, 0xC96D, 0xF90E, 0xE92F, 0x99C8, 0x89E9, 0xB98A, 0xA9AB,
+    0x5844, 0x4865, 0x7806, 0x6827, 0x18C0, 0x08E1, 0x3882, 0x28A3,
+    0xCB7D, 0xDB5C, 0xEB3F, 0xFB1E, 0x8BF9, 0x9BD8, 0xABBB, 0xBB9A,
+    0x4A75, 0x5A54, 0x6A37, 0x7A16, 0x0AF1, 0x1AD0, 0x2AB3, 0x3A92,
+    0xFD2E, 0xED0F, 0xDD6C, 0xCD4D, 0xBDAA, 0xAD8B, 0x9DE8, 0x8DC9,
+    0x7C26, 0x6C07, 0x5C64, 0x4C45, 0x3CA2, 0x2C83, 0x1CE0, 0x0CC1,
+    0xEF1F, 0xFF3E, 0xCF5D, 0xDF7C, 0xAF9B, 0xBFBA, 0x8FD9, 0x9FF8,
+    0x6E17, 0x7E36, 0x4E55, 0x5E74, 0x2E93, 0x3EB2, 0x0ED1, 0x1EF0
+};
+
+/**
+ *  \brief CRC-16/CCITT
+ *  
+ *  \param [in] pui8Data Data
+ *  \param [in] ui16Count Number of bytes
+ *  \param [in] ui16Crc Initial value: 0xFFFF, or the CRC of the preceding data
+ *  \return CRC
+ */
+uint16_t telemetry_crc16(const uint8_t *pui8Data, uint16_t ui16Count, uint16_t ui16Crc)
+{
+    while(ui16Count--)
+        ui16Crc = (uint16_t)(ui16Crc << 8) ^ crcTable[(ui16Crc >> 8) ^ *pui8Data++];
+
+    return ui16Crc;
+}
+
+/**
+ *  \brief COBS encoding
+ *  
+ *  \return Number of encoded bytes, at most ui16Count + 1 for ui16Count < 254
+ */
+static uint16_t telemetry_cobsEncode(const uint8_t *pui8Src, uint16_t ui16Count, uint8_t *pui8Dst)
+{
+    uint16_t codeIndex = 0, w = 1, r;
+    uint8_t code = 1;
+
+    for(r = 0; r < ui16Count; r++)
+    {
+        if(pui8Src[r])
+        {
+            pui8Dst[w++] = pui8Src[r];
+            code++;
+        }
+
+        if(!pui8Src[r] || code == 0xFF)
+        {
+            pui8Dst[codeIndex] = code;
+            code = 1;
+            codeIndex = w++;
+        }
+    }
+    pui8Dst[codeIndex] = code;
+
+    return w;
+}
+
+/**
+ *  \brief COBS decoding
+ *  
+ *  \return Number of decoded bytes, 0 for invalid data
+ */
+static uint16_t telemetry_cobsDecode(const uint8_t *pui8Src, uint16_t ui16Count, uint8_t *pui8Dst, uint16_t ui16Max)
+{
+    uint16_t r = 0, w = 0;
+    uint8_t code, i;
+
+    while(r < ui16Count)
+    {
+        code = pui8Src[r++];
+        if(code == 0 || r + code - 1 > ui16Count || w + code - 1 > ui16Max)
+            return 0;
+
+        for(i = 1; i < code; i++)
+            pui8Dst[w++] = pui8Src[r++];
+
+        if(code != 0xFF && r < ui16Count)
+        {
+            if(w == ui16Max)
+                return 0;
+            pui8Dst[w++] = 0;
+        }
+    }
+
+    return w;
+}
+
+/**
+ *  \brief Encode one frame
+ *  
+ *  \param [in] ui8Channel Channel
+ *  \param [in] ui8Seq Sequence number
+ *  \param [in] pui8Payload Payload
+ *  \param [in] ui16Count Payload length, at most TELEMETRY_PAYLOAD_MAX
+ *  \param [in] pui8Wire Buffer of TELEMETRY_WIRE_MAX bytes to return the frame
+ *  \return Number of bytes on the wire including the delimiter, 0 if the payload is too long
+ */
+uint16_t telemetry_frameEncode(uint8_t ui8Channel, uint8_t ui8Seq, const uint8_t *pui8Payload, uint16_t ui16Count, uint8_t *pui8Wire)
+{
+    uint8_t frame[TELEMETRY_FRAME_MAX];
+    uint16_t crc, len;
+
+    if(ui16Count > TELEMETRY_PAYLOAD_MAX)
+        return 0;
+
+    frame[0] = ui8Channel;
+    frame[1] = ui8Seq;
+    memcpy(&frame[TELEMETRY_HEADER_SIZE], pui8Payload, ui16Count);
+    len = TELEMETRY_HEADER_SIZE + ui16Count;
+
+    crc = telemetry_crc16(frame, len, 0xFFFF);
+    frame[len++] = (uint8_t)crc;
+    frame[len++] = (uint8_t)(crc >> 8);
+
+    len = telemetry_cobsEncode(frame, len, pui8Wire);
+    pui8Wire[len++] = 0;
+
+    return len;
+}
+
+/**
+ *  \brief Telemetry transmitter initialization
+ *  
+ *  \param [in] tel Transmitter
+ *  \param [in] write Byte sink, called once per frame
+ */
+void telemetry_initialization(tTELEMETRY *tel, tTELEMETRY_WRITE write)
+{
+    memset(tel, 0, sizeof(*tel));
+    tel->write = write;
+}
+
+/**
+ *  \brief Send one frame
+ *  
+ *  \param [in] tel Transmitter
+ *  \param [in] ui8Channel Channel, below TELEMETRY_CHANNELS
+ *  \param [in] pui8Payload Payload
+ *  \param [in] ui16Count Payload length, at most TELEMETRY_PAYLOAD_MAX
+ *  \return true if the frame was sent
+ */
+bool telemetry_send(tTELEMETRY *tel, uint8_t ui8Channel, const uint8_t *pui8Payload, uint16_t ui16Count)
+{
+    uint8_t wire[TELEMETRY_WIRE_MAX];
+    uint16_t len;
+
+    if(ui8Channel >= TELEMETRY_CHANNELS)
+        return false;
+
+    len = telemetry_frameEncode(ui8Channel, tel->pui8Seq[ui8Channel], pui8Payload, ui16Count, wire);
+    if(len == 0)
+        return false;
+
+    tel->write(wire, len);
+    tel->pui8Seq[ui8Channel]++;
+    tel->FRAMES++;
+    tel->BYTES += len;
+
+    return true;
+}
+
+/** Store a 16 bit value little endian */
+static uint8_t *telemetry_put16(uint8_t *p, uint16_t ui16Val)
+{
+    p[0] = (uint8_t)ui16Val;
+    p[1] = (uint8_t)(ui16Val >> 8);
+    return p + 2;
+}
+
+/** Store a float little endian */
+static uint8_t *telemetry_putFloat(uint8_t *p, float fVal)
+{
+    uint32_t bits;
+
+    memcpy(&bits, &fVal, sizeof(bits));
+    p = telemetry_put16(p, (uint16_t)bits);
+    return telemetry_put16(p, (uint16_t)(bits >> 16));
+}
+
+/** Load a 16 bit value little endian */
+static uint16_t telemetry_get16(const uint8_t *p)
+{
+    return (uint16_t)(p[0] | (p[1] << 8));
+}
+
+/** Load a float little endian */
+static float telemetry_getFloat(const uint8_t *p)
+{
+    uint32_t bits = telemetry_get16(p) | ((uint32_t)telemetry_get16(p + 2) << 16);
+    float fVal;
+
+    memcpy(&fVal, &bits, sizeof(fVal));
+    return fVal;
+}
+
+/**
+ *  \brief Send raw samples
+ *  
+ *  \param [in] tel Transmitter
+ *  \param [in] samples Samples
+ *  \param [in] ui16Count Number of samples
+ *  \return Number of frames sent
+ *  
+ *  \details Packs up to 17 samples into one frame on TELEMETRY_CHANNEL_RAW.
+ */
+uint16_t telemetry_sendRaw(tTELEMETRY *tel, const tMPU6050_MOTION *samples, uint16_t ui16Count)
+{
+    uint8_t payload[TELEMETRY_RAW_PER_FRAME * TELEMETRY_RAW_SIZE];
+    uint16_t frames = 0, n, i;
+
+    while(ui16Count)
+    {
+        uint8_t *p = payload;
+
+        n = ui16Count < TELEMETRY_RAW_PER_FRAME ? ui16Count : TELEMETRY_RAW_PER_FRAME;
+        for(i = 0; i < n; i++, samples++)
+        {
+            p = telemetry_put16(p, (uint16_t)samples->ACCEL.X);
+            p = telemetry_put16(p, (uint16_t)samples->ACCEL.Y);
+            p = telemetry_put16(p, (uint16_t)samples->ACCEL.Z);
+            p = telemetry_put16(p, (uint16_t)samples->TEMP);
+            p = telemetry_put16(p, (uint16_t)samples->GYRO.X);
+            p = telemetry_put16(p, (uint16_t)samples->GYRO.Y);
+            p = telemetry_put16(p, (uint16_t)samples->GYRO.Z);
+        }
+
+        telemetry_send(tel, TELEMETRY_CHANNEL_RAW, payload, (uint16_t)(p - payload));
+        ui16Count -= n;
+        frames++;
+    }
+
+    return frames;
+}
+
+/**
+ *  \brief Send scaled samples
+ *  
+ *  \param [in] tel Transmitter
+ *  \param [in] samples Samples in SI units
+ *  \param [in] ui16Count Number of samples
+ *  \return Number of frames sent
+ *  
+ *  \details Packs up to 8 samples into one frame on TELEMETRY_CHANNEL_SCALED.
+ */
+uint16_t telemetry_sendScaled(tTELEMETRY *tel, const tMPU6050_MOTION_SI *samples, uint16_t ui16Count)
+{
+    uint8_t payload[TELEMETRY_SCALED_PER_FRAME * TELEMETRY_SCALED_SIZE];
+    uint16_t frames = 0, n, i;
+
+    while(ui16Count)
+    {
+        uint8_t *p = payload;
+
+        n = ui16Count < TELEMETRY_SCALED_PER_FRAME ? ui16Count : TELEMETRY_SCALED_PER_FRAME;
+        for(i = 0; i < n; i++, samples++)
+        {
+            p = telemetry_putFloat(p, samples->ACCEL.X);
+            p = telemetry_putFloat(p, samples->ACCEL.Y);
+            p = telemetry_putFloat(p, samples->ACCEL.Z);
+            p = telemetry_putFloat(p, samples->TEMP);
+            p = telemetry_putFloat(p, samples->GYRO.X);
+            p = telemetry_putFloat(p, samples->GYRO.Y);
+            p = telemetry_putFloat(p, samples->GYRO.Z);
+        }
+
+        telemetry_send(tel, TELEMETRY_CHANNEL_SCALED, payload, (uint16_t)(p - payload));
+        ui16Count -= n;
+        frames++;
+    }
+
+    return frames;
+}
+
+/**
+ *  \brief Telemetry receiver initialization
+ *  
+ *  \param [in] dec Receiver
+ *  
+ *  \details The receiver discards everything up to the first delimiter,
+ *  as it may have started in the middle of a frame.
+ */
+void telemetry_decoderInitialization(tTELEMETRY_DECODER *dec)
+{
+    memset(dec, 0, sizeof(*dec));
+    dec->bSkip = true;
+}
+
+/**
+ *  \brief Check a complete frame
+ */
+static bool telemetry_frameCheck(tTELEMETRY_DECODER *dec)
+{
+    uint16_t len = telemetry_cobsDecode(dec->pui8Wire, dec->ui16WireLen, dec->pui8Frame, sizeof(dec->pui8Frame));
+    uint8_t channel, gap;
+
+    if(len < TELEMETRY_HEADER_SIZE + TELEMETRY_CRC_SIZE)
+    {
+        dec->FORMAT_ERRORS++;
+        return false;
+    }
+
+    if(telemetry_crc16(dec->pui8Frame, len - TELEMETRY_CRC_SIZE, 0xFFFF) != telemetry_get16(&dec->pui8Frame[len - TELEMETRY_CRC_SIZE]))
+    {
+        dec->CRC_ERRORS++;
+        return false;
+    }
+
+    dec->CHANNEL = dec->pui8Frame[0];
+    dec->SEQ = dec->pui8Frame[1];
+    dec->payload = &dec->pui8Frame[TELEMETRY_HEADER_SIZE];
+    dec->PAYLOAD_LEN = len - TELEMETRY_HEADER_SIZE - TELEMETRY_CRC_SIZE;
+    dec->FRAMES++;
+
+    channel = dec->CHANNEL;
+    if(channel < TELEMETRY_CHANNELS)
+    {
+        gap = (uint8_t)(dec->SEQ - dec->pui8Seq[channel]);
+        if(dec->ui8SeqValid & (1 << channel))
+            dec->LOST += gap;
+        dec->ui8SeqValid |= (uint8_t)(1 << channel);
+        dec->pui8Seq[channel] = dec->SEQ + 1;
+    }
+
+    return true;
+}
+
+/**
+ *  \brief Feed one received byte
+ *  
+ *  \param [in] dec Receiver
+ *  \param [in] ui8Byte Received byte
+ *  \return true if a valid frame was completed: CHANNEL, SEQ, payload and PAYLOAD_LEN are set
+ *  
+ *  \details The payload stays valid up to the next call.
+ */
+bool telemetry_decodeByte(tTELEMETRY_DECODER *dec, uint8_t ui8Byte)
+{
+    bool valid = false;
+
+    if(ui8Byte == 0)
+    {
+        if(!dec->bSkip && dec->ui16WireLen)
+            valid = telemetry_frameCheck(dec);
+        dec->bSkip = false;
+        dec->ui16WireLen = 0;
+    }
+    else if(!dec->bSkip)
+    {
+        if(dec->ui16WireLen == sizeof(dec->pui8Wire))
+        {
+            // no delimiter in time: drop up to the next one
+            dec->FORMAT_ERRORS++;
+            dec->bSkip = true;
+        }
+        else
+        {
+            dec->pui8Wire[dec->ui16WireLen++] = ui8Byte;
+        }
+    }
+
+    return valid;
+}
+
+/**
+ *  \brief Unpack raw samples
+ *  
+ *  \param [in] pui8Payload Payload of a TELEMETRY_CHANNEL_RAW frame
+ *  \param [in] ui16Len Payload length
+ *  \param [in] samples Array of TELEMETRY_PAYLOAD_MAX / TELEMETRY_RAW_SIZE samples to return the samples
+ *  \return Number of samples
+ */
+uint16_t telemetry_rawUnpack(const uint8_t *pui8Payload, uint16_t ui16Len, tMPU6050_MOTION *samples)
+{
+    uint16_t n = ui16Len / TELEMETRY_RAW_SIZE, i;
+    const uint8_t *p = pui8Payload;
+
+    for(i = 0; i < n; i++, samples++, p += TELEMETRY_RAW_SIZE)
+    {
+        samples->ACCEL.X = (int16_t)telemetry_get16(p);
+        samples->ACCEL.Y = (int16_t)telemetry_get16(p + 2);
+        samples->ACCEL.Z = (int16_t)telemetry_get16(p + 4);
+        samples->TEMP = (int16_t)telemetry_get16(p + 6);
+        samples->GYRO.X = (int16_t)telemetry_get16(p + 8);
+        samples->GYRO.Y = (int16_t)telemetry_get16(p + 10);
+        samples->GYRO.Z = (int16_t)telemetry_get16(p + 12);
+    }
+
+    return n;
+}
+
+/**
+ *  \brief Unpack scaled samples
+ *  
+ *  \param [in] pui8Payload Payload of a TELEMETRY_CHANNEL_SCALED frame
+ *  \param [in] ui16Len Payload length
+ *  \param [in] samples Array of TELEMETRY_PAYLOAD_MAX / TELEMETRY_SCALED_SIZE samples to return the samples
+ *  \return Number of samples
+ */
+uint16_t telemetry_scaledUnpack(const uint8_t *pui8Payload, uint16_t ui16Len, tMPU6050_MOTION_SI *samples)
+{
+    uint16_t n = ui16Len / TELEMETRY_SCALED_SIZE, i;
+    const uint8_t *p = pui8Payload;
+
+    for(i = 0; i < n; i++, samples++, p += TELEMETRY_SCALED_SIZE)
+    {
+        samples->ACCEL.X = telemetry_getFloat(p);
+        samples->ACCEL.Y = telemetry_getFloat(p + 4);
+        samples->ACCEL.Z = telemetry_getFloat(p + 8);
+        samples->TEMP = telemetry_getFloat(p + 12);
+        samples->GYRO.X = telemetry_getFloat(p + 16);
+        samples->GYRO.Y = telemetry_getFloat(p + 20);
+        samples->GYRO.Z = telemetry_getFloat(p + 24);
+    }
+
+    return n;
+}
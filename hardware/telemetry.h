@@ -0,0 +1,97 @@
+/*
+ * This file is part of the MPU6050-Library distribution (https://github.com/jmherzog-de/MPU6050-Library).
+ * Copyright (c) 2021 Jean-Marcel Herzog.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ *  \file telemetry.h
+ *  \brief Binary Telemetry headerfile
+ *  \copyright Copyright 2021 Jean-Marcel Herzog. All rights reserved. This project is released under the GNU Public License.
+ */
+
+#ifndef TELEMETRY_H_
+#define TELEMETRY_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "mpu6050_motionMeasurements.h"
+#include "mpu6050_scaledMeasurements.h"
+
+#define TELEMETRY_PAYLOAD_MAX       240     /**< Largest payload of one frame */
+#define TELEMETRY_HEADER_SIZE       2       /**< Channel and sequence number */
+#define TELEMETRY_CRC_SIZE          2       /**< CRC-16 */
+#define TELEMETRY_WIRE_MAX          (TELEMETRY_HEADER_SIZE + TELEMETRY_PAYLOAD_MAX + TELEMETRY_CRC_SIZE + 2)   /**< Largest frame on the wire: COBS code byte and delimiter added */
+#define TELEMETRY_CHANNELS          8       /**< Number of channels with sequence numbers */
+
+#define TELEMETRY_CHANNEL_RAW       0       /**< Raw samples: 7 int16 little endian per sample */
+#define TELEMETRY_CHANNEL_SCALED    1       /**< Scaled samples: 7 IEEE 754 float little endian per sample */
+#define TELEMETRY_CHANNEL_DELTA     2       /**< Delta compressed samples: blocks of mpu6050_deltaEncode(), each frame starts with a keyframe */
+
+#define TELEMETRY_RAW_SIZE          14      /**< Payload bytes of one raw sample */
+#define TELEMETRY_SCALED_SIZE       28      /**< Payload bytes of one scaled sample */
+
+/**
+ *  \brief Byte sink: transmits one complete frame
+ */
+typedef void (*tTELEMETRY_WRITE)(const uint8_t *pui8Data, uint16_t ui16Count);
+
+/**
+ *  \brief Telemetry transmitter
+ */
+typedef struct
+{
+    tTELEMETRY_WRITE write;                     /**< Byte sink, e.g. the UART */
+    uint8_t pui8Seq[TELEMETRY_CHANNELS];        /**< Next sequence number of each channel */
+    uint32_t FRAMES;                            /**< Frames sent */
+    uint32_t BYTES;                             /**< Bytes sent on the wire */
+}
+tTELEMETRY;
+
+/**
+ *  \brief Telemetry receiver
+ */
+typedef struct
+{
+    uint8_t pui8Wire[TELEMETRY_WIRE_MAX];       /**< Received bytes of the current frame */
+    uint16_t ui16WireLen;                       /**< Number of bytes in pui8Wire */
+    bool bSkip;                                 /**< Discard bytes up to the next delimiter */
+    uint8_t pui8Frame[TELEMETRY_HEADER_SIZE + TELEMETRY_PAYLOAD_MAX + TELEMETRY_CRC_SIZE]; /**< Decoded frame */
+    uint8_t CHANNEL;                            /**< Channel of the last valid frame */
+    uint8_t SEQ;                                /**< Sequence number of the last valid frame */
+    const uint8_t *payload;                     /**< Payload of the last valid frame */
+    uint16_t PAYLOAD_LEN;                       /**< Payload length of the last valid frame */
+    uint8_t pui8Seq[TELEMETRY_CHANNELS];        /**< Expected sequence number of each channel */
+    uint8_t ui8SeqValid;                        /**< Channels with an expected sequence number (bit mask) */
+    uint32_t FRAMES;                            /**< Valid frames */
+    uint32_t CRC_ERRORS;                        /**< Frames with a wrong CRC */
+    uint32_t FORMAT_ERRORS;                     /**< Invalid COBS data, too short or too long frames */
+    uint32_t LOST;                              /**< Frames missing in the sequence numbers */
+}
+tTELEMETRY_DECODER;
+
+extern uint16_t telemetry_crc16(const uint8_t *pui8Data, uint16_t ui16Count, uint16_t ui16Crc);
+extern uint16_t telemetry_frameEncode(uint8_t ui8Channel, uint8_t ui8Seq, const uint8_t *pui8Payload, uint16_t ui16Count, uint8_t *pui8Wire);
+
+extern void telemetry_initialization(tTELEMETRY*, tTELEMETRY_WRITE write);
+extern bool telemetry_send(tTELEMETRY*, uint8_t ui8Channel, const uint8_t *pui8Payload, uint16_t ui16Count);
+extern uint16_t telemetry_sendRaw(tTELEMETRY*, const tMPU6050_MOTION *samples, uint16_t ui16Count);
+extern uint16_t telemetry_sendScaled(tTELEMETRY*, const tMPU6050_MOTION_SI *samples, uint16_t ui16Count);
+
+extern void telemetry_decoderInitialization(tTELEMETRY_DECODER*);
+extern bool telemetry_decodeByte(tTELEMETRY_DECODER*, uint8_t ui8Byte);
+extern uint16_t telemetry_rawUnpack(const uint8_t *pui8Payload, uint16_t ui16Len, tMPU6050_MOTION *samples);
+extern uint16_t telemetry_scaledUnpack(const uint8_t *pui8Payload, uint16_t ui16Len, tMPU6050_MOTION_SI *samples);
+
+#endif
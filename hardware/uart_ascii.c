@@ -19,14 +19,38 @@
  *  \file uart_ascii.c
  *  \brief Sending hex values as ASCII characters over UART
  *  
- *  This file defines functions to send hex values as ASCII characters
- *  over UART.
+ *  This file defines functions to send hex and decimal values as ASCII
+ *  characters over UART. Every value is rendered with asciiFormat.c and
+ *  sent with one uart_write() call.
+ *  
+ *  For streaming, render a whole record and send it at once:
+ *  
+ *      static char line[80];
+ *      tASCII_RECORD rec;
+ *      
+ *      ascii_recordInitialization(&rec, line, sizeof(line));
+ *      ascii_putU32(&rec, timestamp);
+ *      ascii_putChar(&rec, ',');
+ *      ascii_putMotion(&rec, &sample, ',');
+ *      ascii_putChar(&rec, '\n');
+ *      uart_putRecord(&rec);
+ *  
+ *  Such a record of a raw sample is about 36 characters. A 1kHz stream
+ *  needs 360000 baud, so build with UART_BAUDRATE=460800 or higher.
  *  
  *  \copyright Copyright 2021 Jean-Marcel Herzog. All rights reserved. This project is released under the GNU Public License.
  */
 
 #include "uart_ascii.h"
 
+/**
+ *  \brief Send a rendered value
+ */
+static void uart_putText(const char *pcBegin, const char *pcEnd)
+{
+    uart_write((const uint8_t*)pcBegin, (uint16_t)(pcEnd - pcBegin));
+}
+
 /**
  *  \brief Send 8 bit hex value over UART
  *  
@@ -34,17 +58,9 @@
  */
 void uart_puthex8AsASCII(uint8_t ui8Val)
 {
-    // extract upper and lower nibble from input value
-    uint8_t upperNibble = (ui8Val & 0xF0) >> 4;
-    uint8_t lowerNibble = (ui8Val & 0x0F);
+    char text[2];
 
-    // convert nibble to ASCII hex value
-    upperNibble += upperNibble > 9 ? 'A' - 10 : '0';
-    lowerNibble += lowerNibble > 9 ? 'A' - 10 : '0';
-
-    // send two ASCII values
-    uart_putc(upperNibble);
-    uart_putc(lowerNibble);
+    uart_putText(text, ascii_formatHex(text, ui8Val, 2));
 }
 
 /**
@@ -54,25 +70,21 @@ void uart_puthex8AsASCII(uint8_t ui8Val)
  */
 void uart_puthex16AsASCII(uint16_t ui16Val)
 {
-    // transmit high byte
-    uart_puthex8AsASCII((uint8_t)(ui16Val >> 8));
+    char text[4];
 
-    // transmit low byte
-    uart_puthex8AsASCII((uint8_t)(ui16Val & 0xFF));
+    uart_putText(text, ascii_formatHex(text, ui16Val, 4));
 }
 
 /**
  *  \brief Send 32 bit hex value over UART
  *  
- *  \param [in] ui32Val Value to convert and trasnmit
+ *  \param [in] ui32Val Value to convert and transmit
  */
 void uart_puthex32AsASCII(uint32_t ui32Val)
 {
-    // transmit upper 16 bit
-    uart_puthex16AsASCII((uint16_t)(ui32Val >> 16));
+    char text[8];
 
-    // transmit lower 16 bit
-    uart_puthex16AsASCII((uint16_t)(ui32Val & 0xFFFF));
+    uart_putText(text, ascii_formatHex(text, ui32Val, 8));
 }
 
 /**
@@ -82,27 +94,7 @@ void uart_puthex32AsASCII(uint32_t ui32Val)
  */
 void uart_putU8AsASCII(uint8_t ui8Val)
 {
-    uint8_t digit1 = '0', digit2 = '0';
-
-    while(ui8Val >= 100)
-    {
-        ui8Val -= 100;
-        digit1++;
-    }
-    while(ui8Val >= 10)
-    {
-        ui8Val -= 10;
-        digit2++;
-    }
-
-    // send first character (or ignore leading 0)
-    if(digit1 != '0') uart_putc(digit1);
-
-    // send second character (or ignore leading 0)
-    if(digit1 != '0' || (digit2 != '0')) uart_putc(digit2);
-
-    // send last character
-    uart_putc(ui8Val + '0');
+    uart_putU32AsASCII(ui8Val);
 }
 
 /**
@@ -112,17 +104,7 @@ void uart_putU8AsASCII(uint8_t ui8Val)
  */
 void uart_putS8AsASCII(int8_t i8Val)
 {
-    // negative number ? bit 7 -> 1
-    if(i8Val & 0x80)
-    {
-        // send sign
-        uart_putc('-');
-
-        // convert to positive number
-        i8Val = -(i8Val);
-    }
-    // send number
-    uart_putU8AsASCII(i8Val);
+    uart_putS32AsASCII(i8Val);
 }
 
 /**
@@ -132,60 +114,7 @@ void uart_putS8AsASCII(int8_t i8Val)
  */
 void uart_putU16AsASCII(uint16_t ui16Val)
 {
-    uint8_t digit1 = '0', digit2 = '0', digit3= '0', digit4 = '0';
-
-    // extract 10000
-    while( ui16Val >= 10000)
-    {
-        ui16Val -= 10000;
-        digit1++;
-    }
-    // extract 1000
-    while(ui16Val >= 1000)
-    {
-        ui16Val -= 1000;
-        digit2++;
-    }
-    // extract 100
-    while(ui16Val >= 100)
-    {
-        ui16Val -= 100;
-        digit3++;
-    }
-    // extract 10
-    while(ui16Val >= 10)
-    {
-        ui16Val -= 10;
-        digit4++;
-    }
-
-    bool prevprint = 0; // previous place > 0 flag
-
-    // send 10000 (or ignore leading 0)
-    if(digit1 != '0')
-    {
-        uart_putc(digit1);
-        prevprint = 1;
-    }
-    // send 1000 (or ignore leading 0)
-    if(prevprint || digit2 != '0')
-    {
-        uart_putc(digit2);
-        prevprint = 1;
-    }
-    // send 100 (or ignore leading 0)
-    if(prevprint || digit3 != '0')
-    {
-        uart_putc(digit3);
-        prevprint = 1;
-    }
-    // send 10 (or ignore leading 0)
-    if(prevprint || digit4 != '0')
-    {
-        uart_putc(digit4);
-    }
-    // send last character
-    uart_putc(ui16Val + '0');
+    uart_putU32AsASCII(ui16Val);
 }
 
 /**
@@ -195,10 +124,42 @@ void uart_putU16AsASCII(uint16_t ui16Val)
  */
 void uart_putS16AsASCII(int16_t i16Val)
 {
-    if(i16Val & 0x8000)
-    {
-        UART_putc('-');
-        i16Val = ~(i16Val-1);
-    }
-    uart_putU16AsASCII((uint16_t)i16Val);
+    uart_putS32AsASCII(i16Val);
+}
+
+/**
+ *  \brief Send 32 bit unsigned decimal over UART
+ *  
+ *  \param [in] ui32Val Value to convert and transmit
+ */
+void uart_putU32AsASCII(uint32_t ui32Val)
+{
+    char text[ASCII_U32_MAX];
+
+    uart_putText(text, ascii_formatU32(text, ui32Val));
+}
+
+/**
+ *  \brief Send 32 bit signed decimal over UART
+ *  
+ *  \param [in] i32Val Value to convert and transmit
+ */
+void uart_putS32AsASCII(int32_t i32Val)
+{
+    char text[ASCII_S32_MAX];
+
+    uart_putText(text, ascii_formatS32(text, i32Val));
+}
+
+/**
+ *  \brief Send a record over UART
+ *  
+ *  \param [in] rec Record to transmit
+ *  
+ *  Sends the record with one uart_write() call and clears it for the next one.
+ */
+void uart_putRecord(tASCII_RECORD *rec)
+{
+    uart_putText(rec->pcBuffer, rec->pcBuffer + rec->ui16Len);
+    ascii_recordClear(rec);
 }
\ No newline at end of file
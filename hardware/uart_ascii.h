@@ -27,13 +27,17 @@
 #include <stdint.h>
 #include <stdbool.h>
 #include "uart.h"
+#include "asciiFormat.h"
 
-void UART_puthex8AsASCII(uint8_t ui8Val);
-void UART_puthex16AsASCII(uint16_t ui16Val);
-void UART_puthex32AsASCII(uint32_t ui32Val);
-void UART_putU8AsASCII(uint8_t ui8Val);
-void UART_putS8AsASCII(int8_t i8Val);
-void UART_putU16AsASCII(uint16_t ui16Val);
-void UART_putS16AsASCII(int16_t i16Val);
+void uart_puthex8AsASCII(uint8_t ui8Val);
+void uart_puthex16AsASCII(uint16_t ui16Val);
+void uart_puthex32AsASCII(uint32_t ui32Val);
+void uart_putU8AsASCII(uint8_t ui8Val);
+void uart_putS8AsASCII(int8_t i8Val);
+void uart_putU16AsASCII(uint16_t ui16Val);
+void uart_putS16AsASCII(int16_t i16Val);
+void uart_putU32AsASCII(uint32_t ui32Val);
+void uart_putS32AsASCII(int32_t i32Val);
+void uart_putRecord(tASCII_RECORD *rec);
 
 #endif
\ No newline at end of file
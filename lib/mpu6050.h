@@ -41,6 +41,76 @@
 #ifndef MPU6050_H_
 #define MPU6050_H_
 
+//--------------------------------------//
+// Device Handle                        //
+//--------------------------------------//
+#include "mpu6050_device.h"
+
+//--------------------------------------//
+// Shadow Registers                     //
+//--------------------------------------//
+#include "mpu6050_shadowRegisters.h"
+
+//--------------------------------------//
+// Batch Write                          //
+//--------------------------------------//
+#include "mpu6050_batchWrite.h"
+
+//--------------------------------------//
+// Register Snapshot                    //
+//--------------------------------------//
+#include "mpu6050_snapshot.h"
+
+//--------------------------------------//
+// Register Codec                       //
+//--------------------------------------//
+#include "mpu6050_registerCodec.h"
+
+//--------------------------------------//
+// Interrupt driven Acquisition         //
+//--------------------------------------//
+#include "mpu6050_acquisition.h"
+
+//--------------------------------------//
+// Sample Ring Buffer                   //
+//--------------------------------------//
+#include "mpu6050_sampleRing.h"
+
+//--------------------------------------//
+// Scaled Measurements                  //
+//--------------------------------------//
+#include "mpu6050_scaledMeasurements.h"
+
+//--------------------------------------//
+// Fixed-Point Measurements             //
+//--------------------------------------//
+#include "mpu6050_fixedMeasurements.h"
+
+//--------------------------------------//
+// Block Decoder                        //
+//--------------------------------------//
+#include "mpu6050_blockDecode.h"
+
+//--------------------------------------//
+// FIFO Drain Scheduler                 //
+//--------------------------------------//
+#include "mpu6050_drainScheduler.h"
+
+//--------------------------------------//
+// FIFO Sample Timestamps               //
+//--------------------------------------//
+#include "mpu6050_timestamp.h"
+
+//--------------------------------------//
+// Output Data Rate Planner             //
+//--------------------------------------//
+#include "mpu6050_outputRate.h"
+
+//--------------------------------------//
+// Delta Sample Compression             //
+//--------------------------------------//
+#include "mpu6050_deltaCodec.h"
+
 //--------------------------------------//
 // 4.1 Self Test Registers              //
 //--------------------------------------//
@@ -136,6 +206,11 @@
 //--------------------------------------//
 #include "mpu6050_gyroscopeMeasurements.h"
 
+//--------------------------------------//
+// 4.17 - 4.19 Motion Measurements      //
+//--------------------------------------//
+#include "mpu6050_motionMeasurements.h"
+
 //--------------------------------------//
 // 4.20 External Sensor Data            //
 //--------------------------------------//
@@ -43,33 +43,31 @@
  *  \copyright Copyright 2021 Jean-Marcel Herzog. All rights reserved. This project is released under the GNU Public License.
  */
 
+#include "mpu6050_registerCodec.h"
 #include "mpu6050_accelerometerConfiguration.h"
 
 /**
  *  \brief Read Acceleration Configuration
  *  
+ *  \param [in] dev Device handle
  *  \param [in] obj Datatype pointer to return register values
  *  
  *  \details See register datasheet chapter 4.5 for more details
  */
-void mpu6050_accelConfigReadReg(tMPU6050_ACCEL_CONFIG *obj)
+void mpu6050_accelConfigReadReg(tMPU6050_DEV *dev, tMPU6050_ACCEL_CONFIG *obj)
 {
-    uint8_t reg = i2c_receive(MPU6050_I2C_ADDR, MPU6050_ACCEL_CONFIG);
-    obj->XA_ST = (reg & 0x80) >> 7;
-    obj->YA_ST = (reg & 0x40) >> 6;
-    obj->ZA_ST = (reg & 0x10) >> 5;
-    obj->AFS_SEL = (reg & 0x18 ) >> 3;
+    mpu6050_regRead(dev, MPU6050_CODEC_ACCEL_CONFIG, obj);
 }
 
 /**
  *  \brief Write Acceleration Configuration
  *  
+ *  \param [in] dev Device handle
  *  \param [in] obj Datatype pointer to write register values
  *  
  *  \details See register datasheet chapter 4.5 for more details
  */
-void mpu6050_accelConfigWriteReg(tMPU6050_ACCEL_CONFIG *obj)
+void mpu6050_accelConfigWriteReg(tMPU6050_DEV *dev, tMPU6050_ACCEL_CONFIG *obj)
 {
-    uint8_t reg = (uint8_t)(obj->XA_ST) << 7 | (uint8_t)(obj->YA_ST) << 6 | (uint8_t)(obj->ZA_ST) << 5 | (uint8_t)(obj->AFS_SEL) << 3;
-    i2c_write(MPU6050_I2C_ADDR, MPU6050_ACCEL_CONFIG, reg);
+    mpu6050_regWrite(dev, MPU6050_CODEC_ACCEL_CONFIG, obj);
 }
\ No newline at end of file
@@ -26,8 +26,7 @@
 
 #include <stdint.h>
 #include <stdbool.h>
-#include "i2c.h"
-#include "mpu6050_reg.h"
+#include "mpu6050_transport.h"
 
 #define MPU6050_ACCEL_RANGE_2G     0x00
 #define MPU6050_ACCEL_RANGE_4G     0x01
@@ -37,16 +36,22 @@
 /**
  *  \brief Acceleration Configuration type
  */
-typedef struct
+typedef union
 {
-    bool XA_ST;                 /**< Setting this bit causes the X axis accelerometer to perform self test. */
-    bool YA_ST;                 /**< Setting this bit causes the Y axis accelerometer to perform self test. */
-    bool ZA_ST;                 /**< Setting this bit causes the Z axis accelerometer to perform self test. */
-    unsigned char AFS_SEL : 2;  /**< Selects the full scale range of accelerometers. */
+    uint8_t RAW;                /**< Register value */
+
+    struct
+    {
+        unsigned char : 3;
+        unsigned char AFS_SEL : 2;  /**< Selects the full scale range of accelerometers. */
+        bool ZA_ST : 1;                 /**< Setting this bit causes the Z axis accelerometer to perform self test. */
+        bool YA_ST : 1;                 /**< Setting this bit causes the Y axis accelerometer to perform self test. */
+        bool XA_ST : 1;                 /**< Setting this bit causes the X axis accelerometer to perform self test. */
+    };
 }
 tMPU6050_ACCEL_CONFIG;
 
-extern void mpu6050_accelConfigReadReg(tMPU6050_ACCEL_CONFIG*);
-extern void mpu6050_accelConfigWriteReg(tMPU6050_ACCEL_CONFIG*);
+extern void mpu6050_accelConfigReadReg(tMPU6050_DEV*, tMPU6050_ACCEL_CONFIG*);
+extern void mpu6050_accelConfigWriteReg(tMPU6050_DEV*, tMPU6050_ACCEL_CONFIG*);
 
 #endif /* MPU6050_ACCELEROMETERCONFIGURATION_H_ */
\ No newline at end of file
@@ -50,55 +50,64 @@
 /**
  *  \brief Read X axis accelerometer measurement
  *  
+ *  \param [in] dev Device handle
  *  \param [in] obj Datatype pointer to return register values
  *  
  *  \details See register datasheet chapter 4.17 for more details
  */
-void mpu6050_accelXoutReadReg(tMPU6050_ACCEL_XOUT *obj)
+void mpu6050_accelXoutReadReg(tMPU6050_DEV *dev, tMPU6050_ACCEL_XOUT *obj)
 {
-    uint16_t high = (uint8_t)i2c_receive(MPU6050_I2C_ADDR, MPU6050_ACCEL_XOUT_H);
-    uint16_t low = (uint8_t)i2c_receive(MPU6050_I2C_ADDR, MPU6050_ACCEL_XOUT_L);
-    *obj = (high << 8) | low;
+    uint16_t high = (uint8_t)mpu6050_busRead(dev, MPU6050_ACCEL_XOUT_H);
+    uint16_t low = (uint8_t)mpu6050_busRead(dev, MPU6050_ACCEL_XOUT_L);
+    *obj = (int16_t)((high << 8) | low);
 }
 
 /**
  *  \brief Write Y axis accelerometer measurement
  *  
+ *  \param [in] dev Device handle
  *  \param [in] obj Datatype pointer to return register values
  *  
  *  \details See register datasheet chapter 4.17 for more details
  */
-void mpu6050_accelYoutReadReg(tMPU6050_ACCEL_YOUT *obj)
+void mpu6050_accelYoutReadReg(tMPU6050_DEV *dev, tMPU6050_ACCEL_YOUT *obj)
 {
-    uint16_t high = (uint8_t)i2c_receive(MPU6050_I2C_ADDR, MPU6050_ACCEL_YOUT_H);
-    uint16_t low = (uint8_t)i2c_receive(MPU6050_I2C_ADDR, MPU6050_ACCEL_YOUT_L);
-    *obj = (high << 8) | low;
+    uint16_t high = (uint8_t)mpu6050_busRead(dev, MPU6050_ACCEL_YOUT_H);
+    uint16_t low = (uint8_t)mpu6050_busRead(dev, MPU6050_ACCEL_YOUT_L);
+    *obj = (int16_t)((high << 8) | low);
 }
 
 /**
  *  \brief Read Z axis accelerometer measurement
  *  
+ *  \param [in] dev Device handle
  *  \param [in] obj Datatype pointer to return register values
  *  
  *  \details See register datasheet chapter 4.17 for more details
  */
-void mpu6050_accelZoutReadReg(tMPU6050_ACCEL_ZOUT *obj)
+void mpu6050_accelZoutReadReg(tMPU6050_DEV *dev, tMPU6050_ACCEL_ZOUT *obj)
 {
-    uint16_t high = (uint8_t)i2c_receive(MPU6050_I2C_ADDR, MPU6050_ACCEL_ZOUT_H);
-    uint16_t low = (uint8_t)i2c_receive(MPU6050_I2C_ADDR, MPU6050_ACCEL_ZOUT_L);
-    *obj = (high << 8) | low;
+    uint16_t high = (uint8_t)mpu6050_busRead(dev, MPU6050_ACCEL_ZOUT_H);
+    uint16_t low = (uint8_t)mpu6050_busRead(dev, MPU6050_ACCEL_ZOUT_L);
+    *obj = (int16_t)((high << 8) | low);
 }
 
 /**
  *  \brief Read all axis accelerometer measurement
  *  
+ *  \param [in] dev Device handle
  *  \param [in] obj Datatype pointer to return register values
  *  
- *  \details Read x,y and z axis acceleration with one function call.
+ *  \details Read x,y and z axis acceleration with one burst read, so
+ *  all axis belong to the same sampling instant.
  */
-void mpu6050_accelReadReg(tMPU6050_ACCEL *obj)
+void mpu6050_accelReadReg(tMPU6050_DEV *dev, tMPU6050_ACCEL *obj)
 {
-    mpu6050_accel_xout_readReg(&(obj->X), callback);
-    mpu6050_accel_yout_readReg(&(obj->Y), callback);
-    mpu6050_accel_zout_readReg(&(obj->Z), callback);
+    uint8_t buf[6];
+
+    mpu6050_busReadBurst(dev, MPU6050_ACCEL_XOUT_H, buf, 6);
+
+    obj->X = (int16_t)(((uint16_t)buf[0] << 8) | buf[1]);
+    obj->Y = (int16_t)(((uint16_t)buf[2] << 8) | buf[3]);
+    obj->Z = (int16_t)(((uint16_t)buf[4] << 8) | buf[5]);
 }
\ No newline at end of file
@@ -26,8 +26,7 @@
 
 #include <stdint.h>
 #include <stdbool.h>
-#include "i2c.h"
-#include "mpu6050_reg.h"
+#include "mpu6050_transport.h"
 
 #define MPU6050_ACCEL_2g_16384LSB_per_g 0x00
 #define MPU6050_ACCEL_4g_8192LSB_per_g  0x01
@@ -38,17 +37,17 @@
 /**
  *  \brief Type for X axis accelerometer measurement data
  */
-typedef uint16_t tMPU6050_ACCEL_XOUT;
+typedef int16_t tMPU6050_ACCEL_XOUT;
 
 /**
  *  \brief Type for Y axis accelerometer measurement data
  */
-typedef uint16_t tMPU6050_ACCEL_YOUT;
+typedef int16_t tMPU6050_ACCEL_YOUT;
 
 /**
  *  \brief Type for Z axis accelerometer measurement data
  */
-typedef uint16_t tMPU6050_ACCEL_ZOUT;
+typedef int16_t tMPU6050_ACCEL_ZOUT;
 
 /**
  *  \brief Type contain all axis accelerometer measurement.
@@ -61,9 +60,9 @@ typedef struct
 }
 tMPU6050_ACCEL;
 
-extern void mpu6050_accelXoutReadReg(tMPU6050_ACCEL_XOUT*);
-extern void mpu6050_accelYoutReadReg(tMPU6050_ACCEL_YOUT*);
-extern void mpu6050_accelZoutReadReg(tMPU6050_ACCEL_ZOUT*);
-extern void mpu6050_accelReadReg(tMPU6050_ACCEL*);
+extern void mpu6050_accelXoutReadReg(tMPU6050_DEV*, tMPU6050_ACCEL_XOUT*);
+extern void mpu6050_accelYoutReadReg(tMPU6050_DEV*, tMPU6050_ACCEL_YOUT*);
+extern void mpu6050_accelZoutReadReg(tMPU6050_DEV*, tMPU6050_ACCEL_ZOUT*);
+extern void mpu6050_accelReadReg(tMPU6050_DEV*, tMPU6050_ACCEL*);
 
 #endif
\ No newline at end of file
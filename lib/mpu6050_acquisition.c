@@ -0,0 +1,173 @@
+/*
+ * This file is part of the MPU6050-Library distribution (https://github.com/jmherzog-de/MPU6050-Library).
+ * Copyright (c) 2021 Jean-Marcel Herzog.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+/**
+ *  \file mpu6050_acquisition.c
+ *  \brief Interrupt driven Acquisition
+ *  
+ *  Delivers every sample to a consumer callback without polling. The sensor
+ *  is configured to raise the INT pin on DATA_RDY and to hold it until the
+ *  next register read (LATCH_INT_EN = 1, INT_RD_CLEAR = 1). The host calls
+ *  mpu6050_acqIntEdge() from the interrupt handler of the INT pin (rising
+ *  edge). It starts the asynchronous burst read of the measurement
+ *  registers, and the completion of the read passes the sample to the
+ *  consumer. The sample is timestamped with the host clock at the INT
+ *  edge, which is the sampling instant up to the interrupt latency.
+ *  
+ *  One bus transaction per sample: the burst read itself clears the latched
+ *  interrupt, INT_STATUS is never read. As the line stays active until the
+ *  burst, a sample is never announced twice and no duplicates reach the
+ *  consumer. An edge that arrives while the previous burst is still on the
+ *  bus is counted in OVERRUNS; that sample is lost.
+ *  
+ *  Without an asynchronous transport (submit is 0) mpu6050_acqIntEdge()
+ *  reads the sample with a blocking burst inside the INT pin interrupt.
+ *  
+ *  \copyright Copyright 2021 Jean-Marcel Herzog. All rights reserved. This project is released under the GNU Public License.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "mpu6050_transport.h"
+#include "mpu6050_bypassEnableConfiguration.h"
+#include "mpu6050_interruptEnable.h"
+#include "mpu6050_interruptStatus.h"
+#include "mpu6050_acquisition.h"
+
+/**
+ *  \brief Completion of the burst read
+ */
+static void mpu6050_acqComplete(tMPU6050_TRANSFER *transfer)
+{
+    tMPU6050_ACQ *acq = (tMPU6050_ACQ*)transfer->arg;
+    tMPU6050_SAMPLE sample;
+
+    acq->BUSY = false;
+
+    if(transfer->ERROR)
+    {
+        acq->ERRORS++;
+        return;
+    }
+
+    if(!acq->RUNNING)
+        return;
+
+    sample.TIMESTAMP = acq->TIMESTAMP;
+    mpu6050_motionDecode(acq->BUF, &sample.MOTION);
+    acq->SAMPLES++;
+    acq->callback(acq->dev, &sample, acq->arg);
+}
+
+/**
+ *  \brief Start the interrupt driven acquisition
+ *  
+ *  \param [in] dev Device handle
+ *  \param [in] acq Acquisition pipeline
+ *  \param [in] clock Time base for sample timestamps, 0 for none
+ *  \param [in] callback Consumer, called once per sample
+ *  \param [in] arg User argument for the consumer
+ *  
+ *  \details Configures INT_PIN_CFG for an active high, push-pull, latched
+ *  interrupt that clears on any read and enables the DATA_RDY interrupt.
+ *  The other interrupt sources and I2C_BYPASS_EN are left unchanged.
+ *  Enable the INT pin interrupt of the host (rising edge) before calling.
+ */
+void mpu6050_acqStart(tMPU6050_DEV *dev, tMPU6050_ACQ *acq, tMPU6050_CLOCK clock, tMPU6050_SAMPLE_CALLBACK callback, void *arg)
+{
+    tMPU6050_INT_PIN_CFG pinCfg;
+    tMPU6050_INT_ENABLE intEnable;
+    tMPU6050_INT_STATUS intStatus;
+
+    acq->dev = dev;
+    acq->clock = clock;
+    acq->TIMESTAMP = 0;
+    acq->callback = callback;
+    acq->arg = arg;
+    acq->BUSY = false;
+    acq->SAMPLES = 0;
+    acq->OVERRUNS = 0;
+    acq->ERRORS = 0;
+
+    acq->transfer.REG = MPU6050_ACCEL_XOUT_H;
+    acq->transfer.READ = true;
+    acq->transfer.DATA = acq->BUF;
+    acq->transfer.COUNT = MPU6050_MOTION_BURST_LEN;
+    acq->transfer.callback = mpu6050_acqComplete;
+    acq->transfer.arg = acq;
+
+    mpu6050_intPinCfgReadReg(dev, &pinCfg);
+    pinCfg.INT_LEVEL = 0;
+    pinCfg.INT_OPEN = 0;
+    pinCfg.LATCH_INT_EN = 1;
+    pinCfg.INT_RD_CLEAR = 1;
+    mpu6050_intPinCfgWriteReg(dev, &pinCfg);
+
+    acq->RUNNING = true;
+
+    mpu6050_intEnableReadReg(dev, &intEnable);
+    intEnable.DATA_RDY_EN = 1;
+    mpu6050_intEnableWriteReg(dev, &intEnable);
+
+    // release a line latched before the start, it would hide the next edge
+    mpu6050_intStatusReadReg(dev, &intStatus);
+}
+
+/**
+ *  \brief Stop the interrupt driven acquisition
+ *  
+ *  \param [in] acq Acquisition pipeline
+ *  
+ *  \details Disables the DATA_RDY interrupt. A burst read in progress
+ *  completes but is not passed to the consumer.
+ */
+void mpu6050_acqStop(tMPU6050_ACQ *acq)
+{
+    tMPU6050_INT_ENABLE intEnable;
+
+    acq->RUNNING = false;
+
+    mpu6050_intEnableReadReg(acq->dev, &intEnable);
+    intEnable.DATA_RDY_EN = 0;
+    mpu6050_intEnableWriteReg(acq->dev, &intEnable);
+}
+
+/**
+ *  \brief Handle an edge of the INT pin
+ *  
+ *  \param [in] acq Acquisition pipeline
+ *  
+ *  \details Call from the interrupt handler of the INT pin. Starts the
+ *  burst read of the new sample. The burst flushes a pending batch of the
+ *  device, so do not use mpu6050_batchBegin() on the device while the
+ *  acquisition is running.
+ */
+void mpu6050_acqIntEdge(tMPU6050_ACQ *acq)
+{
+    if(!acq->RUNNING)
+        return;
+
+    if(acq->BUSY)
+    {
+        acq->OVERRUNS++;
+        return;
+    }
+
+    acq->BUSY = true;
+    if(acq->clock)
+        acq->TIMESTAMP = acq->clock();
+    mpu6050_busSubmit(acq->dev, &acq->transfer);
+}
@@ -0,0 +1,76 @@
+/*
+ * This file is part of the MPU6050-Library distribution (https://github.com/jmherzog-de/MPU6050-Library).
+ * Copyright (c) 2021 Jean-Marcel Herzog.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+/**
+ *  \file mpu6050_acquisition.h
+ *  \brief Interrupt driven Acquisition headerfile
+ *  \copyright Copyright 2021 Jean-Marcel Herzog. All rights reserved. This project is released under the GNU Public License.
+ */
+
+#ifndef MPU6050_ACQUISITION_H_
+#define MPU6050_ACQUISITION_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "mpu6050_device.h"
+#include "mpu6050_motionMeasurements.h"
+
+/**
+ *  \brief Datatype for a timestamped sample
+ */
+typedef struct
+{
+    uint32_t TIMESTAMP;         /**< Host time of the INT edge, 0 without clock */
+    tMPU6050_MOTION MOTION;     /**< Accelerometer, temperature and gyroscope measurement */
+}
+tMPU6050_SAMPLE;
+
+/**
+ *  \brief Consumer of acquired samples
+ *  
+ *  Called from interrupt context (completion of the burst read) once per
+ *  sample. The sample is only valid during the call.
+ */
+typedef void (*tMPU6050_SAMPLE_CALLBACK)(tMPU6050_DEV *dev, const tMPU6050_SAMPLE *sample, void *arg);
+
+/**
+ *  \brief Acquisition pipeline of one device
+ *  
+ *  The memory is owned by the caller and must stay valid while the
+ *  acquisition is running.
+ */
+typedef struct
+{
+    tMPU6050_DEV *dev;                          /**< Device handle */
+    tMPU6050_TRANSFER transfer;                 /**< Burst read of the measurement registers */
+    uint8_t BUF[MPU6050_MOTION_BURST_LEN];      /**< Register bytes of the burst read */
+    tMPU6050_CLOCK clock;                       /**< Time base for timestamps, may be 0 */
+    volatile uint32_t TIMESTAMP;                /**< Host time of the last INT edge */
+    tMPU6050_SAMPLE_CALLBACK callback;          /**< Consumer */
+    void *arg;                                  /**< User argument for the consumer */
+    volatile bool RUNNING;                      /**< Set between mpu6050_acqStart() and mpu6050_acqStop() */
+    volatile bool BUSY;                         /**< Burst read in progress */
+    volatile uint32_t SAMPLES;                  /**< Number of samples passed to the consumer */
+    volatile uint32_t OVERRUNS;                 /**< Number of INT edges during a burst read */
+    volatile uint32_t ERRORS;                   /**< Number of failed burst reads */
+}
+tMPU6050_ACQ;
+
+extern void mpu6050_acqStart(tMPU6050_DEV*, tMPU6050_ACQ*, tMPU6050_CLOCK clock, tMPU6050_SAMPLE_CALLBACK callback, void *arg);
+extern void mpu6050_acqStop(tMPU6050_ACQ*);
+extern void mpu6050_acqIntEdge(tMPU6050_ACQ*);
+
+#endif
@@ -0,0 +1,181 @@
+/*
+ * This file is part of the MPU6050-Library distribution (https://github.com/jmherzog-de/MPU6050-Library).
+ * Copyright (c) 2021 Jean-Marcel Herzog.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ *  \file mpu6050_batchWrite.c
+ *  \brief Batch Write
+ *  
+ *  Collects register writes and emits them as few burst writes as possible.
+ *  Between mpu6050_batchBegin() and mpu6050_batchCommit() every register
+ *  write of the library (e.g. mpu6050_configRegWrite() or
+ *  mpu6050_shadowFieldWrite()) is stored instead of sent. The commit sorts
+ *  the pending writes by register address and sends one auto increment burst
+ *  write for every contiguous run, e.g. SMPLRT_DIV to ACCEL_CONFIG
+ *  (0x19 - 0x1C) or the ADDR, REG and CTRL registers of the I2C slaves.
+ *  
+ *  Runs separated by up to MPU6050_BATCH_GAP registers are joined if the
+ *  registers in between are held in the shadow cache; their cached value is
+ *  written again. Writes of a value the shadow cache already holds are
+ *  dropped. FIFO_R_W is always written on its own.
+ *  
+ *  A register read during the batch commits the pending writes first, so
+ *  reads always see the written values.
+ *  
+ *  \note The writes are not sent in program order. Write registers with an
+ *  order dependency, like DEVICE_RESET or leaving sleep mode, outside of the
+ *  batch or in a separate one.
+ *  
+ *  \copyright Copyright 2021 Jean-Marcel Herzog. All rights reserved. This project is released under the GNU Public License.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "mpu6050_device.h"
+#include "mpu6050_shadowRegisters.h"
+#include "mpu6050_batchWrite.h"
+
+#define BATCH_PENDING(b, r)     ((b)->PENDING[(r) >> 5] & (1UL << ((r) & 0x1F)))
+
+/**
+ *  \brief Start collecting register writes
+ *  
+ *  \param [in] dev Device handle
+ *  \param [in] batch Storage for the pending writes, valid until the commit
+ *  
+ *  \details Batches can be nested. A nested begin keeps the outer batch
+ *  and only the outermost commit sends the writes.
+ */
+void mpu6050_batchBegin(tMPU6050_DEV *dev, tMPU6050_BATCH *batch)
+{
+    uint8_t i;
+
+    if(dev->BATCH_DEPTH++ > 0)
+        return;
+
+    for(i = 0; i < 4; i++)
+        batch->PENDING[i] = 0;
+
+    dev->batch = batch;
+}
+
+/**
+ *  \brief Collect one register write
+ *  
+ *  \param [in] dev Device handle
+ *  \param [in] ui8Reg Register address
+ *  \param [in] ui8Data Register value
+ *  
+ *  \details Called by the transport layer while a batch is active. The
+ *  shadow cache is updated immediately.
+ */
+void mpu6050_batchWrite(tMPU6050_DEV *dev, uint8_t ui8Reg, uint8_t ui8Data)
+{
+    tMPU6050_BATCH *batch = dev->batch;
+    uint8_t cached;
+
+    ui8Reg &= 0x7F;
+
+    // a FIFO write is not a register setting, keep the order of FIFO bytes
+    if(ui8Reg == MPU6050_FIFO_R_W)
+    {
+        mpu6050_batchFlush(dev);
+        dev->transport->write(dev->transport->ctx, dev->ADDR, ui8Reg, ui8Data);
+        return;
+    }
+
+    if(!BATCH_PENDING(batch, ui8Reg) && mpu6050_shadowLookup(dev, ui8Reg, &cached) && cached == ui8Data)
+        return;
+
+    batch->DATA[ui8Reg] = ui8Data;
+    batch->PENDING[ui8Reg >> 5] |= 1UL << (ui8Reg & 0x1F);
+    mpu6050_shadowUpdate(dev, ui8Reg, ui8Data);
+}
+
+/**
+ *  \brief Send all pending register writes
+ *  
+ *  \param [in] dev Device handle
+ *  \return Number of bus transactions
+ *  
+ *  \details The batch stays active. Called by the transport layer before
+ *  a register is read.
+ */
+uint8_t mpu6050_batchFlush(tMPU6050_DEV *dev)
+{
+    tMPU6050_BATCH *batch = dev->batch;
+    uint8_t buf[128];
+    uint8_t transactions = 0;
+    uint8_t start, end, next, gap;
+    uint16_t reg;
+
+    if(batch == 0)
+        return 0;
+
+    for(reg = 0; reg < 128; reg++)
+    {
+        if(!BATCH_PENDING(batch, reg))
+            continue;
+
+        start = end = (uint8_t)reg;
+        buf[0] = batch->DATA[start];
+
+        for(next = end + 1; next < 128; next = end + 1)
+        {
+            // find the next pending register behind a gap of cached registers
+            for(gap = next; gap < 128 && gap - next < MPU6050_BATCH_GAP; gap++)
+                if(BATCH_PENDING(batch, gap) || !mpu6050_shadowLookup(dev, gap, &buf[gap - start]))
+                    break;
+
+            if(gap == 128 || !BATCH_PENDING(batch, gap))
+                break;
+
+            buf[gap - start] = batch->DATA[gap];
+            end = gap;
+        }
+
+        dev->transport->writeBurst(dev->transport->ctx, dev->ADDR, start, buf, end - start + 1);
+        transactions++;
+        reg = end;
+    }
+
+    for(reg = 0; reg < 4; reg++)
+        batch->PENDING[reg] = 0;
+
+    return transactions;
+}
+
+/**
+ *  \brief Send all pending register writes and end the batch
+ *  
+ *  \param [in] dev Device handle
+ *  \return Number of bus transactions
+ *  
+ *  \details Inside a nested batch only the nesting level is decremented
+ *  and 0 is returned.
+ */
+uint8_t mpu6050_batchCommit(tMPU6050_DEV *dev)
+{
+    uint8_t transactions;
+
+    if(dev->BATCH_DEPTH == 0 || --dev->BATCH_DEPTH > 0)
+        return 0;
+
+    transactions = mpu6050_batchFlush(dev);
+    dev->batch = 0;
+
+    return transactions;
+}
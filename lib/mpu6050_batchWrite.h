@@ -0,0 +1,51 @@
+/*
+ * This file is part of the MPU6050-Library distribution (https://github.com/jmherzog-de/MPU6050-Library).
+ * Copyright (c) 2021 Jean-Marcel Herzog.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ *  \file mpu6050_batchWrite.h
+ *  \brief Batch Write headerfile
+ *  \copyright Copyright 2021 Jean-Marcel Herzog. All rights reserved. This project is released under the GNU Public License.
+ */
+
+#ifndef MPU6050_BATCHWRITE_H_
+#define MPU6050_BATCHWRITE_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "mpu6050_transport.h"
+
+/** Maximum number of cached registers rewritten to join two runs of pending writes */
+#ifndef MPU6050_BATCH_GAP
+#define MPU6050_BATCH_GAP   2
+#endif
+
+/**
+ *  \brief Datatype for pending register writes
+ */
+typedef struct
+{
+    uint32_t PENDING[4];    /**< One bit per register: a write is pending */
+    uint8_t DATA[128];      /**< Pending register values */
+}
+tMPU6050_BATCH;
+
+extern void mpu6050_batchBegin(tMPU6050_DEV*, tMPU6050_BATCH *batch);
+extern uint8_t mpu6050_batchCommit(tMPU6050_DEV*);
+extern uint8_t mpu6050_batchFlush(tMPU6050_DEV*);
+extern void mpu6050_batchWrite(tMPU6050_DEV*, uint8_t ui8Reg, uint8_t ui8Data);
+
+#endif
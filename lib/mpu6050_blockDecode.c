@@ -0,0 +1,380 @@
+/*
+ * This file is part of the MPU6050-Library distribution (https://github.com/jmherzog-de/MPU6050-Library).
+ * Copyright (c) 2021 Jean-Marcel Herzog.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ *  \file mpu6050_blockDecode.c
+ *  \brief Block Decoder
+ *  
+ *  Decodes a contiguous block of frames of big-endian 16 bit words, as read
+ *  from the FIFO (see mpu6050_fifoReadWrite.c), with burst reads of the
+ *  measurement registers or from a recording, into one array per channel
+ *  (structure of arrays). Channel c of frame f is the word at byte offset
+ *  2 * (f * ui8Channels + c); e.g. a burst of MPU6050_MOTION_BURST_LEN bytes
+ *  is a frame of 7 channels ACCEL X, Y, Z, TEMP, GYRO X, Y, Z.
+ *  
+ *  A SIMD step loads every frame of 8 frames into one vector, swaps the
+ *  bytes of every word with one byte shuffle and transposes the 8 x 8 word
+ *  matrix with three stages of unpack instructions. Row c of the result is
+ *  channel c of the 8 frames. The cost per step does not depend on the
+ *  channel count. The instruction set is selected at compile time
+ *  (MPU6050_BLOCK_ISA):
+ *  
+ *  | ISA    | Frames per step | Byte swap / transpose                   |
+ *  |--------|-----------------|-----------------------------------------|
+ *  | AVX2   | 16              | _mm256_shuffle_epi8 / _mm256_unpack*, 8 frames per lane |
+ *  | SSSE3  | 8               | _mm_shuffle_epi8 / _mm_unpack*          |
+ *  | NEON   | 8               | vrev16q_u8 / vzip1q, vzip2q (AArch64)   |
+ *  | scalar | 1               | (high << 8) | low                       |
+ *  
+ *  Remaining frames at the end of a block are decoded with the scalar code.
+ *  
+ *  \copyright Copyright 2021 Jean-Marcel Herzog. All rights reserved. This project is released under the GNU Public License.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include "mpu6050_blockDecode.h"
+
+#if MPU6050_BLOCK_ISA == MPU6050_BLOCK_ISA_SSSE3 || MPU6050_BLOCK_ISA == MPU6050_BLOCK_ISA_AVX2
+#include <immintrin.h>
+#elif MPU6050_BLOCK_ISA == MPU6050_BLOCK_ISA_NEON
+#include <arm_neon.h>
+#endif
+
+/** Frames per conversion step of mpu6050_blockDecodeFloat() */
+#define MPU6050_BLOCK_CHUNK     64
+
+/**
+ *  \brief Decode frames with the scalar code
+ *  
+ *  \param [in] pui8Data Frames of big-endian 16 bit words
+ *  \param [in] ui32Frames Number of frames
+ *  \param [in] ui8Channels Number of words per frame (1 to MPU6050_BLOCK_MAX_CHANNELS)
+ *  \param [in] ppi16Out One array of ui32Frames values per channel
+ *  
+ *  \details Reference for the SIMD code.
+ */
+void mpu6050_blockDecodeScalar(const uint8_t *pui8Data, uint32_t ui32Frames, uint8_t ui8Channels, int16_t * const *ppi16Out)
+{
+    uint32_t f;
+    uint8_t c;
+
+    for(f = 0; f < ui32Frames; f++)
+        for(c = 0; c < ui8Channels; c++, pui8Data += 2)
+            ppi16Out[c][f] = (int16_t)(((uint16_t)pui8Data[0] << 8) | pui8Data[1]);
+}
+
+#if MPU6050_BLOCK_ISA != MPU6050_BLOCK_ISA_SCALAR
+
+/**
+ *  \brief Check that a SIMD step starting at ui32Frame stays inside the block
+ *  
+ *  \details Every frame of a step is loaded with one 16 byte load, which
+ *  reads up to 14 bytes past the frame. The step must end early enough
+ *  that the last load stays inside the block.
+ */
+static inline bool mpu6050_blockStepFits(uint32_t ui32Frame, uint32_t ui32Step, uint32_t ui32Frames, uint8_t ui8Channels)
+{
+    return (size_t)(ui32Frame + ui32Step - 1) * 2u * ui8Channels + 16u <= (size_t)ui32Frames * 2u * ui8Channels;
+}
+
+#endif
+
+#if MPU6050_BLOCK_ISA == MPU6050_BLOCK_ISA_AVX2
+
+/**
+ *  \brief Decode steps of 16 frames
+ *  
+ *  \return Number of frames decoded
+ *  
+ *  \details Lane 0 holds frames 0 to 7 of the step, lane 1 frames 8 to 15,
+ *  so every transposed vector is 16 consecutive values of one channel.
+ */
+static uint32_t mpu6050_blockDecodeSimd(const uint8_t *pui8Data, uint32_t ui32Frames, uint8_t ui8Channels, int16_t * const *ppi16Out)
+{
+    const __m256i swap = _mm256_setr_epi8(1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14,
+                                          1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14);
+    const uint32_t frameSize = 2u * ui8Channels;
+    __m256i r[8], a[8], b[8], col[8];
+    uint32_t f;
+    uint8_t k, c;
+
+    for(f = 0; mpu6050_blockStepFits(f, 16, ui32Frames, ui8Channels); f += 16, pui8Data += 16 * frameSize)
+    {
+        for(k = 0; k < 8; k++)
+            r[k] = _mm256_shuffle_epi8(_mm256_inserti128_si256(
+                       _mm256_castsi128_si256(_mm_loadu_si128((const __m128i*)(pui8Data + k * frameSize))),
+                       _mm_loadu_si128((const __m128i*)(pui8Data + (k + 8) * frameSize)), 1), swap);
+
+        for(k = 0; k < 8; k += 2)
+        {
+            a[k] = _mm256_unpacklo_epi16(r[k], r[k + 1]);
+            a[k + 1] = _mm256_unpackhi_epi16(r[k], r[k + 1]);
+        }
+        for(k = 0; k < 8; k += 4)
+        {
+            b[k] = _mm256_unpacklo_epi32(a[k], a[k + 2]);
+            b[k + 1] = _mm256_unpackhi_epi32(a[k], a[k + 2]);
+            b[k + 2] = _mm256_unpacklo_epi32(a[k + 1], a[k + 3]);
+            b[k + 3] = _mm256_unpackhi_epi32(a[k + 1], a[k + 3]);
+        }
+        for(k = 0; k < 4; k++)
+        {
+            col[2 * k] = _mm256_unpacklo_epi64(b[k], b[k + 4]);
+            col[2 * k + 1] = _mm256_unpackhi_epi64(b[k], b[k + 4]);
+        }
+
+        for(c = 0; c < ui8Channels; c++)
+            _mm256_storeu_si256((__m256i*)(ppi16Out[c] + f), col[c]);
+    }
+    return f;
+}
+
+/**
+ *  \brief Convert one channel to float
+ */
+static uint32_t mpu6050_blockScaleSimd(const int16_t *pi16In, uint32_t ui32Count, float fScale, float fOffset, float *pfOut)
+{
+    const __m256 scale = _mm256_set1_ps(fScale);
+    const __m256 offset = _mm256_set1_ps(fOffset);
+    uint32_t i;
+
+    for(i = 0; i + 8 <= ui32Count; i += 8)
+    {
+        __m256i x = _mm256_cvtepi16_epi32(_mm_loadu_si128((const __m128i*)(pi16In + i)));
+
+        _mm256_storeu_ps(pfOut + i, _mm256_add_ps(_mm256_mul_ps(_mm256_cvtepi32_ps(x), scale), offset));
+    }
+    return i;
+}
+
+#elif MPU6050_BLOCK_ISA == MPU6050_BLOCK_ISA_SSSE3
+
+/**
+ *  \brief Decode steps of 8 frames
+ *  
+ *  \return Number of frames decoded
+ */
+static uint32_t mpu6050_blockDecodeSimd(const uint8_t *pui8Data, uint32_t ui32Frames, uint8_t ui8Channels, int16_t * const *ppi16Out)
+{
+    const __m128i swap = _mm_setr_epi8(1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14);
+    const uint32_t frameSize = 2u * ui8Channels;
+    __m128i r[8], a[8], b[8], col[8];
+    uint32_t f;
+    uint8_t k, c;
+
+    for(f = 0; mpu6050_blockStepFits(f, 8, ui32Frames, ui8Channels); f += 8, pui8Data += 8 * frameSize)
+    {
+        for(k = 0; k < 8; k++)
+            r[k] = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)(pui8Data + k * frameSize)), swap);
+
+        for(k = 0; k < 8; k += 2)
+        {
+            a[k] = _mm_unpacklo_epi16(r[k], r[k + 1]);
+            a[k + 1] = _mm_unpackhi_epi16(r[k], r[k + 1]);
+        }
+        for(k = 0; k < 8; k += 4)
+        {
+            b[k] = _mm_unpacklo_epi32(a[k], a[k + 2]);
+            b[k + 1] = _mm_unpackhi_epi32(a[k], a[k + 2]);
+            b[k + 2] = _mm_unpacklo_epi32(a[k + 1], a[k + 3]);
+            b[k + 3] = _mm_unpackhi_epi32(a[k + 1], a[k + 3]);
+        }
+        for(k = 0; k < 4; k++)
+        {
+            col[2 * k] = _mm_unpacklo_epi64(b[k], b[k + 4]);
+            col[2 * k + 1] = _mm_unpackhi_epi64(b[k], b[k + 4]);
+        }
+
+        for(c = 0; c < ui8Channels; c++)
+            _mm_storeu_si128((__m128i*)(ppi16Out[c] + f), col[c]);
+    }
+    return f;
+}
+
+/**
+ *  \brief Convert one channel to float
+ */
+static uint32_t mpu6050_blockScaleSimd(const int16_t *pi16In, uint32_t ui32Count, float fScale, float fOffset, float *pfOut)
+{
+    const __m128 scale = _mm_set1_ps(fScale);
+    const __m128 offset = _mm_set1_ps(fOffset);
+    uint32_t i;
+
+    for(i = 0; i + 8 <= ui32Count; i += 8)
+    {
+        __m128i x = _mm_loadu_si128((const __m128i*)(pi16In + i));
+        __m128i lo = _mm_srai_epi32(_mm_unpacklo_epi16(x, x), 16);
+        __m128i hi = _mm_srai_epi32(_mm_unpackhi_epi16(x, x), 16);
+
+        _mm_storeu_ps(pfOut + i, _mm_add_ps(_mm_mul_ps(_mm_cvtepi32_ps(lo), scale), offset));
+        _mm_storeu_ps(pfOut + i + 4, _mm_add_ps(_mm_mul_ps(_mm_cvtepi32_ps(hi), scale), offset));
+    }
+    return i;
+}
+
+#elif MPU6050_BLOCK_ISA == MPU6050_BLOCK_ISA_NEON
+
+/**
+ *  \brief Decode steps of 8 frames
+ *  
+ *  \return Number of frames decoded
+ */
+static uint32_t mpu6050_blockDecodeSimd(const uint8_t *pui8Data, uint32_t ui32Frames, uint8_t ui8Channels, int16_t * const *ppi16Out)
+{
+    const uint32_t frameSize = 2u * ui8Channels;
+    uint16x8_t r[8], a[8], col[8];
+    uint32x4_t b[8];
+    uint32_t f;
+    uint8_t k, c;
+
+    for(f = 0; mpu6050_blockStepFits(f, 8, ui32Frames, ui8Channels); f += 8, pui8Data += 8 * frameSize)
+    {
+        for(k = 0; k < 8; k++)
+            r[k] = vreinterpretq_u16_u8(vrev16q_u8(vld1q_u8(pui8Data + k * frameSize)));
+
+        for(k = 0; k < 8; k += 2)
+        {
+            a[k] = vzip1q_u16(r[k], r[k + 1]);
+            a[k + 1] = vzip2q_u16(r[k], r[k + 1]);
+        }
+        for(k = 0; k < 8; k += 4)
+        {
+            b[k] = vzip1q_u32(vreinterpretq_u32_u16(a[k]), vreinterpretq_u32_u16(a[k + 2]));
+            b[k + 1] = vzip2q_u32(vreinterpretq_u32_u16(a[k]), vreinterpretq_u32_u16(a[k + 2]));
+            b[k + 2] = vzip1q_u32(vreinterpretq_u32_u16(a[k + 1]), vreinterpretq_u32_u16(a[k + 3]));
+            b[k + 3] = vzip2q_u32(vreinterpretq_u32_u16(a[k + 1]), vreinterpretq_u32_u16(a[k + 3]));
+        }
+        for(k = 0; k < 4; k++)
+        {
+            col[2 * k] = vreinterpretq_u16_u64(vzip1q_u64(vreinterpretq_u64_u32(b[k]), vreinterpretq_u64_u32(b[k + 4])));
+            col[2 * k + 1] = vreinterpretq_u16_u64(vzip2q_u64(vreinterpretq_u64_u32(b[k]), vreinterpretq_u64_u32(b[k + 4])));
+        }
+
+        for(c = 0; c < ui8Channels; c++)
+            vst1q_s16(ppi16Out[c] + f, vreinterpretq_s16_u16(col[c]));
+    }
+    return f;
+}
+
+/**
+ *  \brief Convert one channel to float
+ */
+static uint32_t mpu6050_blockScaleSimd(const int16_t *pi16In, uint32_t ui32Count, float fScale, float fOffset, float *pfOut)
+{
+    const float32x4_t offset = vdupq_n_f32(fOffset);
+    uint32_t i;
+
+    for(i = 0; i + 8 <= ui32Count; i += 8)
+    {
+        int16x8_t x = vld1q_s16(pi16In + i);
+
+        vst1q_f32(pfOut + i, vmlaq_n_f32(offset, vcvtq_f32_s32(vmovl_s16(vget_low_s16(x))), fScale));
+        vst1q_f32(pfOut + i + 4, vmlaq_n_f32(offset, vcvtq_f32_s32(vmovl_high_s16(x)), fScale));
+    }
+    return i;
+}
+
+#else
+
+static uint32_t mpu6050_blockDecodeSimd(const uint8_t *pui8Data, uint32_t ui32Frames, uint8_t ui8Channels, int16_t * const *ppi16Out)
+{
+    (void)pui8Data; (void)ui32Frames; (void)ui8Channels; (void)ppi16Out;
+    return 0;
+}
+
+static uint32_t mpu6050_blockScaleSimd(const int16_t *pi16In, uint32_t ui32Count, float fScale, float fOffset, float *pfOut)
+{
+    (void)pi16In; (void)ui32Count; (void)fScale; (void)fOffset; (void)pfOut;
+    return 0;
+}
+
+#endif
+
+/**
+ *  \brief Decode frames into one int16 array per channel
+ *  
+ *  \param [in] pui8Data Frames of big-endian 16 bit words
+ *  \param [in] ui32Frames Number of frames
+ *  \param [in] ui8Channels Number of words per frame (1 to MPU6050_BLOCK_MAX_CHANNELS)
+ *  \param [in] ppi16Out One array of ui32Frames values per channel
+ */
+void mpu6050_blockDecode(const uint8_t *pui8Data, uint32_t ui32Frames, uint8_t ui8Channels, int16_t * const *ppi16Out)
+{
+    int16_t *tail[MPU6050_BLOCK_MAX_CHANNELS];
+    uint32_t done;
+    uint8_t c;
+
+    if(ui8Channels == 0 || ui8Channels > MPU6050_BLOCK_MAX_CHANNELS)
+        return;
+
+    done = mpu6050_blockDecodeSimd(pui8Data, ui32Frames, ui8Channels, ppi16Out);
+    if(done == ui32Frames)
+        return;
+
+    for(c = 0; c < ui8Channels; c++)
+        tail[c] = ppi16Out[c] + done;
+    mpu6050_blockDecodeScalar(pui8Data + 2u * ui8Channels * done, ui32Frames - done, ui8Channels, tail);
+}
+
+/**
+ *  \brief Decode frames into one float array per channel
+ *  
+ *  \param [in] pui8Data Frames of big-endian 16 bit words
+ *  \param [in] ui32Frames Number of frames
+ *  \param [in] ui8Channels Number of words per frame (1 to MPU6050_BLOCK_MAX_CHANNELS)
+ *  \param [in] pfScale Scale factor per channel, e.g. ACCEL_SCALE of the device handle
+ *  \param [in] pfOffset Offset per channel added after scaling, 0 for none
+ *  \param [in] ppfOut One array of ui32Frames values per channel
+ *  
+ *  \details The frames are decoded in steps of MPU6050_BLOCK_CHUNK frames
+ *  into a buffer on the stack and converted from there.
+ */
+void mpu6050_blockDecodeFloat(const uint8_t *pui8Data, uint32_t ui32Frames, uint8_t ui8Channels, const float *pfScale, const float *pfOffset, float * const *ppfOut)
+{
+    int16_t buf[MPU6050_BLOCK_MAX_CHANNELS][MPU6050_BLOCK_CHUNK];
+    int16_t *raw[MPU6050_BLOCK_MAX_CHANNELS];
+    uint32_t done = 0;
+    uint8_t c;
+
+    if(ui8Channels == 0 || ui8Channels > MPU6050_BLOCK_MAX_CHANNELS)
+        return;
+
+    for(c = 0; c < ui8Channels; c++)
+        raw[c] = buf[c];
+
+    while(done < ui32Frames)
+    {
+        uint32_t n = ui32Frames - done;
+
+        if(n > MPU6050_BLOCK_CHUNK)
+            n = MPU6050_BLOCK_CHUNK;
+
+        mpu6050_blockDecode(pui8Data + 2u * ui8Channels * done, n, ui8Channels, raw);
+        for(c = 0; c < ui8Channels; c++)
+        {
+            const float offset = pfOffset ? pfOffset[c] : 0.0f;
+            float *out = ppfOut[c] + done;
+            uint32_t i = mpu6050_blockScaleSimd(buf[c], n, pfScale[c], offset, out);
+
+            for(; i < n; i++)
+                out[i] = buf[c][i] * pfScale[c] + offset;
+        }
+        done += n;
+    }
+}
@@ -0,0 +1,56 @@
+/*
+ * This file is part of the MPU6050-Library distribution (https://github.com/jmherzog-de/MPU6050-Library).
+ * Copyright (c) 2021 Jean-Marcel Herzog.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ *  \file mpu6050_blockDecode.h
+ *  \brief Block Decoder headerfile
+ *  \copyright Copyright 2021 Jean-Marcel Herzog. All rights reserved. This project is released under the GNU Public License.
+ */
+
+#ifndef MPU6050_BLOCKDECODE_H_
+#define MPU6050_BLOCKDECODE_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/** Largest number of 16 bit words per frame (FIFO frame without external sensor data: 7) */
+#define MPU6050_BLOCK_MAX_CHANNELS  8
+
+/** Instruction set of mpu6050_blockDecode() */
+#define MPU6050_BLOCK_ISA_SCALAR    0
+#define MPU6050_BLOCK_ISA_SSSE3     1
+#define MPU6050_BLOCK_ISA_AVX2      2
+#define MPU6050_BLOCK_ISA_NEON      3
+
+/** Selected from the compiler target, define to MPU6050_BLOCK_ISA_SCALAR to disable SIMD */
+#ifndef MPU6050_BLOCK_ISA
+#if defined(__AVX2__)
+#define MPU6050_BLOCK_ISA           MPU6050_BLOCK_ISA_AVX2
+#elif defined(__SSSE3__)
+#define MPU6050_BLOCK_ISA           MPU6050_BLOCK_ISA_SSSE3
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#define MPU6050_BLOCK_ISA           MPU6050_BLOCK_ISA_NEON
+#else
+#define MPU6050_BLOCK_ISA           MPU6050_BLOCK_ISA_SCALAR
+#endif
+#endif
+
+extern void mpu6050_blockDecode(const uint8_t *pui8Data, uint32_t ui32Frames, uint8_t ui8Channels, int16_t * const *ppi16Out);
+extern void mpu6050_blockDecodeScalar(const uint8_t *pui8Data, uint32_t ui32Frames, uint8_t ui8Channels, int16_t * const *ppi16Out);
+extern void mpu6050_blockDecodeFloat(const uint8_t *pui8Data, uint32_t ui32Frames, uint8_t ui8Channels, const float *pfScale, const float *pfOffset, float * const *ppfOut);
+
+#endif
@@ -43,44 +43,32 @@
 
 #include <stdint.h>
 #include <stdbool.h>
-#include "i2c.h"
-#include "mpu6050_reg.h"
+#include "mpu6050_transport.h"
+#include "mpu6050_registerCodec.h"
 #include "mpu6050_bypassEnableConfiguration.h"
 
 /**
  *  \brief Read Interrupt Pin Configuration Register
  *  
+ *  \param [in] dev Device handle
  *  \param [in] obj Datatype pointer to return register values
  *  
  *  \details See register datasheet chapter 4.14 for more details
  */
-void mpu6050_intPinCfgReadReg(tMPU6050_INT_PIN_CFG *obj)
+void mpu6050_intPinCfgReadReg(tMPU6050_DEV *dev, tMPU6050_INT_PIN_CFG *obj)
 {
-    uint8_t reg = i2c_receive(MPU6050_I2C_ADDR, MPU6050_INT_PIN_CFG);
-    obj->INT_LEVEL = reg >> 7;
-    obj->INT_OPEN = (reg >> 6) & 0x01;
-    obj->LATCH_INT_EN = (reg >> 5) & 0x01;
-    obj->INT_RD_CLEAR = (reg >> 4) & 0x01;
-    obj->FSYNC_INT_LEVEL = (reg >> 3) & 0x01;
-    obj->FSYNC_INT_EN = (reg >> 2) & 0x01;
-    obj->I2C_BYPASS_EN = (reg >> 1) & 0x01;
+    mpu6050_regRead(dev, MPU6050_CODEC_INT_PIN_CFG, obj);
 }
 
 /**
  *  \brief Write Interrupt Pin Configuration Register
  *  
+ *  \param [in] dev Device handle
  *  \param [in] obj Datatype pointer to return register values
  *  
  *  \details See register datasheet chapter 4.14 for more details
  */
-void mpu6050_intPinCfgWriteReg(tMPU6050_INT_PIN_CFG *obj)
+void mpu6050_intPinCfgWriteReg(tMPU6050_DEV *dev, tMPU6050_INT_PIN_CFG *obj)
 {
-    uint8_t reg = (uint8_t)(obj->INT_LEVEL) << 7;
-    reg |= (uint8_t)(obj->INT_OPEN) << 6;
-    reg |= (uint8_t)(obj->LATCH_INT_EN) << 5;
-    reg |= (uint8_t)(obj->INT_RD_CLEAR) << 4;
-    reg |= (uint8_t)(obj->FSYNC_INT_LEVEL) << 3;
-    reg |= (uint8_t)(obj->FSYNC_INT_EN) << 2;
-    reg |= (uint8_t)(obj->I2C_BYPASS_EN) << 1;
-    i2c_write(MPU6050_I2C_ADDR, MPU6050_INT_PIN_CFG, reg);
+    mpu6050_regWrite(dev, MPU6050_CODEC_INT_PIN_CFG, obj);
 }
\ No newline at end of file
@@ -27,60 +27,67 @@
 /**
  *  \brief Interrupt Pin Configuration datatype
  */
-typedef struct
+typedef union
 {
-    /** 
-     * When this bit is equal to 0, the logic level for the INT pin is active high.
-     * When this bit is equal to 1, the logic level for the INT pin is active low. 
-     */
-    bool INT_LEVEL;
+    uint8_t RAW;                /**< Register value */
 
-	/**
-	 * When this bit is equal to 0, the INT pin is configured as push-pull.
-	 * When this bit is equal to 1, the INT pin is configured as open drain.
-	 */
-    bool INT_OPEN;
+    struct
+    {
+        unsigned char : 1;
 
-	/**
-	 * When this bit is equal to 0, the INT pin emits a 50us long pulse.
-	 * When this bit is equal to 1, the INT pin is held high until the interrupt is cleared.
-	 */
-    bool LATCH_INT_EN;
+        /**
+         * When this bit is equal to 1 and I2C_MST_EN (Register 106) is equal to 0, the host application
+         * processor will be able to directly access the auxiliary I2C bus of the MPU6050.
+         * When this bit is equal to 0, the host application processor will not be able to directly
+         * access the auxiliary I2C bus of the MPU6050 regardless of the state of I2C_MST_EN.
+         * When this bit is equal to 0, the host application processor will not be able to directly
+         * access the auxiliary I2C bus of the MPU6050 regardless of the state of I2C_MST_EN. 
+    	 */
+        bool I2C_BYPASS_EN : 1;
 
-	/**
-	 * When this bit is equal to 0, interrupt status bits are cleared only by reading
-	 * INT_STATUS (Register 58).
-	 * When this bit is equal to 1, interrupt status bits are cleared on any read operation.
-	 */
-    bool INT_RD_CLEAR;
+    	/**
+    	 * When equal to 0, this bit disables the FSYNC pin from causing an interrupt to the host processor.
+    	 * When equal to 1, this bit enables the FSYNC pin to be used as an interrupt to the host processor.
+    	 */
+        bool FSYNC_INT_EN : 1;
 
-	/**
-	 * When this bit is equal to 0, the logic level for the FSYNC pin (when used as
-	 * an interrupt to the host processor) is active high.
-	 * When this bit is equal to 1, the logic level for the FSYNC pin (when used as
-	 * an interrupt to the host processor) is active low.
-	 */
-    bool FSYNC_INT_LEVEL;
-	 
-	/**
-	 * When equal to 0, this bit disables the FSYNC pin from causing an interrupt to the host processor.
-	 * When equal to 1, this bit enables the FSYNC pin to be used as an interrupt to the host processor.
-	 */
-    bool FSYNC_INT_EN;
+    	/**
+    	 * When this bit is equal to 0, the logic level for the FSYNC pin (when used as
+    	 * an interrupt to the host processor) is active high.
+    	 * When this bit is equal to 1, the logic level for the FSYNC pin (when used as
+    	 * an interrupt to the host processor) is active low.
+    	 */
+        bool FSYNC_INT_LEVEL : 1;
 
-    /**
-     * When this bit is equal to 1 and I2C_MST_EN (Register 106) is equal to 0, the host application
-     * processor will be able to directly access the auxiliary I2C bus of the MPU6050.
-     * When this bit is equal to 0, the host application processor will not be able to directly
-     * access the auxiliary I2C bus of the MPU6050 regardless of the state of I2C_MST_EN.
-     * When this bit is equal to 0, the host application processor will not be able to directly
-     * access the auxiliary I2C bus of the MPU6050 regardless of the state of I2C_MST_EN. 
-	 */
-    bool I2C_BYPASS_EN;
+    	/**
+    	 * When this bit is equal to 0, interrupt status bits are cleared only by reading
+    	 * INT_STATUS (Register 58).
+    	 * When this bit is equal to 1, interrupt status bits are cleared on any read operation.
+    	 */
+        bool INT_RD_CLEAR : 1;
+
+    	/**
+    	 * When this bit is equal to 0, the INT pin emits a 50us long pulse.
+    	 * When this bit is equal to 1, the INT pin is held high until the interrupt is cleared.
+    	 */
+        bool LATCH_INT_EN : 1;
+
+    	/**
+    	 * When this bit is equal to 0, the INT pin is configured as push-pull.
+    	 * When this bit is equal to 1, the INT pin is configured as open drain.
+    	 */
+        bool INT_OPEN : 1;
+
+        /** 
+         * When this bit is equal to 0, the logic level for the INT pin is active high.
+         * When this bit is equal to 1, the logic level for the INT pin is active low. 
+         */
+        bool INT_LEVEL : 1;
+    };
 }
 tMPU6050_INT_PIN_CFG;
 
-extern void mpu6050_intPinCfgReadReg(tMPU6050_INT_PIN_CFG*);
-extern void mpu6050_intPinCfgWriteReg(tMPU6050_INT_PIN_CFG*);
+extern void mpu6050_intPinCfgReadReg(tMPU6050_DEV*, tMPU6050_INT_PIN_CFG*);
+extern void mpu6050_intPinCfgWriteReg(tMPU6050_DEV*, tMPU6050_INT_PIN_CFG*);
 
 #endif
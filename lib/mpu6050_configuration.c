@@ -48,48 +48,49 @@
  *
  *	|	DLPF_CFG	|	Acc. Bandwidth (Hz)	|	Acc. Delay (ms)	|	Gyro. Bandwidth (Hz)	|	Gyro. Delay (ms)	|	Gyro. Fs (kHz)	|
  *	|:-------------:|:---------------------:|:----------------:|:--------------------------:|:---------------------:|:-----------------:|		
- *	|		0  		|			260			|		0			|			260				|		0.98			|			8		|
- *	|		1  		|			184			|		0			|			260				|		0.98			|			1		|
- *	|		2  		|			94			|		0			|			260				|		0.98			|			1		|
- *	|		3  		|			44			|		0			|			260				|		0.98			|			1		|
- *	|		4  		|			21			|		0			|			260				|		0.98			|			1		|
- *	|		5  		|			10			|		0			|			260				|		0.98			|			1		|
- *	|		6  		|			5			|		0			|			260				|		0.98			|			1		|
+ *	|		0  		|			260			|		0			|			256				|		0.98			|			8		|
+ *	|		1  		|			184			|		2.0			|			188				|		1.9				|			1		|
+ *	|		2  		|			94			|		3.0			|			98				|		2.8				|			1		|
+ *	|		3  		|			44			|		4.9			|			42				|		4.8				|			1		|
+ *	|		4  		|			21			|		8.5			|			20				|		8.3				|			1		|
+ *	|		5  		|			10			|		13.8		|			10				|		13.4			|			1		|
+ *	|		6  		|			5			|		19.0		|			5				|		18.6			|			1		|
  *	|		7  		|		RESERVED		|	RESERVED		|		RESERVED			|		RESERVED		|			8		|
  *  
+ *  mpu6050_odrPlan() selects DLPF_CFG and SMPLRT_DIV for a requested Sample Rate and bandwidth.
+ *  
  *  \copyright Copyright 2021 Jean-Marcel Herzog. All rights reserved. This project is released under the GNU Public License.
  */
 
 #include <stdint.h>
 #include <stdbool.h>
-#include "i2c.h"
-#include "mpu6050_reg.h"
+#include "mpu6050_transport.h"
+#include "mpu6050_registerCodec.h"
 #include "mpu6050_configuration.h"
 
 /**
  *  \brief Read Configuration register
  *  
+ *  \param [in] dev Device handle
  *  \param [in] obj Datatype pointer to return register values
  *   
  *  \details See register datasheet chapter 4.3 for more details.
  */
-void mpu6050_configRegRead(tMPU6050_CONFIG *obj)
+void mpu6050_configRegRead(tMPU6050_DEV *dev, tMPU6050_CONFIG *obj)
 {
-    uint8_t reg = i2c_receive(MPU6050_I2C_ADDR, MPU6050_CONFIG);
-    obj->DLPF_CFG = reg & 0x07;
-    obj->EXT_SYNC_SET = reg >> 3;
+    mpu6050_regRead(dev, MPU6050_CODEC_CONFIG, obj);
 }
 
 /**
  *  \brief Write Configuration register
  *  
+ *  \param [in] dev Device handle
  *  \param [in] obj Datatype pointer to return register values
  *  \return Return description
  *  
  *  \details See register datasheet chapter 4.3 for more details.
  */
-void mpu6050_configRegWrite(tMPU6050_CONFIG *obj)
+void mpu6050_configRegWrite(tMPU6050_DEV *dev, tMPU6050_CONFIG *obj)
 {
-    uint8_t reg = (uint8_t)(obj->EXT_SYNC_SET) << 3 | (uint8_t)(obj->DLPF_CFG);
-    i2c_write(MPU6050_I2C_ADDR, MPU6050_CONFIG, reg);
+    mpu6050_regWrite(dev, MPU6050_CODEC_CONFIG, obj);
 }
\ No newline at end of file
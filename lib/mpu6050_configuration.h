@@ -44,14 +44,20 @@
 /**
  *  \brief Configuration datatype
  */
-typedef struct
+typedef union
 {
-    unsigned char DLPF_CFG : 3;		/**< Configures the DLPF setting. */
-    unsigned char EXT_SYNC_SET : 3;	/**< Configures the FSYNC pin sampling. */
+    uint8_t RAW;                /**< Register value */
+
+    struct
+    {
+        unsigned char DLPF_CFG : 3;		/**< Configures the DLPF setting. */
+        unsigned char EXT_SYNC_SET : 3;	/**< Configures the FSYNC pin sampling. */
+        unsigned char : 2;
+    };
 }
 tMPU6050_CONFIG;
 
-extern void mpu6050_configRegRead(tMPU6050_CONFIG*);
-extern void mpu6050_configRegWrite(tMPU6050_CONFIG*);
+extern void mpu6050_configRegRead(tMPU6050_DEV*, tMPU6050_CONFIG*);
+extern void mpu6050_configRegWrite(tMPU6050_DEV*, tMPU6050_CONFIG*);
 
 #endif
\ No newline at end of file
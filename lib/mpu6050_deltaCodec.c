@@ -0,0 +1,381 @@
+/*
+ * This file is part of the MPU6050-Library distribution (https://github.com/jmherzog-de/MPU6050-Library).
+ * Copyright (c) 2021 Jean-Marcel Herzog.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ *  \file mpu6050_deltaCodec.c
+ *  \brief Delta Sample Compression
+ *  
+ *  Consecutive samples of a sensor at rest or in slow motion differ by a
+ *  few LSB, so the differences need far fewer bits than the samples. Every
+ *  channel is encoded as the difference to its previous value (modulo 2^16,
+ *  so any value can follow any other), zigzag mapped to an unsigned number
+ *  (0, -1, 1, -2, 2, ... become 0, 1, 2, 3, 4, ...) and bit-packed with
+ *  the width of the largest residual of the channel within a block of up
+ *  to 8 samples:
+ *  
+ *  | Bytes     | Content                                                           |
+ *  |:---------:|:-----------------------------------------------------------------:|
+ *  | 1         | Bit 7: keyframe, bits 2..0: number of samples - 1                 |
+ *  | 14        | Keyframe only: first sample, 7 int16 little endian                |
+ *  | 4         | Residual width of channel 0..6, one nibble each, low nibble first |
+ *  | n         | Residuals, sample by sample, channel by channel, LSB first        |
+ *  
+ *  A width nibble of 0 to 14 is the number of bits, 15 stands for 16 bits.
+ *  Channel order is accelerometer x, y, z, temperature, gyroscope x, y, z.
+ *  
+ *  Every MPU6050_DELTA_KEY_INTERVAL blocks (and on request) a block starts
+ *  with a keyframe, an absolute sample. A decoder that lost data waits for
+ *  the next keyframe. The block length follows from the block header, so
+ *  a stream of blocks needs no further framing; after a loss in the middle
+ *  of a block the transport must tell where the next block starts (e.g.
+ *  one telemetry frame per keyframe).
+ *  
+ *  For a sensor at rest with an accelerometer noise of +-32 LSB and a
+ *  gyroscope noise of +-8 LSB a sample takes 5.1 bytes instead of 14.
+ *  The encoder keeps one block (128 bytes) and needs no heap.
+ *  
+ *  \copyright Copyright 2021 Jean-Marcel Herzog. All rights reserved. This project is released under the GNU Public License.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include "mpu6050_deltaCodec.h"
+
+#define MPU6050_DELTA_FLAG_KEY      0x80
+#define MPU6050_DELTA_COUNT_MASK    0x07
+#define MPU6050_DELTA_WIDTH_BYTES   4
+
+/** Channels of a sample in stream order */
+static void mpu6050_deltaChannels(const tMPU6050_MOTION *sample, int16_t *pi16Val)
+{
+    pi16Val[0] = sample->ACCEL.X;
+    pi16Val[1] = sample->ACCEL.Y;
+    pi16Val[2] = sample->ACCEL.Z;
+    pi16Val[3] = sample->TEMP;
+    pi16Val[4] = sample->GYRO.X;
+    pi16Val[5] = sample->GYRO.Y;
+    pi16Val[6] = sample->GYRO.Z;
+}
+
+/** Sample from channels in stream order */
+static void mpu6050_deltaSample(const int16_t *pi16Val, tMPU6050_MOTION *sample)
+{
+    sample->ACCEL.X = pi16Val[0];
+    sample->ACCEL.Y = pi16Val[1];
+    sample->ACCEL.Z = pi16Val[2];
+    sample->TEMP = pi16Val[3];
+    sample->GYRO.X = pi16Val[4];
+    sample->GYRO.Y = pi16Val[5];
+    sample->GYRO.Z = pi16Val[6];
+}
+
+/** Zigzag mapping of the difference b - a modulo 2^16 */
+static uint16_t mpu6050_deltaZigzag(int16_t a, int16_t b)
+{
+    uint16_t d = (uint16_t)((uint16_t)b - (uint16_t)a);
+
+    return (d & 0x8000) ? (uint16_t)(((uint16_t)~d << 1) | 1) : (uint16_t)(d << 1);
+}
+
+/** Inverse of mpu6050_deltaZigzag(): b from a and the residual */
+static int16_t mpu6050_deltaUnzigzag(int16_t a, uint16_t z)
+{
+    uint16_t d = (z & 1) ? (uint16_t)~(z >> 1) : (uint16_t)(z >> 1);
+
+    return (int16_t)(uint16_t)((uint16_t)a + d);
+}
+
+/** Number of bits of a width nibble */
+static uint8_t mpu6050_deltaWidth(uint8_t ui8Code)
+{
+    return ui8Code == 15 ? 16 : ui8Code;
+}
+
+/**
+ *  \brief Encoder initialization
+ *  
+ *  \param [in] enc Encoder
+ *  \param [in] ui16KeyInterval Blocks from one keyframe to the next, e.g.
+ *  MPU6050_DELTA_KEY_INTERVAL; 0 for keyframes on request only
+ *  
+ *  \details The first block starts with a keyframe.
+ */
+void mpu6050_deltaEncInitialization(tMPU6050_DELTA_ENC *enc, uint16_t ui16KeyInterval)
+{
+    memset(enc, 0, sizeof(*enc));
+    enc->KEY_INTERVAL = ui16KeyInterval;
+    enc->KEY_PENDING = true;
+}
+
+/**
+ *  \brief Start the next block with a keyframe
+ *  
+ *  \param [in] enc Encoder
+ *  
+ *  \details E.g. at the start of every transport frame, so each frame
+ *  decodes on its own. Flush the current block first.
+ */
+void mpu6050_deltaKeyframe(tMPU6050_DELTA_ENC *enc)
+{
+    enc->KEY_PENDING = true;
+}
+
+/**
+ *  \brief Write the current block
+ */
+static uint16_t mpu6050_deltaEmit(tMPU6050_DELTA_ENC *enc, uint8_t *pui8Out)
+{
+    uint8_t *p = pui8Out;
+    uint8_t width[MPU6050_DELTA_CHANNELS];
+    uint8_t residuals = enc->COUNT - (enc->KEY ? 1 : 0);
+    uint32_t acc = 0;
+    uint8_t bits = 0;
+    uint8_t c, i;
+
+    *p++ = (uint8_t)((enc->KEY ? MPU6050_DELTA_FLAG_KEY : 0) | (enc->COUNT - 1));
+
+    if(enc->KEY)
+    {
+        for(c = 0; c < MPU6050_DELTA_CHANNELS; c++)
+        {
+            *p++ = (uint8_t)enc->pi16Key[c];
+            *p++ = (uint8_t)((uint16_t)enc->pi16Key[c] >> 8);
+        }
+    }
+
+    // width of the largest residual per channel
+    memset(p, 0, MPU6050_DELTA_WIDTH_BYTES);
+    for(c = 0; c < MPU6050_DELTA_CHANNELS; c++)
+    {
+        uint16_t all = 0;
+        uint8_t code = 0;
+
+        for(i = 0; i < residuals; i++)
+            all |= enc->pui16Residual[i][c];
+        while(all >> code)
+            code++;
+
+        width[c] = (code > 14) ? 16 : code;
+        p[c / 2] |= (uint8_t)(((code > 14) ? 15 : code) << (4 * (c & 1)));
+    }
+    p += MPU6050_DELTA_WIDTH_BYTES;
+
+    for(i = 0; i < residuals; i++)
+    {
+        for(c = 0; c < MPU6050_DELTA_CHANNELS; c++)
+        {
+            acc |= (uint32_t)enc->pui16Residual[i][c] << bits;
+            bits += width[c];
+            while(bits >= 8)
+            {
+                *p++ = (uint8_t)acc;
+                acc >>= 8;
+                bits -= 8;
+            }
+        }
+    }
+    if(bits)
+        *p++ = (uint8_t)acc;
+
+    enc->COUNT = 0;
+    enc->BLOCKS++;
+
+    return (uint16_t)(p - pui8Out);
+}
+
+/**
+ *  \brief Encode one sample
+ *  
+ *  \param [in] enc Encoder
+ *  \param [in] sample Sample
+ *  \param [in] pui8Out Buffer of MPU6050_DELTA_BLOCK_MAX bytes to return a block
+ *  \return Number of bytes written to pui8Out: a complete block every
+ *  MPU6050_DELTA_BLOCK samples, 0 otherwise
+ */
+uint16_t mpu6050_deltaEncode(tMPU6050_DELTA_ENC *enc, const tMPU6050_MOTION *sample, uint8_t *pui8Out)
+{
+    int16_t val[MPU6050_DELTA_CHANNELS];
+    uint8_t c;
+
+    mpu6050_deltaChannels(sample, val);
+
+    if(enc->COUNT == 0)
+    {
+        enc->KEY = enc->KEY_PENDING || (enc->KEY_INTERVAL && enc->BLOCKS >= enc->KEY_INTERVAL);
+        if(enc->KEY)
+        {
+            enc->KEY_PENDING = false;
+            enc->BLOCKS = 0;
+            memcpy(enc->pi16Key, val, sizeof(val));
+        }
+    }
+
+    if(enc->COUNT || !enc->KEY)
+    {
+        uint16_t *residual = enc->pui16Residual[enc->COUNT - (enc->KEY ? 1 : 0)];
+
+        for(c = 0; c < MPU6050_DELTA_CHANNELS; c++)
+            residual[c] = mpu6050_deltaZigzag(enc->pi16Prev[c], val[c]);
+    }
+
+    memcpy(enc->pi16Prev, val, sizeof(val));
+    enc->COUNT++;
+
+    return (enc->COUNT == MPU6050_DELTA_BLOCK) ? mpu6050_deltaEmit(enc, pui8Out) : 0;
+}
+
+/**
+ *  \brief Write the incomplete block
+ *  
+ *  \param [in] enc Encoder
+ *  \param [in] pui8Out Buffer of MPU6050_DELTA_BLOCK_MAX bytes to return the block
+ *  \return Number of bytes written to pui8Out, 0 if the block is empty
+ */
+uint16_t mpu6050_deltaFlush(tMPU6050_DELTA_ENC *enc, uint8_t *pui8Out)
+{
+    return enc->COUNT ? mpu6050_deltaEmit(enc, pui8Out) : 0;
+}
+
+/**
+ *  \brief Decoder initialization
+ *  
+ *  \param [in] dec Decoder
+ *  
+ *  \details Also after a loss of data: blocks are skipped up to the next keyframe.
+ */
+void mpu6050_deltaDecInitialization(tMPU6050_DELTA_DEC *dec)
+{
+    memset(dec, 0, sizeof(*dec));
+}
+
+/**
+ *  \brief Length of the block at the start of the data
+ *  
+ *  \param [in] pui8In Encoded data
+ *  \param [in] ui32Len Number of bytes available
+ *  \return Block length, 0 if the block is incomplete or invalid
+ */
+uint16_t mpu6050_deltaBlockSize(const uint8_t *pui8In, uint32_t ui32Len)
+{
+    uint16_t header, residualBits = 0;
+    uint8_t residuals, c;
+
+    if(ui32Len < 1 || (pui8In[0] & ~(MPU6050_DELTA_FLAG_KEY | MPU6050_DELTA_COUNT_MASK)))
+        return 0;
+
+    header = 1 + ((pui8In[0] & MPU6050_DELTA_FLAG_KEY) ? 2 * MPU6050_DELTA_CHANNELS : 0);
+    residuals = (pui8In[0] & MPU6050_DELTA_COUNT_MASK) + 1 - ((pui8In[0] & MPU6050_DELTA_FLAG_KEY) ? 1 : 0);
+
+    if(ui32Len < (uint32_t)header + MPU6050_DELTA_WIDTH_BYTES)
+        return 0;
+
+    for(c = 0; c < MPU6050_DELTA_CHANNELS; c++)
+        residualBits += mpu6050_deltaWidth((pui8In[header + c / 2] >> (4 * (c & 1))) & 0x0F);
+
+    header += MPU6050_DELTA_WIDTH_BYTES;
+    header += (uint16_t)((residualBits * residuals + 7) / 8);
+
+    return (ui32Len < header) ? 0 : header;
+}
+
+/**
+ *  \brief Decode a stream of blocks
+ *  
+ *  \param [in] dec Decoder
+ *  \param [in] pui8In Encoded data
+ *  \param [in] ui32Len Number of bytes
+ *  \param [in] samples Array to return the samples
+ *  \param [in] ui32Max Number of samples the array can hold
+ *  \param [in] pui32Used Returns the number of bytes decoded, may be 0
+ *  \return Number of samples
+ *  
+ *  \details Decodes complete blocks up to the end of the data or until the
+ *  array is full. Call again with the rest of the data (pui32Used). Blocks
+ *  before the first keyframe are skipped.
+ */
+uint32_t mpu6050_deltaDecode(tMPU6050_DELTA_DEC *dec, const uint8_t *pui8In, uint32_t ui32Len, tMPU6050_MOTION *samples, uint32_t ui32Max, uint32_t *pui32Used)
+{
+    uint32_t n = 0, pos = 0;
+
+    while(pos < ui32Len)
+    {
+        const uint8_t *p = pui8In + pos;
+        uint16_t size = mpu6050_deltaBlockSize(p, ui32Len - pos);
+        uint8_t count = (p[0] & MPU6050_DELTA_COUNT_MASK) + 1;
+        bool key = (p[0] & MPU6050_DELTA_FLAG_KEY) != 0;
+        uint8_t width[MPU6050_DELTA_CHANNELS];
+        uint32_t acc = 0;
+        uint8_t bits = 0;
+        uint8_t c, i;
+
+        if(size == 0)
+        {
+            if(p[0] & ~(MPU6050_DELTA_FLAG_KEY | MPU6050_DELTA_COUNT_MASK))
+            {
+                // not a block header: wait for a keyframe after the next reset
+                dec->ERRORS++;
+                dec->SYNCED = false;
+                pos = ui32Len;
+            }
+            break;
+        }
+        if(n + count > ui32Max)
+            break;
+
+        pos += size;
+        if(!key && !dec->SYNCED)
+        {
+            dec->SKIPPED++;
+            continue;
+        }
+
+        p++;
+        if(key)
+        {
+            for(c = 0; c < MPU6050_DELTA_CHANNELS; c++, p += 2)
+                dec->pi16Prev[c] = (int16_t)(uint16_t)(p[0] | (p[1] << 8));
+            mpu6050_deltaSample(dec->pi16Prev, &samples[n++]);
+            count--;
+            dec->SYNCED = true;
+        }
+
+        for(c = 0; c < MPU6050_DELTA_CHANNELS; c++)
+            width[c] = mpu6050_deltaWidth((p[c / 2] >> (4 * (c & 1))) & 0x0F);
+        p += MPU6050_DELTA_WIDTH_BYTES;
+
+        for(i = 0; i < count; i++)
+        {
+            for(c = 0; c < MPU6050_DELTA_CHANNELS; c++)
+            {
+                while(bits < width[c])
+                {
+                    acc |= (uint32_t)*p++ << bits;
+                    bits += 8;
+                }
+                dec->pi16Prev[c] = mpu6050_deltaUnzigzag(dec->pi16Prev[c], (uint16_t)(acc & ((1u << width[c]) - 1)));
+                acc >>= width[c];
+                bits -= width[c];
+            }
+            mpu6050_deltaSample(dec->pi16Prev, &samples[n++]);
+        }
+    }
+
+    if(pui32Used)
+        *pui32Used = pos;
+    return n;
+}
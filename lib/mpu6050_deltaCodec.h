@@ -0,0 +1,73 @@
+/*
+ * This file is part of the MPU6050-Library distribution (https://github.com/jmherzog-de/MPU6050-Library).
+ * Copyright (c) 2021 Jean-Marcel Herzog.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ *  \file mpu6050_deltaCodec.h
+ *  \brief Delta Sample Compression headerfile
+ *  \copyright Copyright 2021 Jean-Marcel Herzog. All rights reserved. This project is released under the GNU Public License.
+ */
+
+#ifndef MPU6050_DELTACODEC_H_
+#define MPU6050_DELTACODEC_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "mpu6050_motionMeasurements.h"
+
+#define MPU6050_DELTA_CHANNELS      7       /**< accel x,y,z, temperature, gyro x,y,z */
+#define MPU6050_DELTA_BLOCK         8       /**< Samples per block */
+#define MPU6050_DELTA_BLOCK_MAX     (1 + 2 * MPU6050_DELTA_CHANNELS + 4 + MPU6050_DELTA_BLOCK * MPU6050_DELTA_CHANNELS * 2)    /**< Largest encoded block */
+#define MPU6050_DELTA_KEY_INTERVAL  16      /**< Default number of blocks from one keyframe to the next */
+
+/**
+ *  \brief Streaming encoder
+ */
+typedef struct
+{
+    int16_t pi16Prev[MPU6050_DELTA_CHANNELS];                           /**< Previous sample */
+    int16_t pi16Key[MPU6050_DELTA_CHANNELS];                            /**< Keyframe sample of the current block */
+    uint16_t pui16Residual[MPU6050_DELTA_BLOCK][MPU6050_DELTA_CHANNELS];/**< Zigzag residuals of the current block */
+    uint8_t COUNT;                                                      /**< Samples in the current block */
+    bool KEY;                                                           /**< The current block starts with a keyframe */
+    bool KEY_PENDING;                                                   /**< The next block starts with a keyframe */
+    uint16_t KEY_INTERVAL;                                              /**< Blocks from one keyframe to the next */
+    uint16_t BLOCKS;                                                    /**< Blocks since the last keyframe */
+}
+tMPU6050_DELTA_ENC;
+
+/**
+ *  \brief Decoder
+ */
+typedef struct
+{
+    int16_t pi16Prev[MPU6050_DELTA_CHANNELS];   /**< Previous sample */
+    bool SYNCED;                                /**< A keyframe was decoded since the last reset */
+    uint32_t SKIPPED;                           /**< Blocks skipped while waiting for a keyframe */
+    uint32_t ERRORS;                            /**< Truncated or invalid blocks */
+}
+tMPU6050_DELTA_DEC;
+
+extern void mpu6050_deltaEncInitialization(tMPU6050_DELTA_ENC*, uint16_t ui16KeyInterval);
+extern void mpu6050_deltaKeyframe(tMPU6050_DELTA_ENC*);
+extern uint16_t mpu6050_deltaEncode(tMPU6050_DELTA_ENC*, const tMPU6050_MOTION *sample, uint8_t *pui8Out);
+extern uint16_t mpu6050_deltaFlush(tMPU6050_DELTA_ENC*, uint8_t *pui8Out);
+
+extern void mpu6050_deltaDecInitialization(tMPU6050_DELTA_DEC*);
+extern uint16_t mpu6050_deltaBlockSize(const uint8_t *pui8In, uint32_t ui32Len);
+extern uint32_t mpu6050_deltaDecode(tMPU6050_DELTA_DEC*, const uint8_t *pui8In, uint32_t ui32Len, tMPU6050_MOTION *samples, uint32_t ui32Max, uint32_t *pui32Used);
+
+#endif
@@ -0,0 +1,102 @@
+/*
+ * This file is part of the MPU6050-Library distribution (https://github.com/jmherzog-de/MPU6050-Library).
+ * Copyright (c) 2021 Jean-Marcel Herzog.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ *  \file mpu6050_device.c
+ *  \brief Device handle
+ *  
+ *  The device handle makes the library independent of the number of sensors.
+ *  Sensors on different buses use different transports, two sensors on the
+ *  same bus differ in the slave address (AD0 pin low: 0x68, high: 0x69).
+ *  
+ *  The full scale ranges are cached in the handle. They are updated whenever
+ *  ACCEL_CONFIG or GYRO_CONFIG is read or written through the library.
+ *  Together with the range the SI scale factor is cached, so converting a
+ *  sample (see mpu6050_scaledMeasurements.c) is one multiply per axis.
+ *  The shadow register cache starts empty.
+ *  
+ *  \copyright Copyright 2021 Jean-Marcel Herzog. All rights reserved. This project is released under the GNU Public License.
+ */
+
+#include <string.h>
+#include "mpu6050_device.h"
+
+/** Gyroscope sensitivity in LSB/(deg/s) for FS_SEL 0 to 3 */
+static const float gyroSens[4] = { 131.0f, 65.5f, 32.8f, 16.4f };
+
+/** Accelerometer scale in (m/s^2)/LSB for AFS_SEL 0 to 3 */
+static const float accelScale[4] =
+{
+    MPU6050_STANDARD_GRAVITY / 16384.0f,
+    MPU6050_STANDARD_GRAVITY / 8192.0f,
+    MPU6050_STANDARD_GRAVITY / 4096.0f,
+    MPU6050_STANDARD_GRAVITY / 2048.0f
+};
+
+/** Gyroscope scale in (rad/s)/LSB for FS_SEL 0 to 3 */
+static const float gyroScale[4] =
+{
+    MPU6050_DEG_TO_RAD / 131.0f,
+    MPU6050_DEG_TO_RAD / 65.5f,
+    MPU6050_DEG_TO_RAD / 32.8f,
+    MPU6050_DEG_TO_RAD / 16.4f
+};
+
+/**
+ *  \brief Device handle initialization
+ *  
+ *  \param [in] dev Device handle
+ *  \param [in] transport Bus the sensor is connected to
+ *  \param [in] ui8Addr I2C slave address of the sensor
+ *  
+ *  \details The cached values are set to the power on values of the sensor.
+ *  No register is accessed.
+ */
+void mpu6050_devInitialization(tMPU6050_DEV *dev, const tMPU6050_TRANSPORT *transport, uint8_t ui8Addr)
+{
+    memset(dev, 0, sizeof(*dev));
+    dev->transport = transport;
+    dev->ADDR = ui8Addr;
+    mpu6050_devAccelRangeSet(dev, 0);
+    mpu6050_devGyroRangeSet(dev, 0);
+}
+
+/**
+ *  \brief Update the cached accelerometer full scale range
+ *  
+ *  \param [in] dev Device handle
+ *  \param [in] ui8AfsSel Full scale range (0: 2g, 1: 4g, 2: 8g, 3: 16g)
+ */
+void mpu6050_devAccelRangeSet(tMPU6050_DEV *dev, uint8_t ui8AfsSel)
+{
+    dev->AFS_SEL = ui8AfsSel & 0x03;
+    dev->ACCEL_SENS = 16384 >> dev->AFS_SEL;
+    dev->ACCEL_SCALE = accelScale[dev->AFS_SEL];
+}
+
+/**
+ *  \brief Update the cached gyroscope full scale range
+ *  
+ *  \param [in] dev Device handle
+ *  \param [in] ui8FsSel Full scale range (0: 250, 1: 500, 2: 1000, 3: 2000 deg/s)
+ */
+void mpu6050_devGyroRangeSet(tMPU6050_DEV *dev, uint8_t ui8FsSel)
+{
+    dev->FS_SEL = ui8FsSel & 0x03;
+    dev->GYRO_SENS = gyroSens[dev->FS_SEL];
+    dev->GYRO_SCALE = gyroScale[dev->FS_SEL];
+}
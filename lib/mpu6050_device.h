@@ -0,0 +1,108 @@
+/*
+ * This file is part of the MPU6050-Library distribution (https://github.com/jmherzog-de/MPU6050-Library).
+ * Copyright (c) 2021 Jean-Marcel Herzog.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ *  \file mpu6050_device.h
+ *  \brief Device handle headerfile
+ *  \copyright Copyright 2021 Jean-Marcel Herzog. All rights reserved. This project is released under the GNU Public License.
+ */
+
+#ifndef MPU6050_DEVICE_H_
+#define MPU6050_DEVICE_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "mpu6050_transport.h"
+#include "mpu6050_fifoEnable.h"
+#include "mpu6050_batchWrite.h"
+
+/** Standard gravity in m/s^2 */
+#define MPU6050_STANDARD_GRAVITY    9.80665f
+
+/** Conversion factor from degree to radian */
+#define MPU6050_DEG_TO_RAD          0.017453292519943f
+
+/**
+ *  \brief Host time base for sample timestamps
+ *  
+ *  Returns a free-running counter, e.g. a SysTick or timer count.
+ */
+typedef uint32_t (*tMPU6050_CLOCK)(void);
+
+/**
+ *  \brief Datatype for the layout of one FIFO frame
+ *  
+ *  A frame contains the enabled sensor data in order of register number:
+ *  accelerometer (6 bytes), temperature (2 bytes), gyroscope x, y, z
+ *  (2 bytes each) followed by the external sensor data.
+ */
+typedef struct
+{
+    tMPU6050_FIFO_EN EN;    /**< Enabled FIFO sources */
+    uint8_t EXT_SIZE;       /**< Number of external sensor data bytes per frame */
+    uint8_t FRAME_SIZE;     /**< Number of bytes per frame */
+}
+tMPU6050_FIFO_LAYOUT;
+
+/**
+ *  \brief Datatype for the FIFO overflow handling of mpu6050_fifoDrain()
+ */
+typedef struct
+{
+    uint8_t RECOVERY;       /**< Recovery after an overflow (MPU6050_FIFO_RECOVER_x) */
+    uint16_t OVERFLOWS;     /**< Number of overflows detected */
+    uint32_t LOST_FRAMES;   /**< Frames lost by overflows and recoveries, estimated from the time since the last drain (see mpu6050_fifoClockSet()) */
+    uint16_t LEVEL;         /**< FIFO_COUNT read by the last drain */
+    uint16_t REMOVED;       /**< Bytes removed from the FIFO by the last drain (read, discarded or reset) */
+    tMPU6050_CLOCK clock;   /**< Host time base, 0 if not set */
+    uint32_t CLOCK_HZ;      /**< Counts per second of the time base */
+    uint32_t DRAIN_TIME;    /**< Time base at the FIFO_COUNT read of the last drain */
+    bool DRAINED;           /**< DRAIN_TIME is valid */
+}
+tMPU6050_FIFO_STATUS;
+
+/**
+ *  \brief Device handle
+ *  
+ *  One instance per sensor. It selects the bus and the slave address of the
+ *  sensor and caches configuration the library needs to interpret the data
+ *  and to avoid register reads (see mpu6050_shadowRegisters.c).
+ *  Every library function takes the handle as first parameter.
+ */
+struct tMPU6050_DEV
+{
+    const tMPU6050_TRANSPORT *transport;    /**< Bus the sensor is connected to */
+    uint8_t ADDR;                           /**< I2C slave address (MPU6050_I2C_ADDR or MPU6050_I2C_ADDR_ALT) */
+    uint8_t AFS_SEL;                        /**< Cached accelerometer full scale range */
+    uint8_t FS_SEL;                         /**< Cached gyroscope full scale range */
+    uint16_t ACCEL_SENS;                    /**< Accelerometer sensitivity in LSB/g for AFS_SEL */
+    float GYRO_SENS;                        /**< Gyroscope sensitivity in LSB/(deg/s) for FS_SEL */
+    float ACCEL_SCALE;                      /**< Accelerometer scale in (m/s^2)/LSB for AFS_SEL */
+    float GYRO_SCALE;                       /**< Gyroscope scale in (rad/s)/LSB for FS_SEL */
+    tMPU6050_FIFO_LAYOUT FIFO_LAYOUT;       /**< Layout of the FIFO frames */
+    tMPU6050_FIFO_STATUS FIFO_STATUS;       /**< FIFO overflow handling */
+    uint8_t SHADOW[128];                    /**< Shadow copy of the configuration registers */
+    uint32_t SHADOW_VALID[4];               /**< One bit per register: SHADOW holds the sensor value */
+    tMPU6050_BATCH *batch;                  /**< Active batch of register writes, 0 if none */
+    uint8_t BATCH_DEPTH;                    /**< Nesting level of mpu6050_batchBegin() */
+};
+
+extern void mpu6050_devInitialization(tMPU6050_DEV*, const tMPU6050_TRANSPORT *transport, uint8_t ui8Addr);
+extern void mpu6050_devAccelRangeSet(tMPU6050_DEV*, uint8_t ui8AfsSel);
+extern void mpu6050_devGyroRangeSet(tMPU6050_DEV*, uint8_t ui8FsSel);
+
+#endif
@@ -0,0 +1,265 @@
+/*
+ * This file is part of the MPU6050-Library distribution (https://github.com/jmherzog-de/MPU6050-Library).
+ * Copyright (c) 2021 Jean-Marcel Herzog.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ *  \file mpu6050_drainScheduler.c
+ *  \brief FIFO Drain Scheduler
+ *  
+ *  Decides when the host drains the FIFO. Every drain wakes the MCU and
+ *  occupies the bus, so the FIFO should be drained as rarely as possible,
+ *  but never so late that it overflows (see mpu6050_fifoReadWrite.c).
+ *  
+ *  The fill rate of the FIFO is the frame size of the enabled FIFO sources
+ *  times the Sample Rate (SMPLRT_DIV and DLPF_CFG, see
+ *  mpu6050_samplePeriodNs()). It is estimated from the configuration first
+ *  and then measured at every drain from the FIFO_COUNT difference and the
+ *  host clock, which includes the drift of the sensor clock. A drain less
+ *  than one sample period after the previous one or without a new frame
+ *  is no measurement. The drain rate of the bus is measured from the time
+ *  of the burst reads.
+ *  
+ *  The next drain is planned so that the fill level at drain time is the
+ *  middle of the target band [TARGET_LOW, TARGET_HIGH]:
+ *  
+ *      INTERVAL = (target level - bytes left by the last drain) / fill rate
+ *  
+ *  limited to what the caller's buffer can take in one drain (BURST frames).
+ *  The space above TARGET_HIGH absorbs late wake-ups. While the measured
+ *  level stays inside the band the fill rate is filtered, outside the band
+ *  the last measurement is taken directly. After an overflow the fill rate
+ *  is raised to at least the free space divided by the elapsed time and the
+ *  interval is halved. If the bus can not read clearly faster than the FIFO fills
+ *  (a slow or shared bus), the scheduler is SATURATED and drains back to
+ *  back.
+ *  
+ *  Usage:
+ *  
+ *      mpu6050_drainInitialization(&drain, &dev, clock, CLOCK_HZ);
+ *      while(1)
+ *      {
+ *          sleep(mpu6050_drainSleep(&drain));
+ *          n = mpu6050_drainRun(&drain, buf, BUF_FRAMES);
+ *          ...
+ *      }
+ *  
+ *  Call mpu6050_drainRateUpdate() after the sample rate or the FIFO sources
+ *  changed.
+ *  
+ *  \copyright Copyright 2021 Jean-Marcel Herzog. All rights reserved. This project is released under the GNU Public License.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "mpu6050_device.h"
+#include "mpu6050_sampleRateDivider.h"
+#include "mpu6050_drainScheduler.h"
+
+/** A measured fill rate is at least the nominal one minus 1 / MPU6050_DRAIN_RATE_TOLERANCE */
+#define MPU6050_DRAIN_RATE_TOLERANCE    8
+
+/**
+ *  \brief Fill rate of the configured Sample Rate and FIFO layout
+ */
+static uint32_t mpu6050_drainNominal(tMPU6050_DRAIN *drain)
+{
+    uint32_t periodNs = mpu6050_samplePeriodNs(drain->dev);
+
+    return (uint32_t)((uint64_t)drain->dev->FIFO_LAYOUT.FRAME_SIZE * 1000000000ULL / periodNs);
+}
+
+/**
+ *  \brief Plan the next drain from the rates and the bytes left in the FIFO
+ */
+static void mpu6050_drainPlan(tMPU6050_DRAIN *drain)
+{
+    const uint8_t frameSize = drain->dev->FIFO_LAYOUT.FRAME_SIZE;
+    uint32_t target = ((uint32_t)drain->TARGET_LOW + drain->TARGET_HIGH) / 2;
+
+    if(frameSize == 0)
+    {
+        // nothing enters the FIFO: check once a second
+        drain->INTERVAL = drain->CLOCK_HZ;
+        drain->BURST = 0;
+        drain->SATURATED = false;
+        return;
+    }
+
+    // frames do enter: a lost rate estimate falls back to the configuration
+    if(drain->FILL_RATE == 0)
+        drain->FILL_RATE = mpu6050_drainNominal(drain);
+
+    if(drain->CAPACITY && target > (uint32_t)drain->CAPACITY * frameSize)
+        target = (uint32_t)drain->CAPACITY * frameSize;
+    drain->BURST = (uint16_t)(target / frameSize);
+
+    drain->SATURATED = drain->DRAIN_RATE && drain->DRAIN_RATE <= drain->FILL_RATE + drain->FILL_RATE / 8;
+
+    if(drain->SATURATED || target <= drain->LEFT)
+        drain->INTERVAL = 0;
+    else
+        drain->INTERVAL = (uint32_t)((uint64_t)(target - drain->LEFT) * drain->CLOCK_HZ / drain->FILL_RATE);
+}
+
+/**
+ *  \brief Drain scheduler initialization
+ *  
+ *  \param [in] drain Scheduler
+ *  \param [in] dev Device handle with FIFO layout set
+ *  \param [in] clock Free-running host clock
+ *  \param [in] ui32ClockHz Frequency of clock
+ *  
+ *  \details The target band is set to the default. The first drain is
+ *  planned from the configured Sample Rate. The clock also serves the
+ *  lost frame estimate of mpu6050_fifoDrain() (mpu6050_fifoClockSet()).
+ */
+void mpu6050_drainInitialization(tMPU6050_DRAIN *drain, tMPU6050_DEV *dev, tMPU6050_CLOCK clock, uint32_t ui32ClockHz)
+{
+    drain->dev = dev;
+    drain->clock = clock;
+    drain->CLOCK_HZ = ui32ClockHz;
+    drain->TARGET_LOW = MPU6050_DRAIN_TARGET_LOW;
+    drain->TARGET_HIGH = MPU6050_DRAIN_TARGET_HIGH;
+    drain->CAPACITY = 0;
+    drain->DRAIN_RATE = 0;
+    drain->LAST = clock();
+    drain->LEFT = 0;
+    drain->OVERFLOWS = dev->FIFO_STATUS.OVERFLOWS;
+    drain->DRAINS = 0;
+    mpu6050_fifoClockSet(dev, clock, ui32ClockHz);
+    drain->FILL_RATE = mpu6050_drainNominal(drain);
+    mpu6050_drainPlan(drain);
+}
+
+/**
+ *  \brief Set the target band of the fill level at drain time
+ *  
+ *  \param [in] drain Scheduler
+ *  \param [in] ui16Low Lower edge in bytes
+ *  \param [in] ui16High Upper edge in bytes, at most MPU6050_FIFO_SIZE
+ *  
+ *  \details The space between ui16High and MPU6050_FIFO_SIZE must hold the
+ *  data entering the FIFO during the longest wake-up delay of the host.
+ */
+void mpu6050_drainTargetSet(tMPU6050_DRAIN *drain, uint16_t ui16Low, uint16_t ui16High)
+{
+    drain->TARGET_LOW = ui16Low;
+    drain->TARGET_HIGH = ui16High;
+    mpu6050_drainPlan(drain);
+}
+
+/**
+ *  \brief Take the fill rate from the configuration
+ *  
+ *  \param [in] drain Scheduler
+ *  
+ *  \details Call after SMPLRT_DIV, DLPF_CFG or the FIFO sources changed.
+ *  The data that entered the FIFO since the last drain at the old rate is
+ *  estimated and the next drain is planned from now on.
+ */
+void mpu6050_drainRateUpdate(tMPU6050_DRAIN *drain)
+{
+    uint32_t now = drain->clock();
+    uint32_t level;
+
+    level = drain->LEFT + (uint32_t)((uint64_t)drain->FILL_RATE * (now - drain->LAST) / drain->CLOCK_HZ);
+    drain->LEFT = level < MPU6050_FIFO_SIZE ? (uint16_t)level : MPU6050_FIFO_SIZE;
+    drain->LAST = now;
+
+    drain->FILL_RATE = mpu6050_drainNominal(drain);
+    mpu6050_drainPlan(drain);
+}
+
+/**
+ *  \brief Time until the next drain
+ *  
+ *  \param [in] drain Scheduler
+ *  \return Clock ticks the host may sleep, 0 if the drain is due
+ */
+uint32_t mpu6050_drainSleep(tMPU6050_DRAIN *drain)
+{
+    uint32_t elapsed = drain->clock() - drain->LAST;
+
+    return elapsed >= drain->INTERVAL ? 0 : drain->INTERVAL - elapsed;
+}
+
+/**
+ *  \brief Drain the FIFO and plan the next drain
+ *  
+ *  \param [in] drain Scheduler
+ *  \param [in] buf Buffer to return the decoded samples
+ *  \param [in] max Number of samples buf can hold
+ *  \return Number of decoded samples
+ *  
+ *  \details Calls mpu6050_fifoDrain() and updates the fill and drain rates
+ *  from its FIFO_STATUS and the host clock.
+ */
+uint16_t mpu6050_drainRun(tMPU6050_DRAIN *drain, tMPU6050_MOTION *buf, uint16_t max)
+{
+    const tMPU6050_FIFO_STATUS *status = &drain->dev->FIFO_STATUS;
+    uint32_t start = drain->clock();
+    uint32_t elapsed = start - drain->LAST;
+    uint32_t period = (uint32_t)((uint64_t)mpu6050_samplePeriodNs(drain->dev) * drain->CLOCK_HZ / 1000000000ULL);
+    uint32_t busy, rate, least;
+    uint16_t n;
+    bool overflow;
+
+    n = mpu6050_fifoDrain(drain->dev, buf, max);
+    busy = drain->clock() - start;
+
+    overflow = status->OVERFLOWS != drain->OVERFLOWS;
+    drain->OVERFLOWS = status->OVERFLOWS;
+
+    if(overflow && elapsed)
+    {
+        // more than the free space entered: the fill rate is at least
+        rate = (uint32_t)((uint64_t)(MPU6050_FIFO_SIZE - drain->LEFT) * drain->CLOCK_HZ / elapsed);
+        if(rate > drain->FILL_RATE)
+            drain->FILL_RATE = rate;
+    }
+    else if(drain->DRAINS && elapsed && elapsed >= period && status->LEVEL > drain->LEFT)
+    {
+        // only over at least one sample period, a shorter one may see no frame at all
+        rate = (uint32_t)((uint64_t)(status->LEVEL - drain->LEFT) * drain->CLOCK_HZ / elapsed);
+
+        // whole frames over a few periods read low: not below the sensor clock tolerance
+        least = mpu6050_drainNominal(drain);
+        least -= least / MPU6050_DRAIN_RATE_TOLERANCE;
+        if(rate < least)
+            rate = least;
+        if(status->LEVEL < drain->TARGET_LOW || status->LEVEL > drain->TARGET_HIGH)
+            drain->FILL_RATE = rate;
+        else
+            drain->FILL_RATE = (3 * drain->FILL_RATE + rate) / 4;
+    }
+
+    if(n && busy)
+    {
+        rate = (uint32_t)((uint64_t)n * drain->dev->FIFO_LAYOUT.FRAME_SIZE * drain->CLOCK_HZ / busy);
+        drain->DRAIN_RATE = drain->DRAIN_RATE ? (3 * drain->DRAIN_RATE + rate) / 4 : rate;
+    }
+
+    drain->CAPACITY = max;
+    drain->LEFT = status->LEVEL - status->REMOVED;
+    drain->LAST = start;
+    drain->DRAINS++;
+    mpu6050_drainPlan(drain);
+
+    if(overflow)
+        drain->INTERVAL /= 2;
+
+    return n;
+}
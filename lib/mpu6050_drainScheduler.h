@@ -0,0 +1,68 @@
+/*
+ * This file is part of the MPU6050-Library distribution (https://github.com/jmherzog-de/MPU6050-Library).
+ * Copyright (c) 2021 Jean-Marcel Herzog.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ *  \file mpu6050_drainScheduler.h
+ *  \brief FIFO Drain Scheduler headerfile
+ *  \copyright Copyright 2021 Jean-Marcel Herzog. All rights reserved. This project is released under the GNU Public License.
+ */
+
+#ifndef MPU6050_DRAINSCHEDULER_H_
+#define MPU6050_DRAINSCHEDULER_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "mpu6050_transport.h"
+#include "mpu6050_acquisition.h"
+#include "mpu6050_fifoReadWrite.h"
+
+/** Default lower edge of the fill level band at drain time in bytes */
+#define MPU6050_DRAIN_TARGET_LOW    (MPU6050_FIFO_SIZE / 2)
+
+/** Default upper edge of the fill level band at drain time in bytes */
+#define MPU6050_DRAIN_TARGET_HIGH   (MPU6050_FIFO_SIZE * 3 / 4)
+
+/**
+ *  \brief Drain scheduler of one device
+ */
+typedef struct
+{
+    tMPU6050_DEV *dev;          /**< Device to drain */
+    tMPU6050_CLOCK clock;       /**< Time base of the schedule */
+    uint32_t CLOCK_HZ;          /**< Frequency of clock */
+    uint16_t TARGET_LOW;        /**< Lower edge of the fill level band at drain time in bytes */
+    uint16_t TARGET_HIGH;       /**< Upper edge of the fill level band at drain time in bytes */
+    uint16_t CAPACITY;          /**< Frames the caller's buffer holds, 0 if not known yet */
+    uint32_t FILL_RATE;         /**< Bytes per second entering the FIFO */
+    uint32_t DRAIN_RATE;        /**< Bytes per second read from the FIFO over the bus, 0 if not measured yet */
+    uint32_t INTERVAL;          /**< Clock ticks from one drain to the next */
+    uint16_t BURST;             /**< Frames per drain at the target level */
+    bool SATURATED;             /**< The bus can not read faster than the FIFO fills */
+    uint32_t LAST;              /**< Clock at the start of the last drain */
+    uint16_t LEFT;              /**< Bytes left in the FIFO by the last drain */
+    uint16_t OVERFLOWS;         /**< FIFO_STATUS.OVERFLOWS at the last drain */
+    uint32_t DRAINS;            /**< Number of drains */
+}
+tMPU6050_DRAIN;
+
+extern void mpu6050_drainInitialization(tMPU6050_DRAIN*, tMPU6050_DEV*, tMPU6050_CLOCK clock, uint32_t ui32ClockHz);
+extern void mpu6050_drainTargetSet(tMPU6050_DRAIN*, uint16_t ui16Low, uint16_t ui16High);
+extern void mpu6050_drainRateUpdate(tMPU6050_DRAIN*);
+extern uint32_t mpu6050_drainSleep(tMPU6050_DRAIN*);
+extern uint16_t mpu6050_drainRun(tMPU6050_DRAIN*, tMPU6050_MOTION *buf, uint16_t max);
+
+#endif
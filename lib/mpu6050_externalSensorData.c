@@ -64,61 +64,62 @@
 
 #include <stdint.h>
 #include <stdbool.h>
-#include "i2c.h"
-#include "mpu6050_reg.h"
+#include "mpu6050_transport.h"
 #include "mpu6050_externalSensorData.h"
 
 /**
  *  \brief Read from a specific External Sensor Data Register
  *  
+ *  \param [in] dev Device handle
  *  \param [in] obj Datatype pointer to return register values
  *  \param [in] number External sensor data number (0-23)
  *  
  *  \details See register datasheet chapter 4.20 for more details 
  */
-void mpu6050_extSensDataReadReg(tMPU6050_EXT_SENS_DATA *obj, uint8_t number)
+void mpu6050_extSensDataReadReg(tMPU6050_DEV *dev, tMPU6050_EXT_SENS_DATA *obj, uint8_t number)
 {
     if(number > 23)
     {
-        callback();
         return;
     }
 
-    *obj = i2c_receive(MPU6050_I2C_ADDR, (MPU6050_EXT_SENS_DATA_00 + number) );
+    *obj = mpu6050_busRead(dev, (MPU6050_EXT_SENS_DATA_00 + number) );
 }
 
 /**
  *  \brief Write to a specific External Sensor Data Register
  *  
+ *  \param [in] dev Device handle
  *  \param [in] obj Datatype pointer to return register values
  *  \param [in] number Description for number
  *  
  *  \details See register datasheet chapter 4.20 for more details 
  */
-void mpu6050_extSensDataWriteReg(tMPU6050_EXT_SENS_DATA *obj, uint8_t number)
+void mpu6050_extSensDataWriteReg(tMPU6050_DEV *dev, tMPU6050_EXT_SENS_DATA *obj, uint8_t number)
 {
     if(number > 23)
     {
         return;
     }
 
-    i2c_write(MPU6050_I2C_ADDR, (MPU6050_EXT_SENS_DATA_00 + number), *obj);
+    mpu6050_busWrite(dev, (MPU6050_EXT_SENS_DATA_00 + number), *obj);
 }
 
 /**
  *  \brief Read from all External Sensor Data Registers
  *  
+ *  \param [in] dev Device handle
  *  \param [in] obj Datatype pointer to return register values
  *  
  *  \details See register datasheet chapter 4.20 for more details 
  */
-void mpu6050_extSensDataAllReadReg(tMPU6050_EXT_SENS_DATA_ALL *obj)
+void mpu6050_extSensDataAllReadReg(tMPU6050_DEV *dev, tMPU6050_EXT_SENS_DATA_ALL *obj)
 {
     uint8_t n = 0;
     uint8_t addr;
     for(addr = MPU6050_EXT_SENS_DATA_00; addr <= MPU6050_EXT_SENS_DATA_23; addr++)
     {
-        obj->DATA[n] = i2c_receive(MPU6050_I2C_ADDR, addr);
+        obj->DATA[n] = mpu6050_busRead(dev, addr);
         n++;
     }
 }
@@ -126,17 +127,18 @@ void mpu6050_extSensDataAllReadReg(tMPU6050_EXT_SENS_DATA_ALL *obj)
 /**
  *  \brief Write to all External Sensor Data Registers
  *  
+ *  \param [in] dev Device handle
  *  \param [in] obj Datatype pointer to return register values
  *  
  *  \details See register datasheet chapter 4.20 for more details 
  */
-void mpu6050_extSensDataAllWriteReg(tMPU6050_EXT_SENS_DATA_ALL *obj)
+void mpu6050_extSensDataAllWriteReg(tMPU6050_DEV *dev, tMPU6050_EXT_SENS_DATA_ALL *obj)
 {
     uint8_t n = 0;
     uint8_t addr;
     for(addr = MPU6050_EXT_SENS_DATA_00; addr <= MPU6050_EXT_SENS_DATA_23; addr++)
     {
-        i2c_write(MPU6050_I2C_ADDR, addr, obj->DATA[n]);
+        mpu6050_busWrite(dev, addr, obj->DATA[n]);
         n++;
     }
 }
\ No newline at end of file
@@ -38,10 +38,10 @@ typedef struct
 }
 tMPU6050_EXT_SENS_DATA_ALL;
 
-extern void mpu6050_extSensDataReadReg(tMPU6050_EXT_SENS_DATA*, uint8_t number);
-extern void mpu6050_extSensDataWriteReg(tMPU6050_EXT_SENS_DATA*, uint8_t number);
+extern void mpu6050_extSensDataReadReg(tMPU6050_DEV*, tMPU6050_EXT_SENS_DATA*, uint8_t number);
+extern void mpu6050_extSensDataWriteReg(tMPU6050_DEV*, tMPU6050_EXT_SENS_DATA*, uint8_t number);
 
-extern void mpu6050_extSensDataAllReadReg(tMPU6050_EXT_SENS_DATA_ALL*);
-extern void mpu6050_extSensDataAllWriteReg(tMPU6050_EXT_SENS_DATA_ALL*);
+extern void mpu6050_extSensDataAllReadReg(tMPU6050_DEV*, tMPU6050_EXT_SENS_DATA_ALL*);
+extern void mpu6050_extSensDataAllWriteReg(tMPU6050_DEV*, tMPU6050_EXT_SENS_DATA_ALL*);
 
 #endif
@@ -35,35 +35,38 @@
 
 #include <stdint.h>
 #include <stdbool.h>
-#include "i2c.h"
-#include "mpu6050_reg.h"
+#include "mpu6050_transport.h"
 #include "mpu6050_fifoCountRegisters.h"
 
 /**
  *  \brief Read from FIFO Count register
  *  
+ *  \param [in] dev Device handle
  *  \param [in] obj Datatype pointer to return register values
  *  
  *  \details See register datasheet chapter 4.30 for more details.
  */
-void mpu6050_fifoCountReadReg(tMPU6050_FIFO_COUNT *obj)
+void mpu6050_fifoCountReadReg(tMPU6050_DEV *dev, tMPU6050_FIFO_COUNT *obj)
 {
-    uint16_t high = i2c_receive(MPU6050_I2C_ADDR, MPU6050_FIFO_COUNTH);
-    uint16_t low = i2c_receive(MPU6050_I2C_ADDR, MPU6050_FIFO_COUNTL);
-    *obj = (high << 8) | low;
+    uint8_t buf[2];
+
+    // one burst reads FIFO_COUNT_H first, as required
+    mpu6050_busReadBurst(dev, MPU6050_FIFO_COUNTH, buf, 2);
+    *obj = ((uint16_t)buf[0] << 8) | buf[1];
 }
 
 /**
  *  \brief Write to FIFO Count register
  *  
+ *  \param [in] dev Device handle
  *  \param [in] obj Datatype pointer to return register values
  *  
  *  \details See register datasheet chapter 4.30 for more details.
  */
-void mpu6050_fifoCountWriteReg(tMPU6050_FIFO_COUNT *obj)
+void mpu6050_fifoCountWriteReg(tMPU6050_DEV *dev, tMPU6050_FIFO_COUNT *obj)
 {
     uint16_t high = *obj >> 8;
     uint16_t low = *obj & 0xFF;
-    i2c_write(MPU6050_I2C_ADDR, MPU6050_FIFO_COUNTH, high);
-    i2c_write(MPU6050_I2C_ADDR, MPU6050_FIFO_COUNTL, low);
+    mpu6050_busWrite(dev, MPU6050_FIFO_COUNTH, high);
+    mpu6050_busWrite(dev, MPU6050_FIFO_COUNTL, low);
 }
\ No newline at end of file
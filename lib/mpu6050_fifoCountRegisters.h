@@ -35,7 +35,7 @@
   */
 typedef uint16_t tMPU6050_FIFO_COUNT;
 
-extern void mpu6050_fifoCountReadReg(tMPU6050_FIFO_COUNT*);
-extern void mpu6050_fifoCountWriteReg(tMPU6050_FIFO_COUNT*);
+extern void mpu6050_fifoCountReadReg(tMPU6050_DEV*, tMPU6050_FIFO_COUNT*);
+extern void mpu6050_fifoCountWriteReg(tMPU6050_DEV*, tMPU6050_FIFO_COUNT*);
 
 #endif
\ No newline at end of file
@@ -47,46 +47,37 @@
 
 #include <stdint.h>
 #include <stdbool.h>
-#include "i2c.h"
-#include "mpu6050_reg.h"
+#include "mpu6050_transport.h"
+#include "mpu6050_registerCodec.h"
 #include "mpu6050_fifoEnable.h"
+#include "mpu6050_fifoReadWrite.h"
 
 /**
  *  \brief Read FIFO Enable register
  *  
+ *  \param [in] dev Device handle
  *  \param [in] obj Datatype pointer to return register values
  *  
  *  \details See register datasheet chapter 4.6 for more details.
  */
-void mpu6050_fifoEnReadReg(tMPU6050_FIFO_EN *obj)
+void mpu6050_fifoEnReadReg(tMPU6050_DEV *dev, tMPU6050_FIFO_EN *obj)
 {
-    uint8_t reg = i2c_receive(MPU6050_I2C_ADDR, MPU6050_FIFO_EN);
-    obj->TEMP_FIFO_EN = reg >> 7;
-    obj->XG_FIFO_EN = (reg >> 6) & 0x01;
-    obj->YG_FIFO_EN = (reg >> 5) & 0x01;
-    obj->ZG_FIFO_EN = (reg >> 4) & 0x01;
-    obj->ACCEL_FIFO_EN = (reg >> 3) & 0x01;
-    obj->SLV2_FIFO_EN = (reg >> 2) & 0x01;
-    obj->SLV1_FIFO_EN = (reg >> 1 ) & 0x01;
-    obj->SLV0_FIFO_EN = reg & 0x01;
+    mpu6050_regRead(dev, MPU6050_CODEC_FIFO_EN, obj);
+
+    mpu6050_fifoLayoutUpdate(dev, obj);
 }
 
 /**
  *  \brief Write to FIFO Enable register
  *  
+ *  \param [in] dev Device handle
  *  \param [in] obj Datatype pointer to return register values
  *  
  *  \details See register datasheet chapter 4.6 for more details.
  */
-void mpu6050_fifoEnWriteReg(tMPU6050_FIFO_EN *obj)
+void mpu6050_fifoEnWriteReg(tMPU6050_DEV *dev, tMPU6050_FIFO_EN *obj)
 {
-    uint8_t reg = (uint8_t)(obj->TEMP_FIFO_EN) << 7;
-    reg |= (uint8_t)(obj->XG_FIFO_EN) << 6;
-    reg |= (uint8_t)(obj->YG_FIFO_EN) << 5;
-    reg |= (uint8_t)(obj->ZG_FIFO_EN) << 4;
-    reg |= (uint8_t)(obj->ACCEL_FIFO_EN) << 3;
-    reg |= (uint8_t)(obj->SLV2_FIFO_EN) << 2;
-    reg |= (uint8_t)(obj->SLV1_FIFO_EN) << 1;
-    reg |= (uint8_t)(obj->SLV0_FIFO_EN);
-    i2c_write(MPU6050_I2C_ADDR, MPU6050_FIFO_EN, reg);
+    mpu6050_regWrite(dev, MPU6050_CODEC_FIFO_EN, obj);
+
+    mpu6050_fifoLayoutUpdate(dev, obj);
 }
\ No newline at end of file
@@ -39,35 +39,344 @@
  *  previously read from the FIFO until new data is available. The user should check FIFO_COUNT
  *  to ensure that the FIFO buffer is not read when empty.
  *  
+ *  The oldest data is dropped byte by byte. The FIFO size is in general no multiple of
+ *  the frame size, so after an overflow the first byte in the FIFO is not the start of
+ *  a frame and every following frame would be decoded from the wrong bytes.
+ *  mpu6050_fifoDrain() checks FIFO_OFLOW_INT before reading and realigns the reader as
+ *  selected with mpu6050_fifoRecoverySet():
+ *  
+ *  - MPU6050_FIFO_RECOVER_RESET: FIFO_EN is cleared, FIFO_RESET set and FIFO_EN set again.
+ *    All data in the FIFO is lost, streaming continues with the next sample. Two register
+ *    writes, USER_CTRL is taken from the shadow cache.
+ *  - MPU6050_FIFO_RECOVER_DISCARD: the bytes in front of the first complete frame
+ *    (FIFO_COUNT modulo the frame size) are read and dropped, the remaining frames are
+ *    kept. If the drain is slower than the sample rate the FIFO overflows again while it
+ *    is read; use this only if the overflow was caused by a single late drain.
+ *  - MPU6050_FIFO_RECOVER_NONE: only the statistics are updated.
+ *  
+ *  The sensor does not tell how many frames it overwrote. With a host time base set by
+ *  mpu6050_fifoClockSet() (mpu6050_drainInitialization() and mpu6050_tsInitialization()
+ *  set it), LOST_FRAMES estimates them: the frames left by the last drain plus the frames
+ *  sampled since (elapsed time / sample period) minus the frames still in the FIFO, plus
+ *  the frames discarded by the recovery. Without a time base only one frame per overflow
+ *  is counted.
+ *  
  *  \copyright Copyright 2021 Jean-Marcel Herzog. All rights reserved. This project is released under the GNU Public License.
  */
 
 #include <stdint.h>
 #include <stdbool.h>
-#include "i2c.h"
-#include "mpu6050_reg.h"
+#include "mpu6050_device.h"
+#include "mpu6050_fifoCountRegisters.h"
+#include "mpu6050_interruptStatus.h"
+#include "mpu6050_userControl.h"
+#include "mpu6050_sampleRateDivider.h"
 #include "mpu6050_fifoReadWrite.h"
 
+// the largest frame: motion data and 24 bytes of external sensor data
+#if MPU6050_FIFO_DRAIN_BUFFER < MPU6050_MOTION_BURST_LEN + 24
+#error "MPU6050_FIFO_DRAIN_BUFFER must hold one FIFO frame"
+#endif
+
+static uint8_t drainBuffer[MPU6050_FIFO_DRAIN_BUFFER];
+
 /**
  *  \brief Read FIFO Read Write register
  *  
+ *  \param [in] dev Device handle
  *  \param [in] obj Datatype pointer to return register values
  *  
  *  \details See register datasheet chapter 4.31 for more details.
  */
-void mpu6050_fifoRwReadReg(tMPU6050_FIFO_R_W *obj)
+void mpu6050_fifoRwReadReg(tMPU6050_DEV *dev, tMPU6050_FIFO_R_W *obj)
 {
-    *obj = i2c_receive(MPU6050_I2C_ADDR, MPU6050_FIFO_R_W);
+    *obj = mpu6050_busRead(dev, MPU6050_FIFO_R_W);
 }
 
 /**
  *  \brief Write to FIFO Read Write register
  *  
+ *  \param [in] dev Device handle
  *  \param [in] obj Datatype pointer to return register values
  *  
  *  \details See register datasheet chapter 4.31 for more details.
  */
-void mpu6050_fifoRwWriteReg(tMPU6050_FIFO_R_W *obj)
+void mpu6050_fifoRwWriteReg(tMPU6050_DEV *dev, tMPU6050_FIFO_R_W *obj)
+{
+    mpu6050_busWrite(dev, MPU6050_FIFO_R_W, *obj);
+}
+
+/**
+ *  \brief Set the layout of the FIFO frames
+ *  
+ *  \param [in] dev Device handle
+ *  \param [in] obj Enabled FIFO sources
+ *  \param [in] ui8ExtSize Number of external sensor data bytes per frame
+ *  
+ *  \details mpu6050_fifoEnReadReg() and mpu6050_fifoEnWriteReg() update the
+ *  enabled sources automatically. ui8ExtSize is the sum of I2C_SLVx_LEN of all
+ *  slaves with SLVx_FIFO_EN set (Slave 3: SLV_3_FIFO_EN in I2C_MST_CTRL).
+ */
+void mpu6050_fifoLayoutSet(tMPU6050_DEV *dev, const tMPU6050_FIFO_EN *obj, uint8_t ui8ExtSize)
 {
-    i2c_write(MPU6050_I2C_ADDR, MPU6050_FIFO_R_W, *obj);
-}
\ No newline at end of file
+    dev->FIFO_LAYOUT.EN = *obj;
+    dev->FIFO_LAYOUT.EXT_SIZE = ui8ExtSize;
+    dev->FIFO_LAYOUT.FRAME_SIZE = (obj->ACCEL_FIFO_EN ? 6 : 0)
+                      + (obj->TEMP_FIFO_EN ? 2 : 0)
+                      + (obj->XG_FIFO_EN ? 2 : 0)
+                      + (obj->YG_FIFO_EN ? 2 : 0)
+                      + (obj->ZG_FIFO_EN ? 2 : 0)
+                      + ui8ExtSize;
+}
+
+/**
+ *  \brief Update the enabled sources of the FIFO layout
+ *  
+ *  \param [in] dev Device handle
+ *  \param [in] obj Enabled FIFO sources
+ *  
+ *  \details The number of external sensor data bytes is kept.
+ */
+void mpu6050_fifoLayoutUpdate(tMPU6050_DEV *dev, const tMPU6050_FIFO_EN *obj)
+{
+    mpu6050_fifoLayoutSet(dev, obj, dev->FIFO_LAYOUT.EXT_SIZE);
+}
+
+/**
+ *  \brief Get the layout of the FIFO frames
+ *  
+ *  \param [in] dev Device handle
+ *  \param [in] obj Datatype pointer to return the layout
+ */
+void mpu6050_fifoLayoutGet(tMPU6050_DEV *dev, tMPU6050_FIFO_LAYOUT *obj)
+{
+    *obj = dev->FIFO_LAYOUT;
+}
+
+/**
+ *  \brief Decode one FIFO frame
+ *  
+ *  \param [in] dev Device handle
+ *  \param [in] pui8Frame Raw frame as read from the FIFO
+ *  \param [in] obj Datatype pointer to return the sample
+ *  
+ *  \details Uses the current FIFO layout. Values not contained in the
+ *  frame are set to 0. External sensor data is skipped.
+ */
+void mpu6050_fifoFrameDecode(tMPU6050_DEV *dev, const uint8_t *pui8Frame, tMPU6050_MOTION *obj)
+{
+    const uint8_t *p = pui8Frame;
+
+    obj->ACCEL.X = obj->ACCEL.Y = obj->ACCEL.Z = 0;
+    obj->TEMP = 0;
+    obj->GYRO.X = obj->GYRO.Y = obj->GYRO.Z = 0;
+
+    if(dev->FIFO_LAYOUT.EN.ACCEL_FIFO_EN)
+    {
+        obj->ACCEL.X = (int16_t)(((uint16_t)p[0] << 8) | p[1]);
+        obj->ACCEL.Y = (int16_t)(((uint16_t)p[2] << 8) | p[3]);
+        obj->ACCEL.Z = (int16_t)(((uint16_t)p[4] << 8) | p[5]);
+        p += 6;
+    }
+    if(dev->FIFO_LAYOUT.EN.TEMP_FIFO_EN)
+    {
+        obj->TEMP = (int16_t)(((uint16_t)p[0] << 8) | p[1]);
+        p += 2;
+    }
+    if(dev->FIFO_LAYOUT.EN.XG_FIFO_EN)
+    {
+        obj->GYRO.X = (int16_t)(((uint16_t)p[0] << 8) | p[1]);
+        p += 2;
+    }
+    if(dev->FIFO_LAYOUT.EN.YG_FIFO_EN)
+    {
+        obj->GYRO.Y = (int16_t)(((uint16_t)p[0] << 8) | p[1]);
+        p += 2;
+    }
+    if(dev->FIFO_LAYOUT.EN.ZG_FIFO_EN)
+    {
+        obj->GYRO.Z = (int16_t)(((uint16_t)p[0] << 8) | p[1]);
+    }
+}
+
+/**
+ *  \brief Select the recovery after a FIFO overflow
+ *  
+ *  \param [in] dev Device handle
+ *  \param [in] ui8Recovery MPU6050_FIFO_RECOVER_RESET, MPU6050_FIFO_RECOVER_DISCARD or MPU6050_FIFO_RECOVER_NONE
+ */
+void mpu6050_fifoRecoverySet(tMPU6050_DEV *dev, uint8_t ui8Recovery)
+{
+    dev->FIFO_STATUS.RECOVERY = ui8Recovery;
+}
+
+/**
+ *  \brief Set the host time base for the lost frame estimate
+ *  
+ *  \param [in] dev Device handle
+ *  \param [in] clock Free-running counter, 0 to count one frame per overflow
+ *  \param [in] ui32ClockHz Counts per second
+ */
+void mpu6050_fifoClockSet(tMPU6050_DEV *dev, tMPU6050_CLOCK clock, uint32_t ui32ClockHz)
+{
+    dev->FIFO_STATUS.clock = clock;
+    dev->FIFO_STATUS.CLOCK_HZ = ui32ClockHz;
+    dev->FIFO_STATUS.DRAINED = false;
+}
+
+/**
+ *  \brief Frames the sensor overwrote since the last drain
+ *  
+ *  \param [in] dev Device handle
+ *  \param [in] ui16Count FIFO_COUNT read after the overflow was detected
+ *  \return Estimated number of frames, at least 1
+ */
+static uint32_t mpu6050_fifoOverwritten(tMPU6050_DEV *dev, uint16_t ui16Count)
+{
+    tMPU6050_FIFO_STATUS *status = &dev->FIFO_STATUS;
+    const uint8_t frameSize = dev->FIFO_LAYOUT.FRAME_SIZE;
+    uint64_t elapsedNs;
+    uint32_t periodNs, written;
+
+    if(!status->clock || !status->DRAINED || status->CLOCK_HZ == 0)
+        return 1;
+
+    periodNs = mpu6050_samplePeriodNs(dev);
+    elapsedNs = (uint64_t)(uint32_t)(status->clock() - status->DRAIN_TIME) * 1000000000ULL / status->CLOCK_HZ;
+    written = (uint32_t)((status->LEVEL - status->REMOVED) / frameSize + elapsedNs / periodNs);
+
+    return (written > ui16Count / frameSize) ? written - ui16Count / frameSize : 1;
+}
+
+/**
+ *  \brief Get the overflow statistics of the FIFO
+ *  
+ *  \param [in] dev Device handle
+ *  \param [in] obj Datatype pointer to return the statistics
+ */
+void mpu6050_fifoStatusGet(tMPU6050_DEV *dev, tMPU6050_FIFO_STATUS *obj)
+{
+    *obj = dev->FIFO_STATUS;
+}
+
+/**
+ *  \brief Realign the FIFO reader after an overflow
+ *  
+ *  \param [in] dev Device handle
+ *  \param [in] ui16Count FIFO_COUNT read after the overflow was detected
+ *  \return Number of bytes left in the FIFO, starting at a frame boundary
+ *  
+ *  \details Called by mpu6050_fifoDrain() when FIFO_OFLOW_INT is set. Call
+ *  it directly if the overflow was detected elsewhere, e.g. by an interrupt
+ *  handler that read INT_STATUS. See the file description for the recovery
+ *  methods.
+ */
+uint16_t mpu6050_fifoRecover(tMPU6050_DEV *dev, uint16_t ui16Count)
+{
+    const uint8_t frameSize = dev->FIFO_LAYOUT.FRAME_SIZE;
+    tMPU6050_USER_CTRL ctrl;
+    uint16_t skip;
+
+    dev->FIFO_STATUS.OVERFLOWS++;
+    dev->FIFO_STATUS.LOST_FRAMES += mpu6050_fifoOverwritten(dev, ui16Count);
+
+    switch(dev->FIFO_STATUS.RECOVERY)
+    {
+    case MPU6050_FIFO_RECOVER_RESET:
+        dev->FIFO_STATUS.LOST_FRAMES += ui16Count / frameSize;
+
+        mpu6050_userCtrlReadReg(dev, &ctrl);
+        ctrl.FIFO_EN = false;
+        ctrl.FIFO_RESET = true;
+        mpu6050_userCtrlWriteReg(dev, &ctrl);
+        ctrl.FIFO_EN = true;
+        ctrl.FIFO_RESET = false;
+        mpu6050_userCtrlWriteReg(dev, &ctrl);
+        return 0;
+
+    case MPU6050_FIFO_RECOVER_DISCARD:
+        skip = ui16Count % frameSize;
+        if(skip)
+            mpu6050_busReadBurst(dev, MPU6050_FIFO_R_W, drainBuffer, skip);
+        return ui16Count - skip;
+
+    default:
+        return ui16Count;
+    }
+}
+
+/**
+ *  \brief Read all complete frames from the FIFO
+ *  
+ *  \param [in] dev Device handle
+ *  \param [in] buf Buffer to return the decoded samples
+ *  \param [in] max Number of samples buf can hold
+ *  \return Number of decoded samples
+ *  
+ *  \details INT_STATUS and FIFO_COUNT are read once, INT_STATUS again if
+ *  the FIFO is full so that an overflow between the two reads is not
+ *  missed. The fill level and the number of bytes taken out are kept in
+ *  FIFO_STATUS. After an overflow the
+ *  reader is realigned with mpu6050_fifoRecover(). The complete frames are
+ *  then read with burst reads of FIFO_R_W, each up to
+ *  MPU6050_FIFO_DRAIN_BUFFER bytes, and decoded with the current FIFO layout.
+ *  A partially written frame stays in the FIFO for the next call. The burst
+ *  buffer is shared by all devices, so do not drain two devices concurrently.
+ *  
+ *  Reading INT_STATUS clears all interrupt status bits; do not combine the
+ *  drain with a consumer of the other interrupt sources.
+ */
+uint16_t mpu6050_fifoDrain(tMPU6050_DEV *dev, tMPU6050_MOTION *buf, uint16_t max)
+{
+    tMPU6050_INT_STATUS status;
+    tMPU6050_FIFO_COUNT count;
+    uint16_t level, frames, chunk, i, n = 0;
+    uint32_t time = 0;
+
+    if(dev->FIFO_LAYOUT.FRAME_SIZE == 0)
+        return 0;
+
+    mpu6050_intStatusReadReg(dev, &status);
+    if(dev->FIFO_STATUS.clock)
+        time = dev->FIFO_STATUS.clock();
+    mpu6050_fifoCountReadReg(dev, &count);
+
+    level = count;
+
+    // an overflow between the two reads: the flag is set by now. Frames are
+    // written whole, so a full FIFO that does not hold whole frames overflowed
+    if(!status.FIFO_OFLOW_INT && count >= MPU6050_FIFO_SIZE)
+    {
+        mpu6050_intStatusReadReg(dev, &status);
+        if(MPU6050_FIFO_SIZE % dev->FIFO_LAYOUT.FRAME_SIZE)
+            status.FIFO_OFLOW_INT = true;
+    }
+
+    // the lost frame estimate needs LEVEL and REMOVED of the last drain
+    if(status.FIFO_OFLOW_INT)
+        count = mpu6050_fifoRecover(dev, count);
+    dev->FIFO_STATUS.LEVEL = level;
+
+    frames = count / dev->FIFO_LAYOUT.FRAME_SIZE;
+    if(frames > max)
+        frames = max;
+    dev->FIFO_STATUS.REMOVED = dev->FIFO_STATUS.LEVEL - count + frames * dev->FIFO_LAYOUT.FRAME_SIZE;
+    dev->FIFO_STATUS.DRAIN_TIME = time;
+    dev->FIFO_STATUS.DRAINED = true;
+
+    while(n < frames)
+    {
+        chunk = MPU6050_FIFO_DRAIN_BUFFER / dev->FIFO_LAYOUT.FRAME_SIZE;
+        if(chunk > frames - n)
+            chunk = frames - n;
+
+        mpu6050_busReadBurst(dev, MPU6050_FIFO_R_W, drainBuffer, chunk * dev->FIFO_LAYOUT.FRAME_SIZE);
+
+        for(i = 0; i < chunk; i++)
+            mpu6050_fifoFrameDecode(dev, &drainBuffer[i * dev->FIFO_LAYOUT.FRAME_SIZE], &buf[n + i]);
+
+        n += chunk;
+    }
+
+    return n;
+}
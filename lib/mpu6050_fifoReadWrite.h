@@ -24,12 +24,43 @@
 #ifndef MPU6050_FIFOREADWRITE_H_
 #define MPU6050_FIFOREADWRITE_H_
 
+#include <stdint.h>
+#include <stdbool.h>
+#include "mpu6050_device.h"
+#include "mpu6050_fifoEnable.h"
+#include "mpu6050_motionMeasurements.h"
+
+/** Size of the FIFO buffer inside the sensor */
+#define MPU6050_FIFO_SIZE           1024
+
+/** Size of the buffer used by mpu6050_fifoDrain() for one burst read */
+#ifndef MPU6050_FIFO_DRAIN_BUFFER
+#define MPU6050_FIFO_DRAIN_BUFFER   256
+#endif
+
+/** Overflow recovery: disable, reset and enable the FIFO (default) */
+#define MPU6050_FIFO_RECOVER_RESET      0
+/** Overflow recovery: discard the bytes up to the next frame boundary */
+#define MPU6050_FIFO_RECOVER_DISCARD    1
+/** Overflow recovery: count the overflow only */
+#define MPU6050_FIFO_RECOVER_NONE       2
+
 /**
  *  \brief Datatype for FIFO buffer data
  */
 typedef uint8_t tMPU6050_FIFO_R_W;
 
-extern void mpu6050_fifoRwReadReg(tMPU6050_FIFO_R_W*);
-extern void mpu6050_fifoRwWriteReg(tMPU6050_FIFO_R_W*);
+extern void mpu6050_fifoRwReadReg(tMPU6050_DEV*, tMPU6050_FIFO_R_W*);
+extern void mpu6050_fifoRwWriteReg(tMPU6050_DEV*, tMPU6050_FIFO_R_W*);
+
+extern void mpu6050_fifoLayoutSet(tMPU6050_DEV*, const tMPU6050_FIFO_EN*, uint8_t ui8ExtSize);
+extern void mpu6050_fifoLayoutUpdate(tMPU6050_DEV*, const tMPU6050_FIFO_EN*);
+extern void mpu6050_fifoLayoutGet(tMPU6050_DEV*, tMPU6050_FIFO_LAYOUT*);
+extern void mpu6050_fifoFrameDecode(tMPU6050_DEV*, const uint8_t *pui8Frame, tMPU6050_MOTION*);
+extern void mpu6050_fifoRecoverySet(tMPU6050_DEV*, uint8_t ui8Recovery);
+extern void mpu6050_fifoClockSet(tMPU6050_DEV*, tMPU6050_CLOCK clock, uint32_t ui32ClockHz);
+extern void mpu6050_fifoStatusGet(tMPU6050_DEV*, tMPU6050_FIFO_STATUS*);
+extern uint16_t mpu6050_fifoRecover(tMPU6050_DEV*, uint16_t ui16Count);
+extern uint16_t mpu6050_fifoDrain(tMPU6050_DEV*, tMPU6050_MOTION *buf, uint16_t max);
 
 #endif
\ No newline at end of file
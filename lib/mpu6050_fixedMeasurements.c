@@ -0,0 +1,178 @@
+/*
+ * This file is part of the MPU6050-Library distribution (https://github.com/jmherzog-de/MPU6050-Library).
+ * Copyright (c) 2021 Jean-Marcel Herzog.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ *  \file mpu6050_fixedMeasurements.c
+ *  \brief Fixed-Point Measurements
+ *  
+ *  Integer only conversion of the measurement registers to SI units for
+ *  microcontrollers without floating point unit. The results are Q16.16
+ *  values (see tMPU6050_Q16): acceleration in m/s^2, angular rate in rad/s
+ *  and temperature in degrees C. The raw register value itself is a Q15
+ *  fraction of the full scale range.
+ *  
+ *  Every scale factor is stored as a 16 bit multiplier K and a shift S,
+ *  chosen per full scale range so that K uses the most bits without
+ *  overflowing the 32 bit product raw * K. A conversion is
+ *  
+ *      (raw * K + 2^(S-1)) >> S
+ *  
+ *  one 32 bit multiply, one add and one shift. The range is taken from the
+ *  cached AFS_SEL/FS_SEL of the device handle, no register is read.
+ *  
+ *  Worst case error against the exact value over the whole raw range
+ *  (rounding of K plus rounding of the result, in Q16.16 LSB of 1/65536):
+ *  
+ *  | Measurement      | Range       |   K   | S  | Max error LSB | Max error            |
+ *  |------------------|-------------|-------|----|---------------|----------------------|
+ *  | Accelerometer    | 2g          | 40168 | 10 | 1.8           | 0.000027 m/s^2       |
+ *  | Accelerometer    | 4g          | 40168 | 9  | 3.0           | 0.000046 m/s^2       |
+ *  | Accelerometer    | 8g          | 40168 | 8  | 5.5           | 0.000084 m/s^2       |
+ *  | Accelerometer    | 16g         | 40168 | 7  | 10.4          | 0.00016 m/s^2        |
+ *  | Gyroscope        | 250 deg/s   | 35764 | 12 | 0.6           | 0.000009 rad/s       |
+ *  | Gyroscope        | 500 deg/s   | 35764 | 11 | 0.7           | 0.000011 rad/s       |
+ *  | Gyroscope        | 1000 deg/s  | 35709 | 10 | 15.6          | 0.00024 rad/s        |
+ *  | Gyroscope        | 2000 deg/s  | 35709 | 9  | 30.7          | 0.00047 rad/s        |
+ *  | Temperature      |             | 49345 | 8  | 32.2          | 0.00049 degrees C    |
+ *  
+ *  The errors are far below one LSB of the sensor. The right shift of a
+ *  negative product must be arithmetic, which is the case for the ARM and
+ *  x86 compilers this library is used with.
+ *  
+ *  \copyright Copyright 2021 Jean-Marcel Herzog. All rights reserved. This project is released under the GNU Public License.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "mpu6050_device.h"
+#include "mpu6050_fixedMeasurements.h"
+
+/**
+ *  \brief Multiply-shift scale factor
+ */
+typedef struct
+{
+    int32_t K;          /**< Multiplier, scale * 2^(16 + SHIFT) */
+    uint8_t SHIFT;      /**< Right shift of the product */
+}
+tMPU6050_Q16_SCALE;
+
+/** Multiplier of a scale in units per LSB for a result in Q16.16 */
+#define MPU6050_Q16_SCALE(scale, shift)     { (int32_t)((scale) * (65536.0 * (1L << (shift))) + 0.5), (shift) }
+
+/** Accelerometer scale for AFS_SEL 0 to 3 in (m/s^2)/LSB */
+static const tMPU6050_Q16_SCALE accelScale[4] =
+{
+    MPU6050_Q16_SCALE(MPU6050_STANDARD_GRAVITY / 16384.0, 10),
+    MPU6050_Q16_SCALE(MPU6050_STANDARD_GRAVITY / 8192.0, 9),
+    MPU6050_Q16_SCALE(MPU6050_STANDARD_GRAVITY / 4096.0, 8),
+    MPU6050_Q16_SCALE(MPU6050_STANDARD_GRAVITY / 2048.0, 7)
+};
+
+/** Gyroscope scale for FS_SEL 0 to 3 in (rad/s)/LSB */
+static const tMPU6050_Q16_SCALE gyroScale[4] =
+{
+    MPU6050_Q16_SCALE(MPU6050_DEG_TO_RAD / 131.0, 12),
+    MPU6050_Q16_SCALE(MPU6050_DEG_TO_RAD / 65.5, 11),
+    MPU6050_Q16_SCALE(MPU6050_DEG_TO_RAD / 32.8, 10),
+    MPU6050_Q16_SCALE(MPU6050_DEG_TO_RAD / 16.4, 9)
+};
+
+/** Temperature scale in degrees C/LSB */
+static const tMPU6050_Q16_SCALE tempScale = MPU6050_Q16_SCALE(1.0 / 340.0, 8);
+
+/**
+ *  \brief Scale one raw value
+ */
+static inline tMPU6050_Q16 mpu6050_q16Scale(int16_t i16Raw, const tMPU6050_Q16_SCALE *scale)
+{
+    return (i16Raw * scale->K + (1L << (scale->SHIFT - 1))) >> scale->SHIFT;
+}
+
+/**
+ *  \brief Convert accelerometer measurement to m/s^2
+ *  
+ *  \param [in] dev Device handle
+ *  \param [in] raw Accelerometer measurement
+ *  \param [in] obj Datatype pointer to return the Q16.16 values
+ */
+void mpu6050_accelFixed(const tMPU6050_DEV *dev, const tMPU6050_ACCEL *raw, tMPU6050_ACCEL_Q16 *obj)
+{
+    const tMPU6050_Q16_SCALE *scale = &accelScale[dev->AFS_SEL];
+
+    obj->X = mpu6050_q16Scale(raw->X, scale);
+    obj->Y = mpu6050_q16Scale(raw->Y, scale);
+    obj->Z = mpu6050_q16Scale(raw->Z, scale);
+}
+
+/**
+ *  \brief Convert gyroscope measurement to rad/s
+ *  
+ *  \param [in] dev Device handle
+ *  \param [in] raw Gyroscope measurement
+ *  \param [in] obj Datatype pointer to return the Q16.16 values
+ */
+void mpu6050_gyroFixed(const tMPU6050_DEV *dev, const tMPU6050_GYRO *raw, tMPU6050_GYRO_Q16 *obj)
+{
+    const tMPU6050_Q16_SCALE *scale = &gyroScale[dev->FS_SEL];
+
+    obj->X = mpu6050_q16Scale(raw->X, scale);
+    obj->Y = mpu6050_q16Scale(raw->Y, scale);
+    obj->Z = mpu6050_q16Scale(raw->Z, scale);
+}
+
+/**
+ *  \brief Convert temperature measurement to degrees C
+ *  
+ *  \param [in] raw Temperature measurement
+ *  \return Temperature in degrees C, Q16.16
+ *  
+ *  \details Temperature = raw/340 + 36.53
+ */
+tMPU6050_Q16 mpu6050_tempFixed(tMPU6050_TEMP raw)
+{
+    return mpu6050_q16Scale(raw, &tempScale) + MPU6050_Q16(36.53);
+}
+
+/**
+ *  \brief Convert a complete sample to SI units
+ *  
+ *  \param [in] dev Device handle
+ *  \param [in] raw Accelerometer, temperature and gyroscope measurement
+ *  \param [in] obj Datatype pointer to return the Q16.16 values
+ */
+void mpu6050_motionFixed(const tMPU6050_DEV *dev, const tMPU6050_MOTION *raw, tMPU6050_MOTION_Q16 *obj)
+{
+    mpu6050_accelFixed(dev, &raw->ACCEL, &obj->ACCEL);
+    obj->TEMP = mpu6050_tempFixed(raw->TEMP);
+    mpu6050_gyroFixed(dev, &raw->GYRO, &obj->GYRO);
+}
+
+/**
+ *  \brief Multiply two Q16.16 values
+ *  
+ *  \param [in] a First factor
+ *  \param [in] b Second factor
+ *  \return Rounded product, Q16.16
+ *  
+ *  \details E.g. angular rate times sample period for integration. The
+ *  intermediate product is 64 bit; the result must fit into Q16.16.
+ */
+tMPU6050_Q16 mpu6050_q16Mul(tMPU6050_Q16 a, tMPU6050_Q16 b)
+{
+    return (tMPU6050_Q16)(((int64_t)a * b + 0x8000) >> 16);
+}
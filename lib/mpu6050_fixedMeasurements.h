@@ -0,0 +1,85 @@
+/*
+ * This file is part of the MPU6050-Library distribution (https://github.com/jmherzog-de/MPU6050-Library).
+ * Copyright (c) 2021 Jean-Marcel Herzog.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ *  \file mpu6050_fixedMeasurements.h
+ *  \brief Fixed-Point Measurements headerfile
+ *  \copyright Copyright 2021 Jean-Marcel Herzog. All rights reserved. This project is released under the GNU Public License.
+ */
+
+#ifndef MPU6050_FIXEDMEASUREMENTS_H_
+#define MPU6050_FIXEDMEASUREMENTS_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "mpu6050_transport.h"
+#include "mpu6050_motionMeasurements.h"
+
+/**
+ *  \brief Signed fixed-point value with 16 integer and 16 fraction bits
+ */
+typedef int32_t tMPU6050_Q16;
+
+/** Q16.16 representation of 1.0 */
+#define MPU6050_Q16_ONE             ((tMPU6050_Q16)0x00010000)
+
+/** Q16.16 constant from a floating point constant, evaluated by the compiler */
+#define MPU6050_Q16(x)              ((tMPU6050_Q16)((x) * 65536.0 + ((x) < 0 ? -0.5 : 0.5)))
+
+/** Q16.16 value to float, for host tools and debugging only */
+#define MPU6050_Q16_TO_FLOAT(q)     ((float)(q) * (1.0f / 65536.0f))
+
+/**
+ *  \brief Type for accelerometer measurement of all axis in m/s^2, Q16.16
+ */
+typedef struct
+{
+    tMPU6050_Q16 X;     /**< X axis acceleration in m/s^2 */
+    tMPU6050_Q16 Y;     /**< Y axis acceleration in m/s^2 */
+    tMPU6050_Q16 Z;     /**< Z axis acceleration in m/s^2 */
+}
+tMPU6050_ACCEL_Q16;
+
+/**
+ *  \brief Type for gyroscope measurement of all axis in rad/s, Q16.16
+ */
+typedef struct
+{
+    tMPU6050_Q16 X;     /**< X axis angular rate in rad/s */
+    tMPU6050_Q16 Y;     /**< Y axis angular rate in rad/s */
+    tMPU6050_Q16 Z;     /**< Z axis angular rate in rad/s */
+}
+tMPU6050_GYRO_Q16;
+
+/**
+ *  \brief Type for one complete sample in SI units, Q16.16
+ */
+typedef struct
+{
+    tMPU6050_ACCEL_Q16 ACCEL;   /**< Acceleration in m/s^2 */
+    tMPU6050_Q16 TEMP;          /**< Temperature in degrees C */
+    tMPU6050_GYRO_Q16 GYRO;     /**< Angular rate in rad/s */
+}
+tMPU6050_MOTION_Q16;
+
+extern void mpu6050_accelFixed(const tMPU6050_DEV*, const tMPU6050_ACCEL*, tMPU6050_ACCEL_Q16*);
+extern void mpu6050_gyroFixed(const tMPU6050_DEV*, const tMPU6050_GYRO*, tMPU6050_GYRO_Q16*);
+extern tMPU6050_Q16 mpu6050_tempFixed(tMPU6050_TEMP);
+extern void mpu6050_motionFixed(const tMPU6050_DEV*, const tMPU6050_MOTION*, tMPU6050_MOTION_Q16*);
+extern tMPU6050_Q16 mpu6050_q16Mul(tMPU6050_Q16, tMPU6050_Q16);
+
+#endif
@@ -54,35 +54,32 @@
 
 #include <stdint.h>
 #include <stdbool.h>
-#include "i2c.h"
-#include "mpu6050_reg.h"
+#include "mpu6050_transport.h"
+#include "mpu6050_registerCodec.h"
 #include "mpu6050_gyroscopeConfiguration.h"
 
 /**
  *  \brief Read Gyroscope Configuration register
  *  
+ *  \param [in] dev Device handle
  *  \param [in] obj Datatype pointer to return register values
  *  
  *  \details See register datasheet chapter 4.4 for more details.
  */
-void mpu6050_gyroConfigReadReg(tMPU6050_GYRO_CONFIG *obj)
+void mpu6050_gyroConfigReadReg(tMPU6050_DEV *dev, tMPU6050_GYRO_CONFIG *obj)
 {
-    uint8_t reg = i2c_receive(MPU6050_I2C_ADDR, MPU6050_GYRO_CONFIG);
-    obj->XG_ST = reg >> 7;
-    obj->YG_ST = (reg >> 6) & 0x01;
-    obj->ZG_ST = (reg >> 5) & 0x01;
-    obj->FS_SEL = (reg >> 3) & 0x03;
+    mpu6050_regRead(dev, MPU6050_CODEC_GYRO_CONFIG, obj);
 }
 
 /**
  *  \brief Write to Gyroscope Configuration register
  *  
+ *  \param [in] dev Device handle
  *  \param [in] obj Datatype pointer to return register values
  *  
  *  \details See register datasheet chapter 4.4 for more details.
  */
-void mpu6050_gyroConfigWriteReg(tMPU6050_GYRO_CONFIG *obj)
+void mpu6050_gyroConfigWriteReg(tMPU6050_DEV *dev, tMPU6050_GYRO_CONFIG *obj)
 {
-    uint8_t reg = (uint8_t)(obj->XG_ST) << 7 | (uint8_t)(obj->YG_ST) << 6 | (uint8_t)(obj->ZG_ST) << 5 | (uint8_t)(obj->FS_SEL) << 3;
-    i2c_write(MPU6050_I2C_ADDR, MPU6050_GYRO_CONFIG, reg);
+    mpu6050_regWrite(dev, MPU6050_CODEC_GYRO_CONFIG, obj);
 }
\ No newline at end of file
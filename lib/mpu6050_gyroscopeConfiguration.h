@@ -26,8 +26,7 @@
 
 #include <stdint.h>
 #include <stdbool.h>
-#include "i2c.h"
-#include "mpu6050_reg.h"
+#include "mpu6050_transport.h"
 
 #define MPU6050_GYRO_RANGE_250_DEG_PER_S  0x00
 #define MPU6050_GYRO_RANGE_500_DEG_PER_S  0x01
@@ -37,16 +36,22 @@
 /**
  *  \brief Datatype for Gyroscope Configuration data
  */
-typedef struct
+typedef union
 {
-    bool XG_ST;                 /**< Setting this bit causes the X axis gyroscope to perform self test. */
-    bool YG_ST;                 /**< Setting this bit causes the Y axis gyroscope to perform self test. */
-    bool ZG_ST;                 /**< Setting this bit causes the Z axis gyroscope to perform self test. */
-    unsigned char FS_SEL : 2;   /**< Selects the full scale range of the gyroscope outputs. */
+    uint8_t RAW;                /**< Register value */
+
+    struct
+    {
+        unsigned char : 3;
+        unsigned char FS_SEL : 2;   /**< Selects the full scale range of the gyroscope outputs. */
+        bool ZG_ST : 1;                 /**< Setting this bit causes the Z axis gyroscope to perform self test. */
+        bool YG_ST : 1;                 /**< Setting this bit causes the Y axis gyroscope to perform self test. */
+        bool XG_ST : 1;                 /**< Setting this bit causes the X axis gyroscope to perform self test. */
+    };
 }
 tMPU6050_GYRO_CONFIG;
 
-extern void mpu6050_gyroConfigReadReg(tMPU6050_GYRO_CONFIG*);
-extern void mpu6050_gyroConfigWriteReg(tMPU6050_GYRO_CONFIG*);
+extern void mpu6050_gyroConfigReadReg(tMPU6050_DEV*, tMPU6050_GYRO_CONFIG*);
+extern void mpu6050_gyroConfigWriteReg(tMPU6050_DEV*, tMPU6050_GYRO_CONFIG*);
 
 #endif
\ No newline at end of file
@@ -56,55 +56,63 @@
 /**
  *  \brief Read Gyroscope X axis measurement
  *  
+ *  \param [in] dev Device handle
  *  \param [in] obj Datatype pointer to return register values
  *  
  *  \details See register datasheet chapter 4.19 for more details.
  */
-void mpu6050_gyroXoutReadReg(tMPU6050_GYRO_XOUT *obj)
+void mpu6050_gyroXoutReadReg(tMPU6050_DEV *dev, tMPU6050_GYRO_XOUT *obj)
 {
-    uint16_t high = (uint8_t)I2C_receive(MPU6050_I2C_ADDR, MPU6050_GYRO_XOUT_H);
-    uint16_t low = (uint8_t)I2C_receive(MPU6050_I2C_ADDR, MPU6050_GYRO_XOUT_L);
-    *obj = (high << 8) | low;
+    uint16_t high = (uint8_t)mpu6050_busRead(dev, MPU6050_GYRO_XOUT_H);
+    uint16_t low = (uint8_t)mpu6050_busRead(dev, MPU6050_GYRO_XOUT_L);
+    *obj = (int16_t)((high << 8) | low);
 }
 
 /**
  *  \brief Read Gyroscope Y axis measurement
  *  
+ *  \param [in] dev Device handle
  *  \param [in] obj Datatype pointer to return register values
  *  
  *  \details See register datasheet chapter 4.19 for more details.
  */
-void mpu6050_gyroYoutReadReg(tMPU6050_GYRO_YOUT *obj)
+void mpu6050_gyroYoutReadReg(tMPU6050_DEV *dev, tMPU6050_GYRO_YOUT *obj)
 {
-    uint16_t high = (uint8_t)I2C_receive(MPU6050_I2C_ADDR, MPU6050_GYRO_YOUT_H);
-    uint16_t low = (uint8_t)I2C_receive(MPU6050_I2C_ADDR, MPU6050_GYRO_YOUT_L);
-    *obj = (high << 8) | low;
+    uint16_t high = (uint8_t)mpu6050_busRead(dev, MPU6050_GYRO_YOUT_H);
+    uint16_t low = (uint8_t)mpu6050_busRead(dev, MPU6050_GYRO_YOUT_L);
+    *obj = (int16_t)((high << 8) | low);
 }
 
 /**
  *  \brief Read Gyroscope Z axis measurement
  *  
+ *  \param [in] dev Device handle
  *  \param [in] obj Datatype pointer to return register values
  *  
  *  \details See register datasheet chapter 4.19 for more details.
  */
-void mpu6050_gyroZoutReadReg(tMPU6050_GYRO_ZOUT *obj)
+void mpu6050_gyroZoutReadReg(tMPU6050_DEV *dev, tMPU6050_GYRO_ZOUT *obj)
 {
-    uint16_t high = (uint8_t)I2C_receive(MPU6050_I2C_ADDR, MPU6050_GYRO_ZOUT_H);
-    uint16_t low = (uint8_t)I2C_receive(MPU6050_I2C_ADDR, MPU6050_GYRO_ZOUT_L);
-    *obj = (high << 8) | low;
+    uint16_t high = (uint8_t)mpu6050_busRead(dev, MPU6050_GYRO_ZOUT_H);
+    uint16_t low = (uint8_t)mpu6050_busRead(dev, MPU6050_GYRO_ZOUT_L);
+    *obj = (int16_t)((high << 8) | low);
 }
 
 /**
  *  \brief Read Gyroscope all axis measurement
  *  
+ *  \param [in] dev Device handle
  *  \param [in] obj Datatype pointer to return register values
  *  
- *  \details Read all axis of the Gyroscope at once.
+ *  \details Read all axis of the Gyroscope at once with one burst read.
  */
-void mpu6050_gyroReadReg(tMPU6050_GYRO *obj)
+void mpu6050_gyroReadReg(tMPU6050_DEV *dev, tMPU6050_GYRO *obj)
 {
-    mpu6050_gyroXoutReadReg(&(obj->X));
-    mpu6050_gyroYoutReadReg(&(obj->Y));
-    mpu6050_gyroZoutReadReg(&(obj->Z));
+    uint8_t buf[6];
+
+    mpu6050_busReadBurst(dev, MPU6050_GYRO_XOUT_H, buf, 6);
+
+    obj->X = (int16_t)(((uint16_t)buf[0] << 8) | buf[1]);
+    obj->Y = (int16_t)(((uint16_t)buf[2] << 8) | buf[3]);
+    obj->Z = (int16_t)(((uint16_t)buf[4] << 8) | buf[5]);
 }
\ No newline at end of file
@@ -26,17 +26,16 @@
 
 #include <stdint.h>
 #include <stdbool.h>
-#include "i2c.h"
-#include "mpu6050_reg.h"
+#include "mpu6050_transport.h"
 
 #define MPU6050_GYRO_SCALE_RANGE_250    0x00
 #define MPU6050_GYRO_SCALE_RANGE_500    0x01
 #define MPU6050_GYRO_SCALE_RANGE_1000   0x02
 #define MPU6050_GYRO_SCALE_RANGE_2000   0x03
 
-typedef uint16_t tMPU6050_GYRO_XOUT;	/**< Stores the most recent X axis gyroscope measurement. */
-typedef uint16_t tMPU6050_GYRO_YOUT;	/**< Stores the most recent Y axis gyroscope measurement. */
-typedef uint16_t tMPU6050_GYRO_ZOUT;	/**< Stores the most recent Z axis gyroscope measurement. */
+typedef int16_t tMPU6050_GYRO_XOUT;	/**< Stores the most recent X axis gyroscope measurement. */
+typedef int16_t tMPU6050_GYRO_YOUT;	/**< Stores the most recent Y axis gyroscope measurement. */
+typedef int16_t tMPU6050_GYRO_ZOUT;	/**< Stores the most recent Z axis gyroscope measurement. */
 
 /**
  *  \brief Datatype for gyroscope values
@@ -49,9 +48,9 @@ typedef struct
 }
 tMPU6050_GYRO;
 
-extern void mpu6050_gyroXoutReadReg(tMPU6050_GYRO_XOUT*);
-extern void mpu6050_gyroYoutReadReg(tMPU6050_GYRO_YOUT*);
-extern void mpu6050_gyroZoutReadReg(tMPU6050_GYRO_ZOUT*);
-extern void mpu6050_gyroReadReg(tMPU6050_GYRO*);
+extern void mpu6050_gyroXoutReadReg(tMPU6050_DEV*, tMPU6050_GYRO_XOUT*);
+extern void mpu6050_gyroYoutReadReg(tMPU6050_DEV*, tMPU6050_GYRO_YOUT*);
+extern void mpu6050_gyroZoutReadReg(tMPU6050_DEV*, tMPU6050_GYRO_ZOUT*);
+extern void mpu6050_gyroReadReg(tMPU6050_DEV*, tMPU6050_GYRO*);
 
 #endif
\ No newline at end of file
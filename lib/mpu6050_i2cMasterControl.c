@@ -30,23 +30,32 @@
  
 #include <stdint.h>
 #include <stdbool.h>
-#include "i2c.h"
-#include "mpu6050_reg.h"
+#include "mpu6050_transport.h"
+#include "mpu6050_registerCodec.h"
 #include "mpu6050_i2cMasterControl.h"
 
 /**
  *  \brief Read I2C Master Control register
  *  
+ *  \param [in] dev Device handle
  *  \param [in] obj Datatype pointer to return register values
  *  
  *  \details See register datasheet chapter 4.7 for more details.
  */
-void mpu6050_i2cMstCtrlReadReg(tMPU6050_I2C_MST_CTRL *obj)
+void mpu6050_i2cMstCtrlReadReg(tMPU6050_DEV *dev, tMPU6050_I2C_MST_CTRL *obj)
 {
-    uint8_t reg = i2c_receive(MPU6050_I2C_ADDR, MPU6050_I2C_MST_CTRL);
-    obj->MULTI_MST_EN = reg >> 7;
-    obj->WAIT_FOR_ES = (reg >> 6) & 0x01;
-    obj->SLV_3_FIFO_EN = (reg >> 5) & 0x01;
-    obj->I2C_MST_P_NSR = (reg >> 4) & 0x01;
-    obj->I2C_MST_CLK = reg & 0x0F;
+    mpu6050_regRead(dev, MPU6050_CODEC_I2C_MST_CTRL, obj);
+}
+
+/**
+ *  \brief Write I2C Master Control register
+ *  
+ *  \param [in] dev Device handle
+ *  \param [in] obj Datatype pointer with register values
+ *  
+ *  \details See register datasheet chapter 4.7 for more details.
+ */
+void mpu6050_i2cMstCtrlWriteReg(tMPU6050_DEV *dev, tMPU6050_I2C_MST_CTRL *obj)
+{
+    mpu6050_regWrite(dev, MPU6050_CODEC_I2C_MST_CTRL, obj);
 }
\ No newline at end of file
@@ -44,30 +44,35 @@
 /**
  *  \brief Datatype for I2C Master Control register
  */
-typedef struct
+typedef union
 {
-    bool MULTI_MST_EN;              /**< When set to 1, this bit enables multi-master capability. */
+    uint8_t RAW;                /**< Register value */
 
-    /** When set to 1, this bit delays the Data Ready
-     * interrupt until External Sensor data from the
-     * Slave device have been loaded into the EXT_SENS_DATA
-     * registers. */
-    bool WAIT_FOR_ES;
+    struct
+    {
+        unsigned char I2C_MST_CLK : 4;	/**< Configures the I2C master clock speed divider. */
 
-    /** When set to 1, this bit enables EXT_SENS_DATA registers associated with Slave 3 to be written into the FIFO.
-     * The corresponding bits for Slaves 0-2 can be found in Register 35.*/
-    bool SLV_3_FIFO_EN;
+        /** Controls the I2C Master transition from one slave read to the next slave read.
+         * When this bit equals 0, there is a restart between reads.
+         * When this bit equals 1, there is a stop and start marking the beginning of the next read.
+         * Note: When a write follows a read, a stop and start is always enforced. */
+        bool I2C_MST_P_NSR : 1;
 
-    /** Controls the I2C Master transition from one slave read to the next slave read.
-     * When this bit equals 0, there is a restart between reads.
-     * When this bit equals 1, there is a stop and start marking the beginning of the next read.
-     * Note: When a write follows a read, a stop and start is always enforced. */
-    bool I2C_MST_P_NSR;
+        /** When set to 1, this bit enables EXT_SENS_DATA registers associated with Slave 3 to be written into the FIFO.
+         * The corresponding bits for Slaves 0-2 can be found in Register 35.*/
+        bool SLV_3_FIFO_EN : 1;
 
-    unsigned char I2C_MST_CLK : 4;	/**< Configures the I2C master clock speed divider. */
+        /** When set to 1, this bit delays the Data Ready
+         * interrupt until External Sensor data from the
+         * Slave device have been loaded into the EXT_SENS_DATA
+         * registers. */
+        bool WAIT_FOR_ES : 1;
+        bool MULTI_MST_EN : 1;              /**< When set to 1, this bit enables multi-master capability. */
+    };
 }
 tMPU6050_I2C_MST_CTRL;
 
-extern void mpu6050_i2cMstCtrlReadReg(tMPU6050_I2C_MST_CTRL*);
+extern void mpu6050_i2cMstCtrlReadReg(tMPU6050_DEV*, tMPU6050_I2C_MST_CTRL*);
+extern void mpu6050_i2cMstCtrlWriteReg(tMPU6050_DEV*, tMPU6050_I2C_MST_CTRL*);
 
 #endif
\ No newline at end of file
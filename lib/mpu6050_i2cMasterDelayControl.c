@@ -42,40 +42,31 @@
  *  \copyright Copyright 2021 Jean-Marcel Herzog. All rights reserved. This project is released under the GNU Public License.
  */
 
+#include "mpu6050_registerCodec.h"
 #include "mpu6050_i2cMasterDelayControl.h"
 
 /**
  *  \brief Read I2C Master Delay Control register
  *  
+ *  \param [in] dev Device handle
  *  \param [in] obj Datatype pointer to return register values
  *  
  *  \details See register datasheet chapter 4.1 for more details.
  */
-void mpu6050_i2cMstDelayCtrlReadReg(tMPU6050_I2C_MST_DELAY_CTRL *obj)
+void mpu6050_i2cMstDelayCtrlReadReg(tMPU6050_DEV *dev, tMPU6050_I2C_MST_DELAY_CTRL *obj)
 {
-    uint8_t reg = I2C_receive(MPU6050_I2C_ADDR, MPU6050_I2C_MST_DELAY_CT_RL);
-    obj->DELAY_ES_SHADOW  = reg >> 7;
-    obj->I2C_SLV4_DLY_EN = (reg >> 4) & 0x01;
-    obj->I2C_SLV3_DLY_EN = (reg >> 3) & 0x01;
-    obj->I2C_SLV2_DLY_EN = (reg >> 2) & 0x01;
-    obj->I2C_SLV1_DLY_EN = (reg >> 1) & 0x01;
-    obj->I2C_SLV0_DLY_EN = reg  & 0x01;
+    mpu6050_regRead(dev, MPU6050_CODEC_I2C_MST_DELAY_CTRL, obj);
 }
 
 /**
  *  \brief Write to I2C Master Delay Control register
  *  
+ *  \param [in] dev Device handle
  *  \param [in] obj Datatype pointer to return register values
  *  
  *  \details See register datasheet chapter 4.1 for more details.
  */
-void mpu6050_i2cMstDelayCtrlWriteReg(tMPU6050_I2C_MST_DELAY_CTRL *obj)
+void mpu6050_i2cMstDelayCtrlWriteReg(tMPU6050_DEV *dev, tMPU6050_I2C_MST_DELAY_CTRL *obj)
 {
-    uint8_t reg = obj->DELAY_ES_SHADOW << 7;
-    reg |= obj->I2C_SLV4_DLY_EN << 4;
-    reg |= obj->I2C_SLV3_DLY_EN << 3;
-    reg |= obj->I2C_SLV2_DLY_EN << 2;
-    reg |= obj->I2C_SLV1_DLY_EN << 1;
-    reg |= obj->I2C_SLV0_DLY_EN;
-    i2c_write(MPU6050_I2C_ADDR, MPU6050_I2C_MST_DELAY_CT_RL, reg);
+    mpu6050_regWrite(dev, MPU6050_CODEC_I2C_MST_DELAY_CTRL, obj);
 }
\ No newline at end of file
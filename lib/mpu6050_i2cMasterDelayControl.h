@@ -26,36 +26,41 @@
 
 #include <stdint.h>
 #include <stdbool.h>
-#include "i2c.h"
-#include "mpu6050_reg.h"
+#include "mpu6050_transport.h"
 
 /**
  *  \brief Datatype for I2C Master Delay Control register
  */
-typedef struct
+typedef union
 {
-    /** When set, delays shadowing of external sensor data until
-     * all data has been received. */
-    bool DELAY_ES_SHADOW;
+    uint8_t RAW;                /**< Register value */
 
-    /** When enabled, slave 4 will only be accessed at a decreased rate. */
-    bool I2C_SLV4_DLY_EN;
+    struct
+    {
+        /** When enabled, slave 0 will only be accessed at a decreased rate. */
+        bool I2C_SLV0_DLY_EN : 1;
 
-    /** When enabled, slave 3 will only be accessed at a decreased rate. */
-    bool I2C_SLV3_DLY_EN;
+        /** When enabled, slave 1 will only be accessed at a decreased rate. */
+        bool I2C_SLV1_DLY_EN : 1;
 
-    /** When enabled, slave 2 will only be accessed at a decreased rate. */
-    bool I2C_SLV2_DLY_EN;
+        /** When enabled, slave 2 will only be accessed at a decreased rate. */
+        bool I2C_SLV2_DLY_EN : 1;
 
-    /** When enabled, slave 1 will only be accessed at a decreased rate. */
-    bool I2C_SLV1_DLY_EN;
+        /** When enabled, slave 3 will only be accessed at a decreased rate. */
+        bool I2C_SLV3_DLY_EN : 1;
 
-    /** When enabled, slave 0 will only be accessed at a decreased rate. */
-    bool I2C_SLV0_DLY_EN;
+        /** When enabled, slave 4 will only be accessed at a decreased rate. */
+        bool I2C_SLV4_DLY_EN : 1;
+        unsigned char : 2;
+
+        /** When set, delays shadowing of external sensor data until
+         * all data has been received. */
+        bool DELAY_ES_SHADOW : 1;
+    };
 }
 tMPU6050_I2C_MST_DELAY_CTRL;
 
-extern void mpu6050_i2cMstDelayCtrlReadReg(tMPU6050_I2C_MST_DELAY_CTRL*);
-extern void mpu6050_i2cMstDelayCtrlWriteReg(tMPU6050_I2C_MST_DELAY_CTRL*);
+extern void mpu6050_i2cMstDelayCtrlReadReg(tMPU6050_DEV*, tMPU6050_I2C_MST_DELAY_CTRL*);
+extern void mpu6050_i2cMstDelayCtrlWriteReg(tMPU6050_DEV*, tMPU6050_I2C_MST_DELAY_CTRL*);
 
 #endif
\ No newline at end of file
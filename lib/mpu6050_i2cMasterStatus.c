@@ -28,45 +28,31 @@
  *  \copyright Copyright 2021 Jean-Marcel Herzog. All rights reserved. This project is released under the GNU Public License.
  */
  
+#include "mpu6050_registerCodec.h"
 #include "mpu6050_i2cMasterStatus.h"
 
 /**
  *  \brief Read I2c Master Status register
  *  
+ *  \param [in] dev Device handle
  *  \param [in] obj Datatype pointer to return register values
  *  
  *  \details See register datasheet chapter 4.13 for more details.
  */
-void mpu6050_i2cMstStatusReadReg(tMPU6050_I2C_MST_STATUS *obj)
+void mpu6050_i2cMstStatusReadReg(tMPU6050_DEV *dev, tMPU6050_I2C_MST_STATUS *obj)
 {
-    uint8_t reg = i2c_receive(MPU6050_I2C_ADDR, MPU6050_I2C_MST_STATUS);
-    obj->PASS_THROUGH = reg >> 7;
-    obj->I2C_SLV4_DONE = (reg >> 6) & 0x01;
-    obj->I2C_LOST_ARB = (reg >> 5) & 0x01;
-    obj->I2C_SLV4_NACK = (reg >> 4) & 0x01;
-    obj->I2C_SLV3_NACK = (reg >> 3) & 0x01;
-    obj->I2C_SLV2_NACK = (reg >> 2) & 0x01;
-    obj->I2C_SLV1_NACK = (reg >> 1) & 0x01;
-    obj->I2C_SLV0_NACK = reg & 0x01;
+    mpu6050_regRead(dev, MPU6050_CODEC_I2C_MST_STATUS, obj);
 }
 
 /**
  *  \brief Write to I2c Master Status register
  *  
+ *  \param [in] dev Device handle
  *  \param [in] obj Datatype pointer to return register values
  *  
  *  \details See register datasheet chapter 4.13 for more details.
  */
-void mpu6050_i2cMstStatusWriteReg(tMPU6050_I2C_MST_STATUS *obj)
+void mpu6050_i2cMstStatusWriteReg(tMPU6050_DEV *dev, tMPU6050_I2C_MST_STATUS *obj)
 {
-    uint8_t reg = (uint8_t)(obj->PASS_THROUGH) << 7;
-    reg |= (uint8_t)(obj->I2C_SLV4_DONE) << 6;
-    reg |= (uint8_t)(obj->I2C_LOST_ARB) << 5;
-    reg |= (uint8_t)(obj->I2C_SLV4_NACK) << 4;
-    reg |= (uint8_t)(obj->I2C_SLV3_NACK) << 3;
-    reg |= (uint8_t)(obj->I2C_SLV2_NACK) << 2;
-    reg |= (uint8_t)(obj->I2C_SLV1_NACK) << 1;
-    reg |= (uint8_t)(obj->I2C_SLV0_NACK);
-
-    i2c_write(MPU6050_I2C_ADDR, MPU6050_I2C_MST_STATUS, reg);
+    mpu6050_regWrite(dev, MPU6050_CODEC_I2C_MST_STATUS, obj);
 }
\ No newline at end of file
@@ -26,58 +26,62 @@
 
 #include <stdint.h>
 #include <stdbool.h>
-#include "i2c.h"
-#include "mpu6050_reg.h"
+#include "mpu6050_transport.h"
 
 /**
  *  \brief Datatype for I2C Master Status register
  */
-typedef struct
+typedef union
 {
-    /** This bit reflects the status of the FSYNC interrupt from an external device
-     * into the MPU6050. This is used as a way to pass an external interrupt through
-     * the MPU6050 to the host application processor. When set to 1, this bit will
-     * cause an interrupt if FSYNC_INT_EN is asserted in INT_PIN_CFG (Register 55). */
-    bool PASS_THROUGH;
+    uint8_t RAW;                /**< Register value */
 
-    /** Automatically sets to 1 when a Slave 4 transaction has completed. This triggers an
-     * interrupt if the I2C_MST_INT_EN bit in the INT_ENABLE register (Register 56) is
-     * asserted and if the SLV4_DONE_INT bit is asserted in the I2C_SLV4_CTRL register (52). */
-    bool I2C_SLV4_DONE;
+    struct
+    {
+        /** This bit automatically sets to 1 when the I2C Master receives a NACK in a
+         * transaction with Slave 0. This triggers an interrupt if the I2C_MST_INT_EN bit
+         * in the INT_ENABLE register (Register 56) is asserted. */
+        bool I2C_SLV0_NACK : 1;
 
-    /** This bit automatically sets to 1 when the I2C Master has lost arbitration of the
-     * auxiliary I2C bus (an error condition). This triggers an interrupt if the
-     * I2C_MST_INT_EN bit in the INT_ENABLE register (Register 56) is asserted. */
-    bool I2C_LOST_ARB;
+        /** This bit automatically sets to 1 when the I2C Master receives a NACK in a
+         * transaction with Slave 1. This triggers an interrupt if the I2C_MST_INT_EN bit
+         * in the INT_ENABLE register (Register 56) is asserted. */
+        bool I2C_SLV1_NACK : 1;
 
-    /** This bit automatically sets to 1 when the I2C Master receives a NACK in a
-     * transaction with Slave 4. This triggers an interrupt if the I2C_MST_INT_EN bit
-     * in the INT_ENABLE register (Register 56) is asserted. */
-    bool I2C_SLV4_NACK;
+        /** This bit automatically sets to 1 when the I2C Master receives a NACK in a
+         * transaction with Slave 2. This triggers an interrupt if the I2C_MST_INT_EN bit
+         * in the INT_ENABLE register (Register 56) is asserted. */
+        bool I2C_SLV2_NACK : 1;
 
-    /** This bit automatically sets to 1 when the I2C Master receives a NACK in a
-     * transaction with Slave 3. This triggers an interrupt if the I2C_MST_INT_EN bit
-     * in the INT_ENABLE register (Register 56) is asserted. */
-    bool I2C_SLV3_NACK;
+        /** This bit automatically sets to 1 when the I2C Master receives a NACK in a
+         * transaction with Slave 3. This triggers an interrupt if the I2C_MST_INT_EN bit
+         * in the INT_ENABLE register (Register 56) is asserted. */
+        bool I2C_SLV3_NACK : 1;
 
-    /** This bit automatically sets to 1 when the I2C Master receives a NACK in a
-     * transaction with Slave 2. This triggers an interrupt if the I2C_MST_INT_EN bit
-     * in the INT_ENABLE register (Register 56) is asserted. */
-    bool I2C_SLV2_NACK;
+        /** This bit automatically sets to 1 when the I2C Master receives a NACK in a
+         * transaction with Slave 4. This triggers an interrupt if the I2C_MST_INT_EN bit
+         * in the INT_ENABLE register (Register 56) is asserted. */
+        bool I2C_SLV4_NACK : 1;
 
-    /** This bit automatically sets to 1 when the I2C Master receives a NACK in a
-     * transaction with Slave 1. This triggers an interrupt if the I2C_MST_INT_EN bit
-     * in the INT_ENABLE register (Register 56) is asserted. */
-    bool I2C_SLV1_NACK;
+        /** This bit automatically sets to 1 when the I2C Master has lost arbitration of the
+         * auxiliary I2C bus (an error condition). This triggers an interrupt if the
+         * I2C_MST_INT_EN bit in the INT_ENABLE register (Register 56) is asserted. */
+        bool I2C_LOST_ARB : 1;
 
-    /** This bit automatically sets to 1 when the I2C Master receives a NACK in a
-     * transaction with Slave 0. This triggers an interrupt if the I2C_MST_INT_EN bit
-     * in the INT_ENABLE register (Register 56) is asserted. */
-    bool I2C_SLV0_NACK;
+        /** Automatically sets to 1 when a Slave 4 transaction has completed. This triggers an
+         * interrupt if the I2C_MST_INT_EN bit in the INT_ENABLE register (Register 56) is
+         * asserted and if the SLV4_DONE_INT bit is asserted in the I2C_SLV4_CTRL register (52). */
+        bool I2C_SLV4_DONE : 1;
+
+        /** This bit reflects the status of the FSYNC interrupt from an external device
+         * into the MPU6050. This is used as a way to pass an external interrupt through
+         * the MPU6050 to the host application processor. When set to 1, this bit will
+         * cause an interrupt if FSYNC_INT_EN is asserted in INT_PIN_CFG (Register 55). */
+        bool PASS_THROUGH : 1;
+    };
 }
 tMPU6050_I2C_MST_STATUS;
 
-extern void mpu6050_i2cMstStatusReadReg(tMPU6050_I2C_MST_STATUS*);
-extern void mpu6050_i2cMstStatusWriteReg(tMPU6050_I2C_MST_STATUS*);
+extern void mpu6050_i2cMstStatusReadReg(tMPU6050_DEV*, tMPU6050_I2C_MST_STATUS*);
+extern void mpu6050_i2cMstStatusWriteReg(tMPU6050_DEV*, tMPU6050_I2C_MST_STATUS*);
 
 #endif
\ No newline at end of file
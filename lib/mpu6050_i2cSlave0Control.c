@@ -86,121 +86,125 @@
  
 #include <stdint.h>
 #include <stdbool.h>
-#include "i2c.h"
-#include "mpu6050_reg.h"
+#include "mpu6050_transport.h"
+#include "mpu6050_batchWrite.h"
+#include "mpu6050_registerCodec.h"
 #include "mpu6050_i2cSlave0Control.h"
 
 /**
  *  \brief Read I2C Slave 0 ADDR register
  *  
+ *  \param [in] dev Device handle
  *  \param [in] obj Datatype pointer to return register values
  *  
  *  \details See register datasheet chapter 4.8 for more details.
  */
-void mpu6050_i2cSlv0AddrReadReg(tMPU6050_I2C_SLV0_ADDR *obj)
+void mpu6050_i2cSlv0AddrReadReg(tMPU6050_DEV *dev, tMPU6050_I2C_SLV0_ADDR *obj)
 {
-    uint8_t reg = i2c_receive(MPU6050_I2C_ADDR, MPU6050_I2C_SLV0_ADDR);
-    obj->I2C_SLV0_RW = reg >> 7;
-    obj->I2C_SLV0_ADDR = reg & 0x7F;
+    mpu6050_regRead(dev, MPU6050_CODEC_I2C_SLV0_ADDR, obj);
 }
 
 /**
  *  \brief Write to I2C Slave 0 ADDR register
  *  
+ *  \param [in] dev Device handle
  *  \param [in] obj Datatype pointer to return register values
  *  
  *  \details See register datasheet chapter 4.8 for more details.
  */
-void mpu6050_i2cSlv0AddrWriteReg(tMPU6050_I2C_SLV0_ADDR *obj)
+void mpu6050_i2cSlv0AddrWriteReg(tMPU6050_DEV *dev, tMPU6050_I2C_SLV0_ADDR *obj)
 {
-    uint8_t reg = (uint8_t)obj->I2C_SLV0_RW << 7 | (uint8_t)obj->I2C_SLV0_ADDR;
-    i2c_write(MPU6050_I2C_ADDR, MPU6050_I2C_SLV0_ADDR, reg);
+    mpu6050_regWrite(dev, MPU6050_CODEC_I2C_SLV0_ADDR, obj);
 }
 
 /**
  *  \brief Read I2C Slave 0 REG register
  *  
+ *  \param [in] dev Device handle
  *  \param [in] obj Datatype pointer to return register values
  *  
  *  \details See register datasheet chapter 4.8 for more details.
  */
-void mpu6050_i2c_slv0_reg_readReg(tMPU6050_I2C_SLV0_REG *obj, void (*callback)())
+void mpu6050_i2cSlv0RegReadReg(tMPU6050_DEV *dev, tMPU6050_I2C_SLV0_REG *obj)
 {
-    *obj = I2C_receive(MPU6050_I2C_ADDR, MPU6050_I2C_SLV0_REG);
-
-    callback();
+    *obj = mpu6050_busRead(dev, MPU6050_I2C_SLV0_REG);
 }
 
 /**
  *  \brief Write to I2C Slave 0 REG register
  *  
+ *  \param [in] dev Device handle
  *  \param [in] obj Datatype pointer to return register values
  *  
  *  \details See register datasheet chapter 4.8 for more details.
  */
-void mpu6050_i2cSlv0RegWriteReg(tMPU6050_I2C_SLV0_REG *obj)
+void mpu6050_i2cSlv0RegWriteReg(tMPU6050_DEV *dev, tMPU6050_I2C_SLV0_REG *obj)
 {
-    i2c_write(MPU6050_I2C_ADDR, MPU6050_I2C_SLV0_REG, *obj);
+    mpu6050_busWrite(dev, MPU6050_I2C_SLV0_REG, *obj);
 }
 
 /**
  *  \brief Read I2C Slave 0 CTRL register
  *  
+ *  \param [in] dev Device handle
  *  \param [in] obj Datatype pointer to return register values
  *  
  *  \details See register datasheet chapter 4.8 for more details.
  */
-void mpu6050_i2cSlv0CtrlReadReg(tMPU6050_I2C_SLV0_CTRL *obj)
+void mpu6050_i2cSlv0CtrlReadReg(tMPU6050_DEV *dev, tMPU6050_I2C_SLV0_CTRL *obj)
 {
-    uint8_t reg = i2c_receive(MPU6050_I2C_ADDR, MPU6050_I2C_SLV0_CTRL);
-    obj->I2C_SLV0_EN = reg >> 7;
-    obj->I2C_SLV0_BYTE_SW = (reg >> 6) & 0x01;
-    obj->I2C_SLV0_REG_DIS = (reg >> 5) & 0x01;
-    obj->I2C_SLV0_GRP = (reg >> 4) & 0x01;
-    obj->I2C_SLV0_LEN = reg & 0x0F;
+    mpu6050_regRead(dev, MPU6050_CODEC_I2C_SLV0_CTRL, obj);
 }
 
 /**
  *  \brief Write to I2C Slave 0 CTRL register
  *  
+ *  \param [in] dev Device handle
  *  \param [in] obj Datatype pointer to return register values
  *  
  *  \details See register datasheet chapter 4.8 for more details.
  */
-void mpu6050_i2cSlv0CtrlWriteReg(tMPU6050_I2C_SLV0_CTRL *obj)
+void mpu6050_i2cSlv0CtrlWriteReg(tMPU6050_DEV *dev, tMPU6050_I2C_SLV0_CTRL *obj)
 {
-    uint8_t reg = (uint8_t)(obj->I2C_SLV0_EN) << 7;
-    reg |= (uint8_t)(obj->I2C_SLV0_BYTE_SW) << 6;
-    reg |= (uint8_t)(obj->I2C_SLV0_REG_DIS) << 5;
-    reg |= (uint8_t)(obj->I2C_SLV0_GRP) << 4;
-    reg |= (uint8_t)(obj->I2C_SLV0_LEN);
-    i2c_write(MPU6050_I2C_ADDR, MPU6050_I2C_SLV0_CTRL, reg);
+    mpu6050_regWrite(dev, MPU6050_CODEC_I2C_SLV0_CTRL, obj);
 }
 
 /**
  *  \brief Read I2C Slave 0 registers
  *  
+ *  \param [in] dev Device handle
  *  \param [in] obj Datatype pointer to return register values
  *  
  *  \details Read all I2C Slave 0 registers with one function
  */
-void mpu6050_i2cSlv0ReadReg(tMPU6050_I2C_SLV0 *obj)
+void mpu6050_i2cSlv0ReadReg(tMPU6050_DEV *dev, tMPU6050_I2C_SLV0 *obj)
 {
-    mpu6050_i2cSlv0AddrReadReg(&(obj->ADDR));
-    mpu6050_i2cSlv0RegReadReg(&(obj->REG));
-    mpu6050_i2cSlv0CtrlReadReg(&(obj->CTRL));
+    uint8_t buf[3];
+
+    // one burst read fills the shadow cache for the single register reads
+    mpu6050_busReadBurst(dev, MPU6050_I2C_SLV0_ADDR, buf, 3);
+
+    mpu6050_i2cSlv0AddrReadReg(dev, &(obj->ADDR));
+    mpu6050_i2cSlv0RegReadReg(dev, &(obj->REG));
+    mpu6050_i2cSlv0CtrlReadReg(dev, &(obj->CTRL));
 }
 
 /**
  *  \brief Write to I2C Slave 0 registers
  *  
+ *  \param [in] dev Device handle
  *  \param [in] obj Datatype pointer to return register values
  *  
  *  \details Write all I2C Slave 0 registers with one function
  */
-void mpu6050_i2cSlv0WriteReg(tMPU6050_I2C_SLV0 *obj)
+void mpu6050_i2cSlv0WriteReg(tMPU6050_DEV *dev, tMPU6050_I2C_SLV0 *obj)
 {
-    mpu6050_i2cSlv0AddrWriteReg(&(obj->ADDR));
-    mpu6050_i2cSlv0RegWriteReg(&(obj->REG));
-    mpu6050_i2cSlv0CtrlWriteReg(&(obj->CTRL));
+    tMPU6050_BATCH batch;
+
+    // ADDR, REG and CTRL are adjacent: one burst write
+    mpu6050_batchBegin(dev, &batch);
+    mpu6050_i2cSlv0AddrWriteReg(dev, &(obj->ADDR));
+    mpu6050_i2cSlv0RegWriteReg(dev, &(obj->REG));
+    mpu6050_i2cSlv0CtrlWriteReg(dev, &(obj->CTRL));
+    mpu6050_batchCommit(dev);
 }
\ No newline at end of file
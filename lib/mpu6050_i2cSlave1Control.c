@@ -26,118 +26,124 @@
  *  \copyright Copyright 2021 Jean-Marcel Herzog. All rights reserved. This project is released under the GNU Public License.
  */
 
+#include "mpu6050_batchWrite.h"
+#include "mpu6050_registerCodec.h"
 #include "mpu6050_i2cSlave1Control.h"
 
 /**
  *  \brief Read I2C Slave 1 ADDR register
  *  
+ *  \param [in] dev Device handle
  *  \param [in] obj Datatype pointer to return register values
  *  
  *  \details See register datasheet chapter 4.9 for more details.
  */
-void mpu6050_i2cSlv1AddrReadReg(tMPU6050_I2C_SLV1_ADDR *obj)
+void mpu6050_i2cSlv1AddrReadReg(tMPU6050_DEV *dev, tMPU6050_I2C_SLV1_ADDR *obj)
 {
-    uint8_t reg = i2c_receive(MPU6050_I2C_ADDR, MPU6050_I2C_SLV1_ADDR);
-
-    obj->I2C_SLV1_RW = reg >> 7;
-    obj->I2C_SLV1_ADDR = reg & 0x7F;
+    mpu6050_regRead(dev, MPU6050_CODEC_I2C_SLV1_ADDR, obj);
 }
 
 /**
  *  \brief Write to I2C Slave 1 ADDR register
  *  
+ *  \param [in] dev Device handle
  *  \param [in] obj Datatype pointer to return register values
  *  
  *  \details See register datasheet chapter 4.9 for more details.
  */
-void mpu6050_i2cSlv1AddrWriteReg(tMPU6050_I2C_SLV1_ADDR *obj)
+void mpu6050_i2cSlv1AddrWriteReg(tMPU6050_DEV *dev, tMPU6050_I2C_SLV1_ADDR *obj)
 {
-    uint8_t reg = (uint8_t)obj->I2C_SLV1_RW << 7 | (uint8_t)obj->I2C_SLV1_ADDR;
-    i2c_write(MPU6050_I2C_ADDR, MPU6050_I2C_SLV1_ADDR, reg);
+    mpu6050_regWrite(dev, MPU6050_CODEC_I2C_SLV1_ADDR, obj);
 }
 
 /**
  *  \brief Read I2C Slave 1 REG register
  *  
+ *  \param [in] dev Device handle
  *  \param [in] obj Datatype pointer to return register values
  *  
  *  \details See register datasheet chapter 4.9 for more details.
  */
-void mpu6050_i2cSlv1RegReadReg(tMPU6050_I2C_SLV1_REG *obj)
+void mpu6050_i2cSlv1RegReadReg(tMPU6050_DEV *dev, tMPU6050_I2C_SLV1_REG *obj)
 {
-    *obj = i2c_receive(MPU6050_I2C_ADDR, MPU6050_I2C_SLV1_REG);
+    *obj = mpu6050_busRead(dev, MPU6050_I2C_SLV1_REG);
 }
 
 /**
  *  \brief Write to I2C Slave 1 REG register
  *  
+ *  \param [in] dev Device handle
  *  \param [in] obj Datatype pointer to return register values
  *  
  *  \details See register datasheet chapter 4.9 for more details.
  */
-void mpu6050_i2cSlv1RegWriteReg(tMPU6050_I2C_SLV1_REG *obj)
+void mpu6050_i2cSlv1RegWriteReg(tMPU6050_DEV *dev, tMPU6050_I2C_SLV1_REG *obj)
 {
-    i2c_write(MPU6050_I2C_ADDR, MPU6050_I2C_SLV1_REG, *obj);
+    mpu6050_busWrite(dev, MPU6050_I2C_SLV1_REG, *obj);
 }
 
 /**
  *  \brief Read I2C Slave 1 CTRL register
  *  
+ *  \param [in] dev Device handle
  *  \param [in] obj Datatype pointer to return register values
  *  
  *  \details See register datasheet chapter 4.9 for more details.
  */
-void mpu6050_i2cSlv1CtrlReadReg(tMPU6050_I2C_SLV1_CTRL *obj)
+void mpu6050_i2cSlv1CtrlReadReg(tMPU6050_DEV *dev, tMPU6050_I2C_SLV1_CTRL *obj)
 {
-    uint8_t reg = i2c_receive(MPU6050_I2C_ADDR, MPU6050_I2C_SLV1_CTRL);
-    obj->I2C_SLV1_EN = reg >> 7;
-    obj->I2C_SLV1_BYTE_SW = (reg >> 6) & 0x01;
-    obj->I2C_SLV1_REG_DIS = (reg >> 5) & 0x01;
-    obj->I2C_SLV1_GRP = (reg >> 4) & 0x01;
-    obj->I2C_SLV1_LEN = reg & 0x0F;
+    mpu6050_regRead(dev, MPU6050_CODEC_I2C_SLV1_CTRL, obj);
 }
 
 /**
  *  \brief Write to I2C Slave 1 CTRL register
  *  
+ *  \param [in] dev Device handle
  *  \param [in] obj Datatype pointer to return register values
  *  
  *  \details See register datasheet chapter 4.9 for more details.
  */
-void mpu6050_i2cSlv1CtrlWriteReg(tMPU6050_I2C_SLV1_CTRL *obj)
+void mpu6050_i2cSlv1CtrlWriteReg(tMPU6050_DEV *dev, tMPU6050_I2C_SLV1_CTRL *obj)
 {
-    uint8_t reg = (uint8_t)(obj->I2C_SLV1_EN) << 7;
-    reg |= (uint8_t)(obj->I2C_SLV1_BYTE_SW) << 6;
-    reg |= (uint8_t)(obj->I2C_SLV1_REG_DIS) << 5;
-    reg |= (uint8_t)(obj->I2C_SLV1_GRP) << 4;
-    reg |= (uint8_t)(obj->I2C_SLV1_LEN);
-    i2c_write(MPU6050_I2C_ADDR, MPU6050_I2C_SLV1_CTRL, reg);
+    mpu6050_regWrite(dev, MPU6050_CODEC_I2C_SLV1_CTRL, obj);
 }
 
 /**
  *  \brief Read I2C Slave 1 registers
  *  
+ *  \param [in] dev Device handle
  *  \param [in] obj Datatype pointer to return register values
  *  
  *  \details Read all I2C Slave 1 registers with one function.
  */
-void mpu6050_i2cSlv1ReadReg(tMPU6050_I2C_SLV1 *obj)
+void mpu6050_i2cSlv1ReadReg(tMPU6050_DEV *dev, tMPU6050_I2C_SLV1 *obj)
 {
-    mpu6050_i2cSlv1AddrReadReg(&(obj->ADDR));
-    mpu6050_i2cSlv1RegReadReg(&(obj->REG));
-    mpu6050_i2cSlv1CtrlReadReg(&(obj->CTRL));
+    uint8_t buf[3];
+
+    // one burst read fills the shadow cache for the single register reads
+    mpu6050_busReadBurst(dev, MPU6050_I2C_SLV1_ADDR, buf, 3);
+
+    mpu6050_i2cSlv1AddrReadReg(dev, &(obj->ADDR));
+    mpu6050_i2cSlv1RegReadReg(dev, &(obj->REG));
+    mpu6050_i2cSlv1CtrlReadReg(dev, &(obj->CTRL));
 }
 
 /**
  *  \brief Write to I2C Slave 1 registers
  *  
+ *  \param [in] dev Device handle
  *  \param [in] obj Datatype pointer to return register values
  *  
  *  \details Write all I2C Slave 1 registers with one function.
  */
-void mpu6050_i2cSlv1WriteReg(tMPU6050_I2C_SLV1 *obj)
+void mpu6050_i2cSlv1WriteReg(tMPU6050_DEV *dev, tMPU6050_I2C_SLV1 *obj)
 {
-    mpu6050_i2cSlv1AddrWriteReg(&(obj->ADDR));
-    mpu6050_i2cSlv1RegWriteReg(&(obj->REG));
-    mpu6050_i2cSlv1CtrlWriteReg(&(obj->CTRL));
+    tMPU6050_BATCH batch;
+
+    // ADDR, REG and CTRL are adjacent: one burst write
+    mpu6050_batchBegin(dev, &batch);
+    mpu6050_i2cSlv1AddrWriteReg(dev, &(obj->ADDR));
+    mpu6050_i2cSlv1RegWriteReg(dev, &(obj->REG));
+    mpu6050_i2cSlv1CtrlWriteReg(dev, &(obj->CTRL));
+    mpu6050_batchCommit(dev);
 }
\ No newline at end of file
@@ -26,18 +26,22 @@
 
 #include <stdint.h>
 #include <stdbool.h>
-#include "i2c.h"
-#include "mpu6050_reg.h"
+#include "mpu6050_transport.h"
 
 /** Datatype for I2C Slave 1 ADDR register */
-typedef struct
+typedef union
 {
-    /** When set to 1, this bit configures the data transfer as a read operation.
-     * When cleared to 0, this bit configures the data transfer as a write operation. */
-    bool I2C_SLV1_RW;
+    uint8_t RAW;                /**< Register value */
+
+    struct
+    {
+        /** I2C address of slave 1 */
+        unsigned char I2C_SLV1_ADDR : 7;
 
-    /** I2C address of slave 1 */
-    unsigned char I2C_SLV1_ADDR: 7;
+        /** When set to 1, this bit configures the data transfer as a read operation.
+         * When cleared to 0, this bit configures the data transfer as a write operation. */
+        bool I2C_SLV1_RW : 1;
+    };
 }
 tMPU6050_I2C_SLV1_ADDR;
 
@@ -45,30 +49,35 @@ tMPU6050_I2C_SLV1_ADDR;
 typedef unsigned char tMPU6050_I2C_SLV1_REG;
 
 /** Datatype for I2C Slave 1 CTRL register */
-typedef struct
+typedef union
 {
-    /** When set to 1, this bit enables Slave 1 for data transfer operations.
-     * When cleared to 0, this bit disables Slave 0 from data transfer operations. */
-    bool I2C_SLV1_EN;
-
-    /** When set to 1, this bit enables byte swapping. When byte swapping is enabled, the
-     * high and low bytes of a word pair are swapped. */
-    bool I2C_SLV1_BYTE_SW;
-
-    /** When set to 1, the transaction will read or write data only.
-     * When cleared to 0, the transaction will write a register address prior to
-     * reading or writing data. */
-    bool I2C_SLV1_REG_DIS;
-
-    /** Specifying the grouping order of word pairs received from registers. When cleared to 0,
-     * bytes from register addresses 0 and 1, 2 and 3, etc (even, then odd register addresses)
-     * are paired to form a word. When set to 1, bytes from register addresses are
-     * paired 1 and 2, 3 and 4, etc. (odd, then even register addresses) are paired
-     * to form a word.  */
-    bool I2C_SLV1_GRP;
-
-    /** Specifies the number of bytes transferred to and from Slave 1. */
-    unsigned char I2C_SLV1_LEN: 4;
+    uint8_t RAW;                /**< Register value */
+
+    struct
+    {
+        /** Specifies the number of bytes transferred to and from Slave 1. */
+        unsigned char I2C_SLV1_LEN : 4;
+
+        /** Specifying the grouping order of word pairs received from registers. When cleared to 0,
+         * bytes from register addresses 0 and 1, 2 and 3, etc (even, then odd register addresses)
+         * are paired to form a word. When set to 1, bytes from register addresses are
+         * paired 1 and 2, 3 and 4, etc. (odd, then even register addresses) are paired
+         * to form a word.  */
+        bool I2C_SLV1_GRP : 1;
+
+        /** When set to 1, the transaction will read or write data only.
+         * When cleared to 0, the transaction will write a register address prior to
+         * reading or writing data. */
+        bool I2C_SLV1_REG_DIS : 1;
+
+        /** When set to 1, this bit enables byte swapping. When byte swapping is enabled, the
+         * high and low bytes of a word pair are swapped. */
+        bool I2C_SLV1_BYTE_SW : 1;
+
+        /** When set to 1, this bit enables Slave 1 for data transfer operations.
+         * When cleared to 0, this bit disables Slave 0 from data transfer operations. */
+        bool I2C_SLV1_EN : 1;
+    };
 }
 tMPU6050_I2C_SLV1_CTRL;
 
@@ -81,16 +90,16 @@ typedef struct
 }
 tMPU6050_I2C_SLV1;
 
-extern void mpu6050_i2cSlv1AddrReadReg(tMPU6050_I2C_SLV1_ADDR*);
-extern void mpu6050_i2cSlv1AddrWriteReg(tMPU6050_I2C_SLV1_ADDR*);
+extern void mpu6050_i2cSlv1AddrReadReg(tMPU6050_DEV*, tMPU6050_I2C_SLV1_ADDR*);
+extern void mpu6050_i2cSlv1AddrWriteReg(tMPU6050_DEV*, tMPU6050_I2C_SLV1_ADDR*);
 
-extern void mpu6050_i2cSlv1RegReadReg(tMPU6050_I2C_SLV1_REG*);
-extern void mpu6050_i2cSlv1RegWriteReg(tMPU6050_I2C_SLV1_REG*);
+extern void mpu6050_i2cSlv1RegReadReg(tMPU6050_DEV*, tMPU6050_I2C_SLV1_REG*);
+extern void mpu6050_i2cSlv1RegWriteReg(tMPU6050_DEV*, tMPU6050_I2C_SLV1_REG*);
 
-extern void mpu6050_i2cSlv1CtrlReadReg(tMPU6050_I2C_SLV1_CTRL*);
-extern void mpu6050_i2cSlv1CtrlWriteReg(tMPU6050_I2C_SLV1_CTRL*);
+extern void mpu6050_i2cSlv1CtrlReadReg(tMPU6050_DEV*, tMPU6050_I2C_SLV1_CTRL*);
+extern void mpu6050_i2cSlv1CtrlWriteReg(tMPU6050_DEV*, tMPU6050_I2C_SLV1_CTRL*);
 
-extern void mpu6050_i2cSlv1ReadReg(tMPU6050_I2C_SLV1*);
-extern void mpu6050_i2cSlv1WriteReg(tMPU6050_I2C_SLV1*);
+extern void mpu6050_i2cSlv1ReadReg(tMPU6050_DEV*, tMPU6050_I2C_SLV1*);
+extern void mpu6050_i2cSlv1WriteReg(tMPU6050_DEV*, tMPU6050_I2C_SLV1*);
 
 #endif
\ No newline at end of file
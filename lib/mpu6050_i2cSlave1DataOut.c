@@ -33,23 +33,25 @@
 /**
  *  \brief Read I2C Slave 1 Data Out register
  *  
+ *  \param [in] dev Device handle
  *  \param [in] obj Datatype pointer to return register values
  *  
  *  \details See register datasheet chapter 4.22 for more details.
  */
-void mpu6050_i2cSlv1DoReadReg(tMPU6050_I2C_SLV1_DO *obj)
+void mpu6050_i2cSlv1DoReadReg(tMPU6050_DEV *dev, tMPU6050_I2C_SLV1_DO *obj)
 {
-    *obj = i2c_receive(MPU6050_I2C_ADDR, MPU6050_I2C_SLV1_DO);
+    *obj = mpu6050_busRead(dev, MPU6050_I2C_SLV1_DO);
 }
 
 /**
  *  \brief Write to I2C Slave 1 Data Out register
  *  
+ *  \param [in] dev Device handle
  *  \param [in] obj Datatype pointer to return register values
  *  
  *  \details See register datasheet chapter 4.22 for more details.
  */
-void mpu6050_i2cSlv1DoWriteReg(tMPU6050_I2C_SLV1_DO *obj)
+void mpu6050_i2cSlv1DoWriteReg(tMPU6050_DEV *dev, tMPU6050_I2C_SLV1_DO *obj)
 {
-    i2c_write(MPU6050_I2C_ADDR, MPU6050_I2C_SLV1_DO, *obj);
+    mpu6050_busWrite(dev, MPU6050_I2C_SLV1_DO, *obj);
 }
\ No newline at end of file
@@ -26,12 +26,11 @@
 
 #include <stdint.h>
 #include <stdbool.h>
-#include "i2c.h"
-#include "mpu6050_reg.h"
+#include "mpu6050_transport.h"
 
 typedef uint8_t tMPU6050_I2C_SLV1_DO;	/**< Datatype for I2C Slave Data Out register */
 
-extern void mpu6050_i2cSlv1DoReadReg(tMPU6050_I2C_SLV1_DO*);
-extern void mpu6050_i2cSlv1DoWriteReg(tMPU6050_I2C_SLV1_DO*);
+extern void mpu6050_i2cSlv1DoReadReg(tMPU6050_DEV*, tMPU6050_I2C_SLV1_DO*);
+extern void mpu6050_i2cSlv1DoWriteReg(tMPU6050_DEV*, tMPU6050_I2C_SLV1_DO*);
 
 #endif
\ No newline at end of file
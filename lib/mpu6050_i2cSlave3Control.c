@@ -26,118 +26,124 @@
  *  \copyright Copyright 2021 Jean-Marcel Herzog. All rights reserved. This project is released under the GNU Public License.
  */
 
+#include "mpu6050_batchWrite.h"
+#include "mpu6050_registerCodec.h"
 #include "mpu6050_i2cSlave3Control.h"
 
 /**
  *  \brief Read I2C Slave 3 ADDR register
  *  
+ *  \param [in] dev Device handle
  *  \param [in] obj Datatype pointer to return register values
  *  
  *  \details See register datasheet chapter 4.11 for more details.
  */
-void mpu6050_i2cSlv3AddrReadReg(tMPU6050_I2C_SLV3_ADDR *obj)
+void mpu6050_i2cSlv3AddrReadReg(tMPU6050_DEV *dev, tMPU6050_I2C_SLV3_ADDR *obj)
 {
-    uint8_t reg = i2c_receive(MPU6050_I2C_ADDR, MPU6050_I2C_SLV3_ADDR);
-    obj->I2C_SLV3_RW = reg >> 7;
-    obj->I2C_SLV3_ADDR = reg & 0x7F;
+    mpu6050_regRead(dev, MPU6050_CODEC_I2C_SLV3_ADDR, obj);
 }
 
 /**
  *  \brief Write I2C Slave 3 ADDR register
  *  
+ *  \param [in] dev Device handle
  *  \param [in] obj Datatype pointer to return register values
  *  
  *  \details See register datasheet chapter 4.11 for more details.
  */
-void mpu6050_i2cSlv3AddrWriteReg(tMPU6050_I2C_SLV3_ADDR *obj)
+void mpu6050_i2cSlv3AddrWriteReg(tMPU6050_DEV *dev, tMPU6050_I2C_SLV3_ADDR *obj)
 {
-    uint8_t reg = (uint8_t)obj->I2C_SLV3_RW << 7 | (uint8_t)obj->I2C_SLV3_ADDR;
-    i2c_write(MPU6050_I2C_ADDR, MPU6050_I2C_SLV3_ADDR, reg);
+    mpu6050_regWrite(dev, MPU6050_CODEC_I2C_SLV3_ADDR, obj);
 }
 
 /**
  *  \brief Read I2C Slave 3 Register register
  *  
+ *  \param [in] dev Device handle
  *  \param [in] obj Datatype pointer to return register values
  *  
  *  \details See register datasheet chapter 4.11 for more details.
  */
-void mpu6050_i2cSlv3RegReadReg(tMPU6050_I2C_SLV3_REG *obj)
+void mpu6050_i2cSlv3RegReadReg(tMPU6050_DEV *dev, tMPU6050_I2C_SLV3_REG *obj)
 {
-    *obj = i2c_receive(MPU6050_I2C_ADDR, MPU6050_I2C_SLV3_REG);
+    *obj = mpu6050_busRead(dev, MPU6050_I2C_SLV3_REG);
 }
 
 /**
  *  \brief Write to I2C Slave 3 Register register
  *  
+ *  \param [in] dev Device handle
  *  \param [in] obj Datatype pointer to return register values
  *  
  *  \details See register datasheet chapter 4.11 for more details.
  */
-void mpu6050_i2cSlv3RegWriteReg(tMPU6050_I2C_SLV3_REG *obj)
+void mpu6050_i2cSlv3RegWriteReg(tMPU6050_DEV *dev, tMPU6050_I2C_SLV3_REG *obj)
 {
-    i2c_write(MPU6050_I2C_ADDR, MPU6050_I2C_SLV3_REG, *obj);
+    mpu6050_busWrite(dev, MPU6050_I2C_SLV3_REG, *obj);
 }
 
 /**
  *  \brief Read I2C Slave 3 CTRL register
  *  
+ *  \param [in] dev Device handle
  *  \param [in] obj Datatype pointer to return register values
  *  
  *  \details See register datasheet chapter 4.11 for more details.
  */
-void mpu6050_i2cSlv3CtrlReadReg(tMPU6050_I2C_SLV3_CTRL *obj)
+void mpu6050_i2cSlv3CtrlReadReg(tMPU6050_DEV *dev, tMPU6050_I2C_SLV3_CTRL *obj)
 {
-    uint8_t reg = i2c_receive(MPU6050_I2C_ADDR, MPU6050_I2C_SLV3_CTRL);
-
-    obj->I2C_SLV3_EN = reg >> 7;
-    obj->I2C_SLV3_BYTE_SW = (reg >> 6) & 0x01;
-    obj->I2C_SLV3_REG_DIS = (reg >> 5) & 0x01;
-    obj->I2C_SLV3_GRP = (reg >> 4) & 0x01;
-    obj->I2C_SLV3_LEN = reg & 0x0F;
+    mpu6050_regRead(dev, MPU6050_CODEC_I2C_SLV3_CTRL, obj);
 }
 
 /**
  *  \brief Write to I2C Slave 3 CTRL register
  *  
+ *  \param [in] dev Device handle
  *  \param [in] obj Datatype pointer to return register values
  *  
  *  \details See register datasheet chapter 4.11 for more details.
  */
-void mpu6050_i2cSlv3CtrlWriteReg(tMPU6050_I2C_SLV3_CTRL *obj)
+void mpu6050_i2cSlv3CtrlWriteReg(tMPU6050_DEV *dev, tMPU6050_I2C_SLV3_CTRL *obj)
 {
-    uint8_t reg = (uint8_t)(obj->I2C_SLV3_EN) << 7;
-    reg |= (uint8_t)(obj->I2C_SLV3_BYTE_SW) << 6;
-    reg |= (uint8_t)(obj->I2C_SLV3_REG_DIS) << 5;
-    reg |= (uint8_t)(obj->I2C_SLV3_GRP) << 4;
-    reg |= (uint8_t)(obj->I2C_SLV3_LEN);
-    i2c_write(MPU6050_I2C_ADDR, MPU6050_I2C_SLV3_CTRL, reg);
+    mpu6050_regWrite(dev, MPU6050_CODEC_I2C_SLV3_CTRL, obj);
 }
 
 /**
  *  \brief Read I2C Slave 3 registers
  *  
+ *  \param [in] dev Device handle
  *  \param [in] obj Datatype pointer to return register values
  *  
  *  \details Read all I2C Slave 3 registers with one function.
  */
-void mpu6050_i2cSlv3ReadReg(tMPU6050_I2C_SLV3 *obj)
+void mpu6050_i2cSlv3ReadReg(tMPU6050_DEV *dev, tMPU6050_I2C_SLV3 *obj)
 {
-    mpu6050_i2cSlv3AddrReadReg(&(obj->ADDR));
-    mpu6050_i2cSlv3RegReadReg(&(obj->REG));
-    mpu6050_i2cSlv3CtrlReadReg(&(obj->CTRL));
+    uint8_t buf[3];
+
+    // one burst read fills the shadow cache for the single register reads
+    mpu6050_busReadBurst(dev, MPU6050_I2C_SLV3_ADDR, buf, 3);
+
+    mpu6050_i2cSlv3AddrReadReg(dev, &(obj->ADDR));
+    mpu6050_i2cSlv3RegReadReg(dev, &(obj->REG));
+    mpu6050_i2cSlv3CtrlReadReg(dev, &(obj->CTRL));
 }
 
 /**
  *  \brief Write to I2C Slave 3 registers
  *  
+ *  \param [in] dev Device handle
  *  \param [in] obj Datatype pointer to return register values
  *  
  *  \details Write to all I2C Slave 3 registers with one function.
  */
-void mpu6050_i2cSlv3WriteReg(tMPU6050_I2C_SLV3 *obj)
+void mpu6050_i2cSlv3WriteReg(tMPU6050_DEV *dev, tMPU6050_I2C_SLV3 *obj)
 {
-    mpu6050_i2cSlv3AddrWriteReg(&(obj->ADDR));
-    mpu6050_i2cSlv3RegWriteReg(&(obj->REG));
-    mpu6050_i2cSlv3CtrlWriteReg(&(obj->CTRL));
+    tMPU6050_BATCH batch;
+
+    // ADDR, REG and CTRL are adjacent: one burst write
+    mpu6050_batchBegin(dev, &batch);
+    mpu6050_i2cSlv3AddrWriteReg(dev, &(obj->ADDR));
+    mpu6050_i2cSlv3RegWriteReg(dev, &(obj->REG));
+    mpu6050_i2cSlv3CtrlWriteReg(dev, &(obj->CTRL));
+    mpu6050_batchCommit(dev);
 }
\ No newline at end of file
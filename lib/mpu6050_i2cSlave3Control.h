@@ -26,47 +26,56 @@
 
 #include <stdint.h>
 #include <stdbool.h>
-#include "i2c.h"
-#include "mpu6050_reg.h"
+#include "mpu6050_transport.h"
 
-typedef struct
+typedef union
 {
-    /** When set to 1, this bit configures the data transfer as a read operation.
-     * When cleared to 0, this bit configures the data transfer as a write operation. */
-    bool I2C_SLV3_RW;
+    uint8_t RAW;                /**< Register value */
+
+    struct
+    {
+        /** I2C address of slave 3 */
+        unsigned char I2C_SLV3_ADDR : 7;
 
-    /** I2C address of slave 3 */
-    unsigned char I2C_SLV3_ADDR: 7;
+        /** When set to 1, this bit configures the data transfer as a read operation.
+         * When cleared to 0, this bit configures the data transfer as a write operation. */
+        bool I2C_SLV3_RW : 1;
+    };
 }
 tMPU6050_I2C_SLV3_ADDR;
 
 /** Slave 3 address to/from which data transfer starts. */
 typedef unsigned char tMPU6050_I2C_SLV3_REG;
 
-typedef struct
+typedef union
 {
-    /** When set to 1, this bit enables Slave 3 for data transfer operations.
-     * When cleared to 0, this bit disables Slave 0 from data transfer operations. */
-    bool I2C_SLV3_EN;
-
-    /** When set to 1, this bit enables byte swapping. When byte swapping is enabled, the
-     * high and low bytes of a word pair are swapped. */
-    bool I2C_SLV3_BYTE_SW;
-
-    /** When set to 1, the transaction will read or write data only.
-     * When cleared to 0, the transaction will write a register address prior to
-     * reading or writing data. */
-    bool I2C_SLV3_REG_DIS;
-
-    /** Specifying the grouping order of word pairs received from registers. When cleared to 0,
-     * bytes from register addresses 0 and 1, 2 and 3, etc (even, then odd register addresses)
-     * are paired to form a word. When set to 1, bytes from register addresses are
-     * paired 1 and 2, 3 and 4, etc. (odd, then even register addresses) are paired
-     * to form a word.  */
-    bool I2C_SLV3_GRP;
-
-    /** Specifies the number of bytes transferred to and from Slave 2. */
-    unsigned char I2C_SLV3_LEN: 4;
+    uint8_t RAW;                /**< Register value */
+
+    struct
+    {
+        /** Specifies the number of bytes transferred to and from Slave 2. */
+        unsigned char I2C_SLV3_LEN : 4;
+
+        /** Specifying the grouping order of word pairs received from registers. When cleared to 0,
+         * bytes from register addresses 0 and 1, 2 and 3, etc (even, then odd register addresses)
+         * are paired to form a word. When set to 1, bytes from register addresses are
+         * paired 1 and 2, 3 and 4, etc. (odd, then even register addresses) are paired
+         * to form a word.  */
+        bool I2C_SLV3_GRP : 1;
+
+        /** When set to 1, the transaction will read or write data only.
+         * When cleared to 0, the transaction will write a register address prior to
+         * reading or writing data. */
+        bool I2C_SLV3_REG_DIS : 1;
+
+        /** When set to 1, this bit enables byte swapping. When byte swapping is enabled, the
+         * high and low bytes of a word pair are swapped. */
+        bool I2C_SLV3_BYTE_SW : 1;
+
+        /** When set to 1, this bit enables Slave 3 for data transfer operations.
+         * When cleared to 0, this bit disables Slave 0 from data transfer operations. */
+        bool I2C_SLV3_EN : 1;
+    };
 }
 tMPU6050_I2C_SLV3_CTRL;
 
@@ -79,16 +88,16 @@ typedef struct
 }
 tMPU6050_I2C_SLV3;
 
-extern void mpu6050_i2cSlv3AddrReadReg(tMPU6050_I2C_SLV3_ADDR*);
-extern void mpu6050_i2cSlv3AddrWriteReg(tMPU6050_I2C_SLV3_ADDR*);
+extern void mpu6050_i2cSlv3AddrReadReg(tMPU6050_DEV*, tMPU6050_I2C_SLV3_ADDR*);
+extern void mpu6050_i2cSlv3AddrWriteReg(tMPU6050_DEV*, tMPU6050_I2C_SLV3_ADDR*);
 
-extern void mpu6050_i2cSlv3RegReadReg(tMPU6050_I2C_SLV3_REG*);
-extern void mpu6050_i2cSlv3RegWriteReg(tMPU6050_I2C_SLV3_REG*);
+extern void mpu6050_i2cSlv3RegReadReg(tMPU6050_DEV*, tMPU6050_I2C_SLV3_REG*);
+extern void mpu6050_i2cSlv3RegWriteReg(tMPU6050_DEV*, tMPU6050_I2C_SLV3_REG*);
 
-extern void mpu6050_i2cSlv3CtrlReadReg(tMPU6050_I2C_SLV3_CTRL*);
-extern void mpu6050_i2cSlv3CtrlWriteReg(tMPU6050_I2C_SLV3_CTRL*);
+extern void mpu6050_i2cSlv3CtrlReadReg(tMPU6050_DEV*, tMPU6050_I2C_SLV3_CTRL*);
+extern void mpu6050_i2cSlv3CtrlWriteReg(tMPU6050_DEV*, tMPU6050_I2C_SLV3_CTRL*);
 
-extern void mpu6050_i2cSlv3ReadReg(tMPU6050_I2C_SLV3*);
-extern void mpu6050_i2cSlv3WriteReg(tMPU6050_I2C_SLV3*);
+extern void mpu6050_i2cSlv3ReadReg(tMPU6050_DEV*, tMPU6050_I2C_SLV3*);
+extern void mpu6050_i2cSlv3WriteReg(tMPU6050_DEV*, tMPU6050_I2C_SLV3*);
 
 #endif
\ No newline at end of file
@@ -26,12 +26,11 @@
 
 #include <stdint.h>
 #include <stdbool.h>
-#include "i2c.h"
-#include "mpu6050_reg.h"
+#include "mpu6050_transport.h"
 
 typedef uint8_t tMPU6050_I2C_SLV3_DO;
 
-extern void mpu6050_i2cSlv3DoReadReg(tMPU6050_I2C_SLV3_DO*);
-extern void mpu6050_i2cSlv3DoWriteReg(tMPU6050_I2C_SLV3_DO*);
+extern void mpu6050_i2cSlv3DoReadReg(tMPU6050_DEV*, tMPU6050_I2C_SLV3_DO*);
+extern void mpu6050_i2cSlv3DoWriteReg(tMPU6050_DEV*, tMPU6050_I2C_SLV3_DO*);
 
 #endif
\ No newline at end of file
@@ -65,166 +65,174 @@
  *  \copyright Copyright 2021 Jean-Marcel Herzog. All rights reserved. This project is released under the GNU Public License.
  */
 
+#include "mpu6050_batchWrite.h"
+#include "mpu6050_registerCodec.h"
 #include "mpu6050_i2cSlave4Control.h"
 
 /**
  *  \brief Read I2C Slave 4 Address register
  *  
+ *  \param [in] dev Device handle
  *  \param [in] obj Datatype pointer to return register values
  *  
  *  \details See register datasheet chapter 4.12 for more details.
  */
-void mpu6050_i2c_slv4AddrReadReg(tMPU6050_I2C_SLV4_ADDR *obj)
+void mpu6050_i2cSlv4AddrReadReg(tMPU6050_DEV *dev, tMPU6050_I2C_SLV4_ADDR *obj)
 {
-    uint8_t reg = i2c_receive(MPU6050_I2C_ADDR, MPU6050_I2C_SLV4_ADDR);
-    obj->I2C_SLV4_RW = reg >> 7;
-    obj->I2C_SLV4_ADDR = reg & 0x7F;
+    mpu6050_regRead(dev, MPU6050_CODEC_I2C_SLV4_ADDR, obj);
 }
 
 /**
  *  \brief Write to I2C Slave 4 Address register
  *  
+ *  \param [in] dev Device handle
  *  \param [in] obj Datatype pointer to return register values
  *  
  *  \details See register datasheet chapter 4.12 for more details.
  */
-void mpu6050_i2cSlv4AddrWriteReg(tMPU6050_I2C_SLV4_ADDR *obj)
+void mpu6050_i2cSlv4AddrWriteReg(tMPU6050_DEV *dev, tMPU6050_I2C_SLV4_ADDR *obj)
 {
-    uint8_t reg = (uint8_t)obj->I2C_SLV4_RW << 7 | (uint8_t)obj->I2C_SLV4_ADDR;
-    i2c_write(MPU6050_I2C_ADDR, MPU6050_I2C_SLV4_ADDR, reg);
+    mpu6050_regWrite(dev, MPU6050_CODEC_I2C_SLV4_ADDR, obj);
 }
 
 /**
  *  \brief Read I2C Slave 4 Register register
  *  
+ *  \param [in] dev Device handle
  *  \param [in] obj Datatype pointer to return register values
  *  
  *  \details See register datasheet chapter 4.12 for more details.
  */
-void mpu6050_i2cSlv4RegReadReg(tMPU6050_I2C_SLV4_REG *obj)
+void mpu6050_i2cSlv4RegReadReg(tMPU6050_DEV *dev, tMPU6050_I2C_SLV4_REG *obj)
 {
-    *obj = I2C_receive(MPU6050_I2C_ADDR, MPU6050_I2C_SLV4_REG);
+    *obj = mpu6050_busRead(dev, MPU6050_I2C_SLV4_REG);
 }
 /**
  *  \brief Read I2C Slave 4 Register register
  *  
+ *  \param [in] dev Device handle
  *  \param [in] obj Datatype pointer to return register values
  *  
  *  \details See register datasheet chapter 4.12 for more details.
  */
-void mpu6050_i2cSlv4RegWriteReg(tMPU6050_I2C_SLV4_REG *obj)
+void mpu6050_i2cSlv4RegWriteReg(tMPU6050_DEV *dev, tMPU6050_I2C_SLV4_REG *obj)
 {
-    i2c_write(MPU6050_I2C_ADDR, MPU6050_I2C_SLV4_REG, *obj);
+    mpu6050_busWrite(dev, MPU6050_I2C_SLV4_REG, *obj);
 }
 
 /**
  *  \brief Write to I2C Slave 4 DO register
  *  
+ *  \param [in] dev Device handle
  *  \param [in] obj Datatype pointer to return register values
  *  
  *  \details See register datasheet chapter 4.12 for more details.
  */
-void mpu6050_i2cSlv4DoReadReg(tMPU6050_I2C_SLV4_DO *obj)
+void mpu6050_i2cSlv4DoReadReg(tMPU6050_DEV *dev, tMPU6050_I2C_SLV4_DO *obj)
 {
-    *obj = i2c_receive(MPU6050_I2C_ADDR, MPU6050_I2C_SLV4_DO);
+    *obj = mpu6050_busRead(dev, MPU6050_I2C_SLV4_DO);
 }
 
 /**
  *  \brief Write to I2C Slave 4 DO register
  *  
+ *  \param [in] dev Device handle
  *  \param [in] obj Datatype pointer to return register values
  *  
  *  \details See register datasheet chapter 4.12 for more details.
  */
-void mpu6050_i2cSlv4DoWriteReg(tMPU6050_I2C_SLV4_DO *obj)
+void mpu6050_i2cSlv4DoWriteReg(tMPU6050_DEV *dev, tMPU6050_I2C_SLV4_DO *obj)
 {
-    i2c_write(MPU6050_I2C_ADDR, MPU6050_I2C_SLV4_DO, *obj);
+    mpu6050_busWrite(dev, MPU6050_I2C_SLV4_DO, *obj);
 }
 
 /**
  *  \brief Read I2C Slave 4 DI register
  *  
+ *  \param [in] dev Device handle
  *  \param [in] obj Datatype pointer to return register values
  *  
  *  \details See register datasheet chapter 4.12 for more details.
  */
-void mpu6050_i2cSlv4DiReadReg(tMPU6050_I2C_SLV4_DI *obj)
+void mpu6050_i2cSlv4DiReadReg(tMPU6050_DEV *dev, tMPU6050_I2C_SLV4_DI *obj)
 {
-    *obj = i2c_receive(MPU6050_I2C_ADDR, MPU6050_I2C_SLV4_DI);
+    *obj = mpu6050_busRead(dev, MPU6050_I2C_SLV4_DI);
 }
 
 /**
  *  \brief Write to I2C Slave 4 DI register
  *  
+ *  \param [in] dev Device handle
  *  \param [in] obj Datatype pointer to return register values
  *  
  *  \details See register datasheet chapter 4.12 for more details.
  */
-void mpu6050_i2cSlv4DiWriteReg(tMPU6050_I2C_SLV4_DI *obj)
+void mpu6050_i2cSlv4DiWriteReg(tMPU6050_DEV *dev, tMPU6050_I2C_SLV4_DI *obj)
 {
-    i2c_write(MPU6050_I2C_ADDR, MPU6050_I2C_SLV4_DI, *obj);
+    mpu6050_busWrite(dev, MPU6050_I2C_SLV4_DI, *obj);
 }
 
 /**
  *  \brief Read I2C Slave 4 CTRL register
  *  
+ *  \param [in] dev Device handle
  *  \param [in] obj Datatype pointer to return register values
  *  
  *  \details See register datasheet chapter 4.12 for more details.
  */
-void mpu6050_i2cSlv4CtrlReadReg(tMPU6050_I2C_SLV4_CTRL *obj)
+void mpu6050_i2cSlv4CtrlReadReg(tMPU6050_DEV *dev, tMPU6050_I2C_SLV4_CTRL *obj)
 {
-    uint8_t reg = i2c_receive(MPU6050_I2C_ADDR, MPU6050_I2C_SLV4_CTRL);
-    obj->I2C_SLV4_EN = reg >> 7;
-    obj->I2C_SLV4_INT_EN = (reg >> 6) & 0x01;
-    obj->I2C_SLV4_REG_DIS = (reg >> 5) & 0x01;
-    obj->I2C_MST_DLY = reg & 0x1F;
+    mpu6050_regRead(dev, MPU6050_CODEC_I2C_SLV4_CTRL, obj);
 }
 
 /**
  *  \brief Write to I2C Slave 4 CTRL register
  *  
+ *  \param [in] dev Device handle
  *  \param [in] obj Datatype pointer to return register values
  *  
  *  \details See register datasheet chapter 4.12 for more details.
  */
-void mpu6050_i2cSlv4CtrlWriteReg(tMPU6050_I2C_SLV4_CTRL *obj)
+void mpu6050_i2cSlv4CtrlWriteReg(tMPU6050_DEV *dev, tMPU6050_I2C_SLV4_CTRL *obj)
 {
-    uint8_t reg = (uint8_t)(obj->I2C_SLV4_EN) << 7;
-    reg |= (uint8_t)(obj->I2C_SLV4_INT_EN) << 6;
-    reg |= (uint8_t)(obj->I2C_SLV4_REG_DIS) << 5;
-    reg |= (uint8_t)(obj->I2C_MST_DLY);
-    i2c_write(MPU6050_I2C_ADDR, MPU6050_I2C_SLV4_CTRL, reg);
+    mpu6050_regWrite(dev, MPU6050_CODEC_I2C_SLV4_CTRL, obj);
 }
 
 /**
  *  \brief Read I2C Slave 4 registers
  *  
+ *  \param [in] dev Device handle
  *  \param [in] obj Datatype pointer to return register values
  *  
  *  \details Read all registers with one function call
  */
-void mpu6050_i2c_slv4_readReg(tMPU6050_I2C_SLV4 *obj)
+void mpu6050_i2cSlv4ReadReg(tMPU6050_DEV *dev, tMPU6050_I2C_SLV4 *obj)
 {
-    mpu6050_i2cSlv4AddrReadReg(&(obj->ADDR));
-    mpu6050_i2cSlv4RegReadReg(&(obj->REG));
-    mpu6050_i2cSlv4CtrlReadReg(&(obj->CTRL));
-    mpu6050_i2cSlv4DoReadReg(&(obj->DO));
-    mpu6050_i2cSlv4DiReadReg(&(obj->DI));
+    mpu6050_i2cSlv4AddrReadReg(dev, &(obj->ADDR));
+    mpu6050_i2cSlv4RegReadReg(dev, &(obj->REG));
+    mpu6050_i2cSlv4CtrlReadReg(dev, &(obj->CTRL));
+    mpu6050_i2cSlv4DoReadReg(dev, &(obj->DO));
+    mpu6050_i2cSlv4DiReadReg(dev, &(obj->DI));
 }
 
 /**
  *  \brief Write to I2C Slave 4 register
  *  
+ *  \param [in] dev Device handle
  *  \param [in] obj Datatype pointer to return register values
  *  
  *  \details Write all registers with one function call
  */
-void mpu6050_i2cSlv4WriteReg(tMPU6050_I2C_SLV4 *obj)
+void mpu6050_i2cSlv4WriteReg(tMPU6050_DEV *dev, tMPU6050_I2C_SLV4 *obj)
 {
-    mpu6050_i2cSlv4AddrWriteReg(&(obj->ADDR));
-    mpu6050_i2cSlv4RegWriteReg(&(obj->REG));
-    mpu6050_i2cSlv4CtrlWriteReg(&(obj->CTRL));
-    mpu6050_i2cSlv4DoWriteReg(&(obj->DO));
-    mpu6050_i2cSlv4DiWriteReg(&(obj->DI));
+    tMPU6050_BATCH batch;
+
+    // ADDR, REG, DO and CTRL are adjacent: one burst write
+    mpu6050_batchBegin(dev, &batch);
+    mpu6050_i2cSlv4AddrWriteReg(dev, &(obj->ADDR));
+    mpu6050_i2cSlv4RegWriteReg(dev, &(obj->REG));
+    mpu6050_i2cSlv4CtrlWriteReg(dev, &(obj->CTRL));
+    mpu6050_i2cSlv4DoWriteReg(dev, &(obj->DO));
+    mpu6050_i2cSlv4DiWriteReg(dev, &(obj->DI));
+    mpu6050_batchCommit(dev);
 }
\ No newline at end of file
@@ -26,20 +26,24 @@
 
 #include <stdint.h>
 #include <stdbool.h>
-#include "i2c.h"
-#include "mpu6050_reg.h"
+#include "mpu6050_transport.h"
 
 /**
  *  \brief Datatype for I2C Slave 4 ADDR register
  */
-typedef struct
+typedef union
 {
-    /** When set to 1, this bit configures the data transfer as a read operation.
-     * When cleared to 0, this bit configures the data transfer as a write operation. */
-    bool I2C_SLV4_RW;
+    uint8_t RAW;                /**< Register value */
+
+    struct
+    {
+        /** I2C address of slave 3 */
+        unsigned char I2C_SLV4_ADDR : 7;
 
-    /** I2C address of slave 3 */
-    unsigned char I2C_SLV4_ADDR: 7;
+        /** When set to 1, this bit configures the data transfer as a read operation.
+         * When cleared to 0, this bit configures the data transfer as a write operation. */
+        bool I2C_SLV4_RW : 1;
+    };
 }
 tMPU6050_I2C_SLV4_ADDR;
 
@@ -56,22 +60,27 @@ typedef unsigned char tMPU6050_I2C_SLV4_DI;
 /**
  *  \brief Datatype for I2C Slave 4 CTRL register
  */
-typedef struct
+typedef union
 {
-    /** When set to 1, this bit enables Slave 4 for data transfer operations. */
-    bool I2C_SLV4_EN;
+    uint8_t RAW;                /**< Register value */
 
-    /** When set to 1, this bit enables the generation of an interrupt signal upon
-     * completion of a Slave 4 transaction. */
-    bool I2C_SLV4_INT_EN;
+    struct
+    {
+        /** Configures the decreased access rate of slave devices relative to the
+         * Sample Rate. */
+        unsigned char I2C_MST_DLY : 5;
 
-    /** When set to 1, the transaction will read or write data.
-     * When cleared to 0, the transaction will read or write a register address. */
-    bool I2C_SLV4_REG_DIS;
+        /** When set to 1, the transaction will read or write data.
+         * When cleared to 0, the transaction will read or write a register address. */
+        bool I2C_SLV4_REG_DIS : 1;
 
-    /** Configures the decreased access rate of slave devices relative to the
-     * Sample Rate. */
-    unsigned char I2C_MST_DLY: 5;
+        /** When set to 1, this bit enables the generation of an interrupt signal upon
+         * completion of a Slave 4 transaction. */
+        bool I2C_SLV4_INT_EN : 1;
+
+        /** When set to 1, this bit enables Slave 4 for data transfer operations. */
+        bool I2C_SLV4_EN : 1;
+    };
 }
 tMPU6050_I2C_SLV4_CTRL;
 
@@ -90,19 +99,22 @@ typedef struct
 }
 tMPU6050_I2C_SLV4;
 
-extern void mpu6050_i2cSlv4AddrReadReg(tMPU6050_I2C_SLV4_ADDR*);
-extern void mpu6050_i2cSlv4AddrWriteReg(tMPU6050_I2C_SLV4_ADDR*);
+extern void mpu6050_i2cSlv4AddrReadReg(tMPU6050_DEV*, tMPU6050_I2C_SLV4_ADDR*);
+extern void mpu6050_i2cSlv4AddrWriteReg(tMPU6050_DEV*, tMPU6050_I2C_SLV4_ADDR*);
+
+extern void mpu6050_i2cSlv4RegReadReg(tMPU6050_DEV*, tMPU6050_I2C_SLV4_REG*);
+extern void mpu6050_i2cSlv4RegWriteReg(tMPU6050_DEV*, tMPU6050_I2C_SLV4_REG*);
 
-extern void mpu6050_i2cSlv4RegReadReg(tMPU6050_I2C_SLV4_REG*);
-extern void mpu6050_i2cSlv4RegWriteReg(tMPU6050_I2C_SLV4_REG*);
+extern void mpu6050_i2cSlv4CtrlReadReg(tMPU6050_DEV*, tMPU6050_I2C_SLV4_CTRL*);
+extern void mpu6050_i2cSlv4CtrlWriteReg(tMPU6050_DEV*, tMPU6050_I2C_SLV4_CTRL*);
 
-extern void mpu6050_i2cSlv4CtrlReadReg(tMPU6050_I2C_SLV4_CTRL*);
-extern void mpu6050_i2cSlv4CtrlWriteReg(tMPU6050_I2C_SLV4_CTRL*);
+extern void mpu6050_i2cSlv4DoReadReg(tMPU6050_DEV*, tMPU6050_I2C_SLV4_DO*);
+extern void mpu6050_i2cSlv4DoWriteReg(tMPU6050_DEV*, tMPU6050_I2C_SLV4_DO*);
 
-extern void mpu6050_i2cSlv4DoReadReg(tMPU6050_I2C_SLV4_DO*);
-extern void mpu6050_i2cSlv4DoWriteReg(tMPU6050_I2C_SLV4_DO*);
+extern void mpu6050_i2cSlv4DiReadReg(tMPU6050_DEV*, tMPU6050_I2C_SLV4_DI*);
+extern void mpu6050_i2cSlv4DiWriteReg(tMPU6050_DEV*, tMPU6050_I2C_SLV4_DI*);
 
-extern void mpu6050_i2cSlv4ReadReg(tMPU6050_I2C_SLV4*);
-extern void mpu6050_i2cSlv4WriteReg(tMPU6050_I2C_SLV4*);
+extern void mpu6050_i2cSlv4ReadReg(tMPU6050_DEV*, tMPU6050_I2C_SLV4*);
+extern void mpu6050_i2cSlv4WriteReg(tMPU6050_DEV*, tMPU6050_I2C_SLV4*);
 
 #endif
\ No newline at end of file
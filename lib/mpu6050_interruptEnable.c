@@ -28,34 +28,31 @@
  *  \copyright Copyright 2021 Jean-Marcel Herzog. All rights reserved. This project is released under the GNU Public License.
  */
 
+#include "mpu6050_registerCodec.h"
 #include "mpu6050_interruptEnable.h"
 
 /**
  *  \brief Read Interrupt Enable register
  *  
+ *  \param [in] dev Device handle
  *  \param [in] obj Datatype pointer to return register values
  *  
  *  \details See register datasheet chapter 4.15 for more details.
  */
-void mpu6050_intEnableReadReg(tMPU6050_INT_ENABLE *obj)
+void mpu6050_intEnableReadReg(tMPU6050_DEV *dev, tMPU6050_INT_ENABLE *obj)
 {
-    uint8_t reg = i2c_receive(MPU6050_I2C_ADDR, MPU6050_INT_ENABLE);
-    obj->FIFO_OFLOW_EN = (reg >> 4) & 0x01;
-    obj->I2C_MST_INT_EN = (reg >> 3) & 0x01;
-    obj->DATA_RDY_EN = reg & 0x01;
+    mpu6050_regRead(dev, MPU6050_CODEC_INT_ENABLE, obj);
 }
 
 /**
  *  \brief Write to Interrupt Enable register
  *  
+ *  \param [in] dev Device handle
  *  \param [in] obj Datatype pointer to return register values
  *  
  *  \details See register datasheet chapter 4.15 for more details.
  */
-void mpu6050_intEnableWriteReg(tMPU6050_INT_ENABLE *obj)
+void mpu6050_intEnableWriteReg(tMPU6050_DEV *dev, tMPU6050_INT_ENABLE *obj)
 {
-    uint8_t reg = obj->FIFO_OFLOW_EN << 4;
-    reg |= obj->I2C_MST_INT_EN << 3;
-    reg |= obj->DATA_RDY_EN;
-    i2c_write(MPU6050_I2C_ADDR, MPU6050_INT_ENABLE, reg);
+    mpu6050_regWrite(dev, MPU6050_CODEC_INT_ENABLE, obj);
 }
\ No newline at end of file
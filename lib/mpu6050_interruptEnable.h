@@ -26,28 +26,34 @@
 
 #include <stdint.h>
 #include <stdbool.h>
-#include "i2c.h"
-#include "mpu6050_reg.h"
+#include "mpu6050_transport.h"
 
 /**
  *  \brief Datatype for Interrupt Enable register
  */
-typedef struct
+typedef union
 {
-    /** When set to 1, this bit enables a FIFO buffer overflow to generate an interrupt. */
-    bool FIFO_OFLOW_EN;
+    uint8_t RAW;                /**< Register value */
 
-    /** When set to 1, this bit enables any of the I2C Master interrupt sources to
-     * generate an interrupt. */
-    bool I2C_MST_INT_EN;
+    struct
+    {
+        /** When set to 1, this bit enables the Data Ready interrupt, which occurs each time
+         * a write operation to all of the sensor registers has been completed. */
+        bool DATA_RDY_EN : 1;
+        unsigned char : 2;
 
-    /** When set to 1, this bit enables the Data Ready interrupt, which occurs each time
-     * a write operation to all of the sensor registers has been completed. */
-    bool DATA_RDY_EN;
+        /** When set to 1, this bit enables any of the I2C Master interrupt sources to
+         * generate an interrupt. */
+        bool I2C_MST_INT_EN : 1;
+
+        /** When set to 1, this bit enables a FIFO buffer overflow to generate an interrupt. */
+        bool FIFO_OFLOW_EN : 1;
+        unsigned char : 3;
+    };
 }
 tMPU6050_INT_ENABLE;
 
-extern void mpu6050_intEnableReadReg(tMPU6050_INT_ENABLE*);
-extern void mpu6050_intEnableWriteReg(tMPU6050_INT_ENABLE*);
+extern void mpu6050_intEnableReadReg(tMPU6050_DEV*, tMPU6050_INT_ENABLE*);
+extern void mpu6050_intEnableWriteReg(tMPU6050_DEV*, tMPU6050_INT_ENABLE*);
 
 #endif
\ No newline at end of file
@@ -29,34 +29,31 @@
  *  \copyright Copyright 2021 Jean-Marcel Herzog. All rights reserved. This project is released under the GNU Public License.
  */
 
+#include "mpu6050_registerCodec.h"
 #include "mpu6050_interruptStatus.h"
 
 /**
  *  \brief Read Interrupt Status register
  *  
+ *  \param [in] dev Device handle
  *  \param [in] obj Datatype pointer to return register values
  *  
  *  \details See register datasheet chapter 4.16 for more details.
  */
-void mpu6050_intStatusReadReg(tMPU6050_INT_STATUS *obj)
+void mpu6050_intStatusReadReg(tMPU6050_DEV *dev, tMPU6050_INT_STATUS *obj)
 {
-    uint8_t reg = i2c_receive(MPU6050_I2C_ADDR, MPU6050_INT_STATUS);
-    obj->FIFO_OFLOW_INT = reg >> 4;
-    obj->I2C_MST_INT = (reg >> 3) & 0x01;
-    obj->DATA_RDY_INT = reg & 0x01;
+    mpu6050_regRead(dev, MPU6050_CODEC_INT_STATUS, obj);
 }
 
 /**
  *  \brief Write to Interrupt Status register
  *  
+ *  \param [in] dev Device handle
  *  \param [in] obj Datatype pointer to return register values
  *  
  *  \details See register datasheet chapter 4.16 for more details.
  */
-void mpu6050_intStatusWriteReg(tMPU6050_INT_STATUS *obj)
+void mpu6050_intStatusWriteReg(tMPU6050_DEV *dev, tMPU6050_INT_STATUS *obj)
 {
-    uint8_t reg = (uint8_t)(obj->FIFO_OFLOW_INT << 4);
-    reg |= (uint8_t)(obj->I2C_MST_INT << 3);
-    reg |= (uint8_t)(obj->DATA_RDY_INT);
-    i2c_write(MPU6050_I2C_ADDR, MPU6050_INT_STATUS, reg);
+    mpu6050_regWrite(dev, MPU6050_CODEC_INT_STATUS, obj);
 }
\ No newline at end of file
@@ -26,30 +26,37 @@
 
 #include <stdint.h>
 #include <stdbool.h>
-#include "i2c.h"
-#include "mpu6050_reg.h"
+#include "mpu6050_transport.h"
 
 /**
  *  \brief Datatype for Interrupt Status Register
  */
-typedef struct
+typedef union
 {
-    /** This bit automatically sets to 1 when a FIFO buffer overflow interrupt has
-     * been generated.
-     * The bit clears to 0 after the register has been read. */
-    bool FIFO_OFLOW_INT;
-
-    /** This bit automatically sets to 1 when an I2C Master interrupt has been
-     * generated. The bit clears to 0 after the register has been read.
-     * Note: Interrupt informations see Register 54. */
-    bool I2C_MST_INT;
-
-    /** This bit automatically sets to 1 when a Data Ready interrupt
-     * is generated. This bit clears to 0 after the register has been read. */
-    bool DATA_RDY_INT;
+    uint8_t RAW;                /**< Register value */
+
+    struct
+    {
+        /** This bit automatically sets to 1 when a Data Ready interrupt
+         * is generated. This bit clears to 0 after the register has been read. */
+        bool DATA_RDY_INT : 1;
+        unsigned char : 2;
+
+        /** This bit automatically sets to 1 when an I2C Master interrupt has been
+         * generated. The bit clears to 0 after the register has been read.
+         * Note: Interrupt informations see Register 54. */
+        bool I2C_MST_INT : 1;
+
+        /** This bit automatically sets to 1 when a FIFO buffer overflow interrupt has
+         * been generated.
+         * The bit clears to 0 after the register has been read. */
+        bool FIFO_OFLOW_INT : 1;
+        unsigned char : 3;
+    };
 }
 tMPU6050_INT_STATUS;
 
-extern void mpu6050_intStatusReadReg(tMPU6050_INT_STATUS*);
+extern void mpu6050_intStatusReadReg(tMPU6050_DEV*, tMPU6050_INT_STATUS*);
+extern void mpu6050_intStatusWriteReg(tMPU6050_DEV*, tMPU6050_INT_STATUS*);
 
 #endif
\ No newline at end of file
@@ -0,0 +1,73 @@
+/*
+ * This file is part of the MPU6050-Library distribution (https://github.com/jmherzog-de/MPU6050-Library).
+ * Copyright (c) 2021 Jean-Marcel Herzog.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ *  \file mpu6050_motionMeasurements.c
+ *  \brief Motion Measurements
+ *  
+ *  The accelerometer, temperature and gyroscope measurement registers
+ *  (register 59 to 72) are located at consecutive register addresses.
+ *  
+ *  The user-facing read register set duplicates the internal register set's
+ *  data values whenever the serial interface is idle. A burst read of all
+ *  14 registers in one bus transaction therefore returns the accelerometer,
+ *  temperature and gyroscope measurements from the same sampling instant.
+ *  
+ *  Reading the same data with single byte reads takes 14 bus transactions
+ *  and the values may belong to different sampling instants.
+ *  
+ *  \copyright Copyright 2021 Jean-Marcel Herzog. All rights reserved. This project is released under the GNU Public License.
+ */
+
+#include "mpu6050_motionMeasurements.h"
+
+/**
+ *  \brief Read accelerometer, temperature and gyroscope measurement
+ *  
+ *  \param [in] dev Device handle
+ *  \param [in] obj Datatype pointer to return register values
+ *  
+ *  \details Read register 59 to 72 with one burst read. See register datasheet
+ *  chapter 4.17 to 4.19 for more details.
+ */
+void mpu6050_motionReadBurst(tMPU6050_DEV *dev, tMPU6050_MOTION *obj)
+{
+    uint8_t buf[MPU6050_MOTION_BURST_LEN];
+
+    mpu6050_busReadBurst(dev, MPU6050_ACCEL_XOUT_H, buf, MPU6050_MOTION_BURST_LEN);
+    mpu6050_motionDecode(buf, obj);
+}
+
+/**
+ *  \brief Decode a burst of the measurement registers
+ *  
+ *  \param [in] pui8Data MPU6050_MOTION_BURST_LEN register bytes from ACCEL_XOUT_H
+ *  \param [in] obj Datatype pointer to return register values
+ *  
+ *  \details Used for bursts that were read asynchronously, e.g. by the
+ *  acquisition pipeline.
+ */
+void mpu6050_motionDecode(const uint8_t *pui8Data, tMPU6050_MOTION *obj)
+{
+    obj->ACCEL.X = (int16_t)(((uint16_t)pui8Data[0] << 8) | pui8Data[1]);
+    obj->ACCEL.Y = (int16_t)(((uint16_t)pui8Data[2] << 8) | pui8Data[3]);
+    obj->ACCEL.Z = (int16_t)(((uint16_t)pui8Data[4] << 8) | pui8Data[5]);
+    obj->TEMP = (int16_t)(((uint16_t)pui8Data[6] << 8) | pui8Data[7]);
+    obj->GYRO.X = (int16_t)(((uint16_t)pui8Data[8] << 8) | pui8Data[9]);
+    obj->GYRO.Y = (int16_t)(((uint16_t)pui8Data[10] << 8) | pui8Data[11]);
+    obj->GYRO.Z = (int16_t)(((uint16_t)pui8Data[12] << 8) | pui8Data[13]);
+}
@@ -0,0 +1,51 @@
+/*
+ * This file is part of the MPU6050-Library distribution (https://github.com/jmherzog-de/MPU6050-Library).
+ * Copyright (c) 2021 Jean-Marcel Herzog.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ *  \file mpu6050_motionMeasurements.h
+ *  \brief Motion Measurements headerfile
+ *  \copyright Copyright 2021 Jean-Marcel Herzog. All rights reserved. This project is released under the GNU Public License.
+ */
+
+#ifndef MPU6050_MOTIONMEASUREMENTS_H_
+#define MPU6050_MOTIONMEASUREMENTS_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "mpu6050_transport.h"
+#include "mpu6050_accelerometerMeasurements.h"
+#include "mpu6050_temperatureMeasurements.h"
+#include "mpu6050_gyroscopeMeasurements.h"
+
+/** Number of bytes from ACCEL_XOUT_H (register 59) to GYRO_ZOUT_L (register 72) */
+#define MPU6050_MOTION_BURST_LEN    14
+
+/**
+ *  \brief Datatype for one complete sample of accelerometer, temperature and gyroscope
+ */
+typedef struct
+{
+    tMPU6050_ACCEL ACCEL;   /**< Accelerometer measurement of all axis */
+    tMPU6050_TEMP TEMP;     /**< Temperature measurement */
+    tMPU6050_GYRO GYRO;     /**< Gyroscope measurement of all axis */
+}
+tMPU6050_MOTION;
+
+extern void mpu6050_motionReadBurst(tMPU6050_DEV*, tMPU6050_MOTION*);
+extern void mpu6050_motionDecode(const uint8_t*, tMPU6050_MOTION*);
+
+#endif
@@ -0,0 +1,209 @@
+/*
+ * This file is part of the MPU6050-Library distribution (https://github.com/jmherzog-de/MPU6050-Library).
+ * Copyright (c) 2021 Jean-Marcel Herzog.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ *  \file mpu6050_outputRate.c
+ *  \brief Output Data Rate Planner
+ *  
+ *  Finds DLPF_CFG (register 26) and SMPLRT_DIV (register 25) for a
+ *  requested Sample Rate and anti-alias bandwidth:
+ *  
+ *  Sample Rate = Gyroscope Output Rate / (1 + SMPLRT_DIV)
+ *  
+ *  with a Gyroscope Output Rate of 8kHz for DLPF_CFG = 0 and 1kHz otherwise.
+ *  A narrower DLPF suppresses more aliasing but delays the signal more, so
+ *  the planner walks the DLPF settings from the widest to the narrowest and
+ *  takes the first one that
+ *  
+ *  - does not pass more than the requested bandwidth and
+ *  - passes at most half of the resulting Sample Rate (Nyquist).
+ *  
+ *  The divider gives the lowest Sample Rate not below the requested rate,
+ *  so no bus bandwidth is spent on samples nobody asked for.
+ *  
+ *  |	DLPF_CFG	|	Acc. Bandwidth (Hz)	|	Acc. Delay (ms)	|	Gyro. Bandwidth (Hz)	|	Gyro. Delay (ms)	|
+ *  |:-------------:|:---------------------:|:-----------------:|:-------------------------:|:---------------------:|
+ *  |		0		|			260			|		0			|			256				|		0.98			|
+ *  |		1		|			184			|		2.0			|			188				|		1.9				|
+ *  |		2		|			94			|		3.0			|			98				|		2.8				|
+ *  |		3		|			44			|		4.9			|			42				|		4.8				|
+ *  |		4		|			21			|		8.5			|			20				|		8.3				|
+ *  |		5		|			10			|		13.8		|			10				|		13.4			|
+ *  |		6		|			5			|		19.0		|			5				|		18.6			|
+ *  
+ *  \note The accelerometer output rate is 1kHz. Above 1kHz the same
+ *  accelerometer sample is output more than once.
+ *  
+ *  \copyright Copyright 2021 Jean-Marcel Herzog. All rights reserved. This project is released under the GNU Public License.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "mpu6050_transport.h"
+#include "mpu6050_shadowRegisters.h"
+#include "mpu6050_sampleRateDivider.h"
+#include "mpu6050_outputRate.h"
+
+/** Number of usable DLPF settings (DLPF_CFG 7 is reserved) */
+#define MPU6050_DLPF_SETTINGS   7
+
+/**
+ *  \brief Characteristics of one DLPF setting
+ */
+typedef struct
+{
+    uint16_t ACCEL_BANDWIDTH_HZ;
+    uint16_t GYRO_BANDWIDTH_HZ;
+    uint16_t ACCEL_DELAY_US;
+    uint16_t GYRO_DELAY_US;
+}
+tMPU6050_DLPF;
+
+static const tMPU6050_DLPF dlpfTable[MPU6050_DLPF_SETTINGS] =
+{
+    { 260, 256,     0,   980 },
+    { 184, 188,  2000,  1900 },
+    {  94,  98,  3000,  2800 },
+    {  44,  42,  4900,  4800 },
+    {  21,  20,  8500,  8300 },
+    {  10,  10, 13800, 13400 },
+    {   5,   5, 19000, 18600 }
+};
+
+/**
+ *  \brief Fill a plan for a DLPF setting and divider
+ */
+static void mpu6050_odrFill(uint8_t ui8DlpfCfg, uint8_t ui8Div, tMPU6050_ODR_PLAN *plan)
+{
+    const tMPU6050_DLPF *dlpf = &dlpfTable[ui8DlpfCfg < MPU6050_DLPF_SETTINGS ? ui8DlpfCfg : 0];
+    uint32_t gyroPeriodNs = (ui8DlpfCfg == 0 || ui8DlpfCfg == 7) ? 125000 : 1000000;
+
+    plan->DLPF_CFG = ui8DlpfCfg;
+    plan->SMPLRT_DIV = ui8Div;
+    plan->PERIOD_NS = gyroPeriodNs * (1u + ui8Div);
+    plan->RATE_HZ = 1e9f / plan->PERIOD_NS;
+    plan->ACCEL_BANDWIDTH_HZ = dlpf->ACCEL_BANDWIDTH_HZ;
+    plan->GYRO_BANDWIDTH_HZ = dlpf->GYRO_BANDWIDTH_HZ;
+    plan->ACCEL_DELAY_US = dlpf->ACCEL_DELAY_US;
+    plan->GYRO_DELAY_US = dlpf->GYRO_DELAY_US;
+}
+
+/**
+ *  \brief Divider for the lowest rate not below the request
+ */
+static uint8_t mpu6050_odrDivider(uint8_t ui8DlpfCfg, uint16_t ui16RateHz)
+{
+    uint32_t div = ((ui8DlpfCfg == 0) ? 8000 : 1000) / ui16RateHz;
+
+    div = div ? div - 1 : 0;
+    return div > 255 ? 255 : (uint8_t)div;
+}
+
+/**
+ *  \brief Plan Sample Rate and DLPF setting
+ *  
+ *  \param [in] ui16RateHz Requested Sample Rate
+ *  \param [in] ui16BandwidthHz Highest frequency the DLPF may pass
+ *  \param [in] plan Datatype pointer to return the plan
+ *  \return true if the plan meets both requests
+ *  
+ *  \details The plan has the lowest group delay of all settings that meet
+ *  the requests. If no setting does (rate above the gyroscope output rate of
+ *  the setting, bandwidth below 5Hz or rate below twice the bandwidth of the
+ *  narrowest DLPF) the plan uses the widest DLPF within the requested
+ *  bandwidth that still passes less than half of the rate it achieves, with
+ *  the divider chosen as above. Only if there is none either, it uses the
+ *  narrowest DLPF, DLPF_CFG 6.
+ */
+bool mpu6050_odrPlan(uint16_t ui16RateHz, uint16_t ui16BandwidthHz, tMPU6050_ODR_PLAN *plan)
+{
+    uint8_t cfg, fallback = MPU6050_DLPF_SETTINGS - 1;
+    bool found = false;
+
+    if(ui16RateHz == 0)
+        ui16RateHz = 1;
+
+    for(cfg = 0; cfg < MPU6050_DLPF_SETTINGS; cfg++)
+    {
+        const tMPU6050_DLPF *dlpf = &dlpfTable[cfg];
+        uint16_t bandwidth = dlpf->ACCEL_BANDWIDTH_HZ > dlpf->GYRO_BANDWIDTH_HZ ?
+                             dlpf->ACCEL_BANDWIDTH_HZ : dlpf->GYRO_BANDWIDTH_HZ;
+        uint32_t gyroRate = (cfg == 0) ? 8000 : 1000;
+        uint32_t div = mpu6050_odrDivider(cfg, ui16RateHz);
+
+        if(bandwidth > ui16BandwidthHz || 2u * bandwidth * (div + 1) > gyroRate)
+            continue;
+
+        if((uint32_t)ui16RateHz * (div + 1) <= gyroRate)
+        {
+            mpu6050_odrFill(cfg, (uint8_t)div, plan);
+            return true;
+        }
+
+        // rate not reached: the widest setting free of aliasing is the fallback
+        if(!found)
+            fallback = cfg;
+        found = true;
+    }
+
+    // no setting meets the requests: suppress aliasing as far as possible
+    mpu6050_odrFill(fallback, mpu6050_odrDivider(fallback, ui16RateHz), plan);
+    return false;
+}
+
+/**
+ *  \brief Plan and write Sample Rate and DLPF setting
+ *  
+ *  \param [in] dev Device handle
+ *  \param [in] ui16RateHz Requested Sample Rate
+ *  \param [in] ui16BandwidthHz Highest frequency the DLPF may pass
+ *  \param [in] plan Datatype pointer to return the plan, may be 0
+ *  \return true if the plan meets both requests
+ *  
+ *  \details See mpu6050_odrPlan(). EXT_SYNC_SET is kept, registers are only
+ *  written if they change. Update drain schedulers and timestamp
+ *  reconstructions of the device afterwards.
+ */
+bool mpu6050_odrApply(tMPU6050_DEV *dev, uint16_t ui16RateHz, uint16_t ui16BandwidthHz, tMPU6050_ODR_PLAN *plan)
+{
+    tMPU6050_ODR_PLAN local;
+    bool met;
+
+    if(!plan)
+        plan = &local;
+
+    met = mpu6050_odrPlan(ui16RateHz, ui16BandwidthHz, plan);
+    mpu6050_shadowFieldWrite(dev, MPU6050_FIELD_DLPF_CFG, plan->DLPF_CFG);
+    mpu6050_shadowFieldWrite(dev, MPU6050_FIELD_SMPLRT_DIV, plan->SMPLRT_DIV);
+
+    return met;
+}
+
+/**
+ *  \brief Get the current Sample Rate and DLPF setting
+ *  
+ *  \param [in] dev Device handle
+ *  \param [in] plan Datatype pointer to return the setting
+ *  
+ *  \details Registers are taken from the shadow cache. The reserved
+ *  DLPF_CFG 7 is reported with the characteristics of DLPF_CFG 0.
+ */
+void mpu6050_odrGet(tMPU6050_DEV *dev, tMPU6050_ODR_PLAN *plan)
+{
+    mpu6050_odrFill(mpu6050_shadowFieldRead(dev, MPU6050_FIELD_DLPF_CFG),
+                    mpu6050_shadowFieldRead(dev, MPU6050_FIELD_SMPLRT_DIV), plan);
+}
@@ -0,0 +1,51 @@
+/*
+ * This file is part of the MPU6050-Library distribution (https://github.com/jmherzog-de/MPU6050-Library).
+ * Copyright (c) 2021 Jean-Marcel Herzog.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ *  \file mpu6050_outputRate.h
+ *  \brief Output Data Rate Planner headerfile
+ *  \copyright Copyright 2021 Jean-Marcel Herzog. All rights reserved. This project is released under the GNU Public License.
+ */
+
+#ifndef MPU6050_OUTPUTRATE_H_
+#define MPU6050_OUTPUTRATE_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "mpu6050_transport.h"
+
+/**
+ *  \brief Sample Rate and DLPF setting with its characteristics
+ */
+typedef struct
+{
+    uint8_t DLPF_CFG;               /**< DLPF_CFG of the Configuration register */
+    uint8_t SMPLRT_DIV;             /**< Sample Rate Divider */
+    uint32_t PERIOD_NS;             /**< Sample period */
+    float RATE_HZ;                  /**< Sample Rate */
+    uint16_t ACCEL_BANDWIDTH_HZ;    /**< Accelerometer bandwidth */
+    uint16_t GYRO_BANDWIDTH_HZ;     /**< Gyroscope bandwidth */
+    uint16_t ACCEL_DELAY_US;        /**< Accelerometer group delay */
+    uint16_t GYRO_DELAY_US;         /**< Gyroscope group delay */
+}
+tMPU6050_ODR_PLAN;
+
+extern bool mpu6050_odrPlan(uint16_t ui16RateHz, uint16_t ui16BandwidthHz, tMPU6050_ODR_PLAN *plan);
+extern bool mpu6050_odrApply(tMPU6050_DEV*, uint16_t ui16RateHz, uint16_t ui16BandwidthHz, tMPU6050_ODR_PLAN *plan);
+extern void mpu6050_odrGet(tMPU6050_DEV*, tMPU6050_ODR_PLAN *plan);
+
+#endif
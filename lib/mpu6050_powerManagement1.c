@@ -56,38 +56,31 @@
  *  \copyright Copyright 2021 Jean-Marcel Herzog. All rights reserved. This project is released under the GNU Public License.
  */
 
+#include "mpu6050_registerCodec.h"
 #include "mpu6050_powerManagement1.h"
 
 /**
  *  \brief Read Power Management 1 register
  *  
+ *  \param [in] dev Device handle
  *  \param [in] obj Datatype pointer to return register values
  *  
  *  \details See register datasheet chapter 4.28 for more details.
  */
-void mpu6050_pwrMgmt1ReadReg(tMPU6050_PWR_MGMT_1 *obj)
+void mpu6050_pwrMgmt1ReadReg(tMPU6050_DEV *dev, tMPU6050_PWR_MGMT_1 *obj)
 {
-    uint8_t reg = i2c_receive(MPU6050_I2C_ADDR, MPU6050_PWR_MGMT_1);
-    obj->DEVICE_RESET = (reg >> 7) & 0x01;
-    obj->SLEEP = (reg >> 6) & 0x01;
-    obj->CYCLE = (reg >> 5) & 0x01;
-    obj->TEMP_DIS = (reg >> 3) & 0x01;
-    obj->CLKSEL = reg & 0x07;
+    mpu6050_regRead(dev, MPU6050_CODEC_PWR_MGMT_1, obj);
 }
 
 /**
  *  \brief Write to Power Management 1 register
  *  
+ *  \param [in] dev Device handle
  *  \param [in] obj Datatype pointer to return register values
  *  
  *  \details See register datasheet chapter 4.28 for more details.
  */
-void mpu6050_pwrMgmt1WriteReg(tMPU6050_PWR_MGMT_1 *obj)
+void mpu6050_pwrMgmt1WriteReg(tMPU6050_DEV *dev, tMPU6050_PWR_MGMT_1 *obj)
 {
-    uint8_t reg = (uint8_t)(obj->DEVICE_RESET) << 7;
-    reg |= (uint8_t)(obj->SLEEP) << 6;
-    reg |= (uint8_t)(obj->CYCLE) << 5;
-    reg |= (uint8_t)(obj->TEMP_DIS) << 3;
-    reg |= (uint8_t)(obj->CLKSEL);
-    i2c_write(MPU6050_I2C_ADDR, MPU6050_PWR_MGMT_1, reg);
+    mpu6050_regWrite(dev, MPU6050_CODEC_PWR_MGMT_1, obj);
 }
\ No newline at end of file
@@ -26,8 +26,7 @@
 
 #include <stdint.h>
 #include <stdbool.h>
-#include "i2c.h"
-#include "mpu6050_reg.h"
+#include "mpu6050_transport.h"
 
 #define MPU6050_PWR_MGMT_1_INTERNAL_8MHz                            0x00
 #define MPU6050_PWR_MGMT_1_PLL_WITH_X_AXIS_GYRO_REFERENCE           0x01
@@ -41,29 +40,35 @@
 /**
  *  \brief Datatype for Power Management 1 register data
  */
-typedef struct
+typedef union
 {
-    /** When set to 1, this bit resets all internal registers to their default values.
-     * The bit automatically clears to 0 once the reset is done. */
-    bool DEVICE_RESET;
+    uint8_t RAW;                /**< Register value */
 
-    /** When set to 1, this bit puts the MPU6050 into sleep mode. */
-    bool SLEEP;
+    struct
+    {
+        /** 3-bit unsigned value. Specifies the clock source of the device. */
+        uint8_t CLKSEL : 3;
 
-    /** When this bit is set to 1 and SLEEP is disabled, the MPU6050 will cycle
-     * between sleep mode and waking up to take a single sample of data from
-     * active sensors at a rate determined by LP_WAKE_CTRL (Register 108). */
-    bool CYCLE;
+        /** When set to 1, this bit disables the temperature sensor. */
+        bool TEMP_DIS : 1;
+        unsigned char : 1;
 
-    /** When set to 1, this bit disables the temperature sensor. */
-    bool TEMP_DIS;
+        /** When this bit is set to 1 and SLEEP is disabled, the MPU6050 will cycle
+         * between sleep mode and waking up to take a single sample of data from
+         * active sensors at a rate determined by LP_WAKE_CTRL (Register 108). */
+        bool CYCLE : 1;
 
-    /** 3-bit unsigned value. Specifies the clock source of the device. */
-    uint8_t CLKSEL: 3;
+        /** When set to 1, this bit puts the MPU6050 into sleep mode. */
+        bool SLEEP : 1;
+
+        /** When set to 1, this bit resets all internal registers to their default values.
+         * The bit automatically clears to 0 once the reset is done. */
+        bool DEVICE_RESET : 1;
+    };
 }
 tMPU6050_PWR_MGMT_1;
 
-extern void mpu6050_pwrMgmt1ReadReg(tMPU6050_PWR_MGMT_1*);
-extern void mpu6050_pwrMgmt1WriteReg(tMPU6050_PWR_MGMT_1*);
+extern void mpu6050_pwrMgmt1ReadReg(tMPU6050_DEV*, tMPU6050_PWR_MGMT_1*);
+extern void mpu6050_pwrMgmt1WriteReg(tMPU6050_DEV*, tMPU6050_PWR_MGMT_1*);
 
 #endif
\ No newline at end of file
@@ -54,42 +54,31 @@
  *  \copyright Copyright 2021 Jean-Marcel Herzog. All rights reserved. This project is released under the GNU Public License.
  */
 
+#include "mpu6050_registerCodec.h"
 #include "mpu6050_powerManagement2.h"
 
 /**
  *  \brief Read Power Management 2 register
  *  
+ *  \param [in] dev Device handle
  *  \param [in] obj Datatype pointer to return register values
  *  
  *  \details See register datasheet chapter 4.29 for more details.
  */
-void mpu6050_pwr_mgmt_2_readReg(tMPU6050_PWR_MGMT_2 *obj)
+void mpu6050_pwrMgmt2ReadReg(tMPU6050_DEV *dev, tMPU6050_PWR_MGMT_2 *obj)
 {
-    uint8_t reg = i2c_receive(MPU6050_I2C_ADDR, MPU6050_PWR_MGMT_2);
-    obj->LP_WAKE_CTRL = (reg >> 6) & 0x02;
-    obj->STBY_XA = (reg >> 5) & 0x01;
-    obj->STBY_YA = (reg >> 4) & 0x01;
-    obj->STBY_ZA = (reg >> 3) & 0x01;
-    obj->STBY_XG = (reg >> 2) & 0x01;
-    obj->STBY_YG = (reg >> 1) & 0x01;
-    obj->STBY_ZG = reg & 0x01;
+    mpu6050_regRead(dev, MPU6050_CODEC_PWR_MGMT_2, obj);
 }
 
 /**
  *  \brief Write Power Management 2 register
  *  
+ *  \param [in] dev Device handle
  *  \param [in] obj Datatype pointer to register values
  *  
  *  \details See register datasheet chapter 4.29 for more details.
  */
-void mpu6050_pwr_mgmt_2_writeReg(tMPU6050_PWR_MGMT_2 *obj)
+void mpu6050_pwrMgmt2WriteReg(tMPU6050_DEV *dev, tMPU6050_PWR_MGMT_2 *obj)
 {
-    uint8_t reg = (uint8_t)(obj->LP_WAKE_CTRL) << 6;
-    reg |= (uint8_t)(obj->STBY_XA) << 5;
-    reg |= (uint8_t)(obj->STBY_YA) << 4;
-    reg |= (uint8_t)(obj->STBY_ZA) << 3;
-    reg |= (uint8_t)(obj->STBY_XG) << 2;
-    reg |= (uint8_t)(obj->STBY_YG) << 1;
-    reg |= (uint8_t)(obj->STBY_ZG);
-    i2c_write(MPU6050_I2C_ADDR, MPU6050_PWR_MGMT_2, reg);
+    mpu6050_regWrite(dev, MPU6050_CODEC_PWR_MGMT_2, obj);
 }
\ No newline at end of file
@@ -20,8 +20,7 @@
 
 #include <stdint.h>
 #include <stdbool.h>
-#include "i2c.h"
-#include "mpu6050_reg.h"
+#include "mpu6050_transport.h"
 
 #define MPU6050_PWR_MGMT_2_WAKE_UP_FREQ_1_25Hz      0x00
 #define MPU6050_PWR_MGMT_2_WAKE_UP_FREQ_5Hz         0x01
@@ -31,32 +30,37 @@
 /**
  *  \brief Datatype for Power Management 2 register data
  */
-typedef struct
+typedef union
 {
-    /** Specifies the frequency of wake-ups during Accelerometer Only Low Power Mode. */
-    uint8_t LP_WAKE_CTRL: 2;
+    uint8_t RAW;                /**< Register value */
 
-    /** When set to 1, this bit puts the X axis accelerometer in standby mode. */
-    bool STBY_XA;
+    struct
+    {
+        /** When set to 1, this bit puts the Z axis gyroscope into standby mode. */
+        bool STBY_ZG : 1;
 
-    /** When set to 1, this bit puts the Y axis accelerometer into standby mode. */
-    bool STBY_YA;
+        /** When set to 1, this bit puts the Y axis gyroscope into standby mode. */
+        bool STBY_YG : 1;
 
-    /** When set to 1, this bit puts the Z axis accelerometer into standby mode. */
-    bool STBY_ZA;
+        /** When set to 1, this bit puts the X axis gyroscope into standby mode. */
+        bool STBY_XG : 1;
 
-    /** When set to 1, this bit puts the X axis gyroscope into standby mode. */
-    bool STBY_XG;
+        /** When set to 1, this bit puts the Z axis accelerometer into standby mode. */
+        bool STBY_ZA : 1;
 
-    /** When set to 1, this bit puts the Y axis gyroscope into standby mode. */
-    bool STBY_YG;
+        /** When set to 1, this bit puts the Y axis accelerometer into standby mode. */
+        bool STBY_YA : 1;
 
-    /** When set to 1, this bit puts the Z axis gyroscope into standby mode. */
-    bool STBY_ZG;
+        /** When set to 1, this bit puts the X axis accelerometer in standby mode. */
+        bool STBY_XA : 1;
+
+        /** Specifies the frequency of wake-ups during Accelerometer Only Low Power Mode. */
+        uint8_t LP_WAKE_CTRL : 2;
+    };
 }
 tMPU6050_PWR_MGMT_2;
 
-extern void mpu6050_pwrMgmt2ReadReg(tMPU6050_PWR_MGMT_2*);
-extern void mpu6050_pwrMgmt2WriteReg(tMPU6050_PWR_MGMT_2*);
+extern void mpu6050_pwrMgmt2ReadReg(tMPU6050_DEV*, tMPU6050_PWR_MGMT_2*);
+extern void mpu6050_pwrMgmt2WriteReg(tMPU6050_DEV*, tMPU6050_PWR_MGMT_2*);
 
 #endif
\ No newline at end of file
@@ -28,6 +28,7 @@
 #define MPU6050_REG_H_
 
 #define MPU6050_I2C_ADDR 0x68
+#define MPU6050_I2C_ADDR_ALT 0x69
 
 #define MPU6050_SELF_TEST_X             0x0D
 #define MPU6050_SELF_TEST_Y             0x0E
@@ -0,0 +1,410 @@
+/*
+ * This file is part of the MPU6050-Library distribution (https://github.com/jmherzog-de/MPU6050-Library).
+ * Copyright (c) 2021 Jean-Marcel Herzog.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+/**
+ *  \file mpu6050_registerCodec.c
+ *  \brief Register Codec
+ *  
+ *  mpu6050_registerMap is the only place where the bit layout of the
+ *  registers is written down. Every register datatype of the library is
+ *  described by its address, the number of adjacent registers and the
+ *  position and width of each field. mpu6050_regDecode() and
+ *  mpu6050_regEncode() convert between register bytes and datatypes with
+ *  the same loop for every register, so a layout error can only be made in
+ *  the table, where each field is one line with the datasheet bit numbers.
+ *  
+ *  Datatypes of single registers are unions of the register value (RAW)
+ *  and a bit field structure with the same layout, so a field is both
+ *  stored and accessed in place. Their FIELD() entries decode into the same
+ *  bit position, i.e. the codec only masks the reserved bits. The bit field
+ *  structures are declared from bit 0 upwards, which is the allocation
+ *  order of GCC and the ARM EABI; bench/bench_codec.c checks that they
+ *  match the table. SELF_TEST spreads its fields over four registers and
+ *  keeps one byte per field.
+ *  
+ *  \copyright Copyright 2021 Jean-Marcel Herzog. All rights reserved. This project is released under the GNU Public License.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <string.h>
+#include "mpu6050_reg.h"
+#include "mpu6050_transport.h"
+#include "mpu6050_selfTest.h"
+#include "mpu6050_configuration.h"
+#include "mpu6050_gyroscopeConfiguration.h"
+#include "mpu6050_accelerometerConfiguration.h"
+#include "mpu6050_fifoEnable.h"
+#include "mpu6050_i2cMasterControl.h"
+#include "mpu6050_i2cSlave0Control.h"
+#include "mpu6050_i2cSlave1Control.h"
+#include "mpu6050_i2cSlave2Control.h"
+#include "mpu6050_i2cSlave3Control.h"
+#include "mpu6050_i2cSlave4Control.h"
+#include "mpu6050_i2cMasterStatus.h"
+#include "mpu6050_bypassEnableConfiguration.h"
+#include "mpu6050_interruptEnable.h"
+#include "mpu6050_interruptStatus.h"
+#include "mpu6050_i2cMasterDelayControl.h"
+#include "mpu6050_signalPathReset.h"
+#include "mpu6050_userControl.h"
+#include "mpu6050_powerManagement1.h"
+#include "mpu6050_powerManagement2.h"
+#include "mpu6050_registerCodec.h"
+
+/** Bit field of a single register datatype: member, bit position, width */
+#define FIELD(type, member, shift, width) \
+    { 0, 0, shift, width, shift }
+
+/** Part of a field split across registers: register index, member, bit position, width, member bit position */
+#define FIELD_PART(reg, type, member, shift, width, pos) \
+    { reg, offsetof(type, member), shift, width, pos }
+
+/** Register description table entry */
+#define REGISTER(addr, span, type, fields) \
+    { addr, span, sizeof(type), sizeof(fields) / sizeof(fields[0]), fields }
+
+static const tMPU6050_FIELD_DESC selfTest[] =
+{
+    FIELD_PART(0, tMPU6050_SELF_TEST, XA_TEST, 5, 3, 2),
+    FIELD_PART(0, tMPU6050_SELF_TEST, XG_TEST, 0, 5, 0),
+    FIELD_PART(1, tMPU6050_SELF_TEST, YA_TEST, 5, 3, 2),
+    FIELD_PART(1, tMPU6050_SELF_TEST, YG_TEST, 0, 5, 0),
+    FIELD_PART(2, tMPU6050_SELF_TEST, ZA_TEST, 5, 3, 2),
+    FIELD_PART(2, tMPU6050_SELF_TEST, ZG_TEST, 0, 5, 0),
+    FIELD_PART(3, tMPU6050_SELF_TEST, XA_TEST, 4, 2, 0),
+    FIELD_PART(3, tMPU6050_SELF_TEST, YA_TEST, 2, 2, 0),
+    FIELD_PART(3, tMPU6050_SELF_TEST, ZA_TEST, 0, 2, 0),
+};
+
+static const tMPU6050_FIELD_DESC config[] =
+{
+    FIELD(tMPU6050_CONFIG, EXT_SYNC_SET, 3, 3),
+    FIELD(tMPU6050_CONFIG, DLPF_CFG, 0, 3),
+};
+
+static const tMPU6050_FIELD_DESC gyroConfig[] =
+{
+    FIELD(tMPU6050_GYRO_CONFIG, XG_ST, 7, 1),
+    FIELD(tMPU6050_GYRO_CONFIG, YG_ST, 6, 1),
+    FIELD(tMPU6050_GYRO_CONFIG, ZG_ST, 5, 1),
+    FIELD(tMPU6050_GYRO_CONFIG, FS_SEL, 3, 2),
+};
+
+static const tMPU6050_FIELD_DESC accelConfig[] =
+{
+    FIELD(tMPU6050_ACCEL_CONFIG, XA_ST, 7, 1),
+    FIELD(tMPU6050_ACCEL_CONFIG, YA_ST, 6, 1),
+    FIELD(tMPU6050_ACCEL_CONFIG, ZA_ST, 5, 1),
+    FIELD(tMPU6050_ACCEL_CONFIG, AFS_SEL, 3, 2),
+};
+
+static const tMPU6050_FIELD_DESC fifoEn[] =
+{
+    FIELD(tMPU6050_FIFO_EN, TEMP_FIFO_EN, 7, 1),
+    FIELD(tMPU6050_FIFO_EN, XG_FIFO_EN, 6, 1),
+    FIELD(tMPU6050_FIFO_EN, YG_FIFO_EN, 5, 1),
+    FIELD(tMPU6050_FIFO_EN, ZG_FIFO_EN, 4, 1),
+    FIELD(tMPU6050_FIFO_EN, ACCEL_FIFO_EN, 3, 1),
+    FIELD(tMPU6050_FIFO_EN, SLV2_FIFO_EN, 2, 1),
+    FIELD(tMPU6050_FIFO_EN, SLV1_FIFO_EN, 1, 1),
+    FIELD(tMPU6050_FIFO_EN, SLV0_FIFO_EN, 0, 1),
+};
+
+static const tMPU6050_FIELD_DESC i2cMstCtrl[] =
+{
+    FIELD(tMPU6050_I2C_MST_CTRL, MULTI_MST_EN, 7, 1),
+    FIELD(tMPU6050_I2C_MST_CTRL, WAIT_FOR_ES, 6, 1),
+    FIELD(tMPU6050_I2C_MST_CTRL, SLV_3_FIFO_EN, 5, 1),
+    FIELD(tMPU6050_I2C_MST_CTRL, I2C_MST_P_NSR, 4, 1),
+    FIELD(tMPU6050_I2C_MST_CTRL, I2C_MST_CLK, 0, 4),
+};
+
+static const tMPU6050_FIELD_DESC i2cSlv0Addr[] =
+{
+    FIELD(tMPU6050_I2C_SLV0_ADDR, I2C_SLV0_RW, 7, 1),
+    FIELD(tMPU6050_I2C_SLV0_ADDR, I2C_SLV0_ADDR, 0, 7),
+};
+
+static const tMPU6050_FIELD_DESC i2cSlv0Ctrl[] =
+{
+    FIELD(tMPU6050_I2C_SLV0_CTRL, I2C_SLV0_EN, 7, 1),
+    FIELD(tMPU6050_I2C_SLV0_CTRL, I2C_SLV0_BYTE_SW, 6, 1),
+    FIELD(tMPU6050_I2C_SLV0_CTRL, I2C_SLV0_REG_DIS, 5, 1),
+    FIELD(tMPU6050_I2C_SLV0_CTRL, I2C_SLV0_GRP, 4, 1),
+    FIELD(tMPU6050_I2C_SLV0_CTRL, I2C_SLV0_LEN, 0, 4),
+};
+
+static const tMPU6050_FIELD_DESC i2cSlv1Addr[] =
+{
+    FIELD(tMPU6050_I2C_SLV1_ADDR, I2C_SLV1_RW, 7, 1),
+    FIELD(tMPU6050_I2C_SLV1_ADDR, I2C_SLV1_ADDR, 0, 7),
+};
+
+static const tMPU6050_FIELD_DESC i2cSlv1Ctrl[] =
+{
+    FIELD(tMPU6050_I2C_SLV1_CTRL, I2C_SLV1_EN, 7, 1),
+    FIELD(tMPU6050_I2C_SLV1_CTRL, I2C_SLV1_BYTE_SW, 6, 1),
+    FIELD(tMPU6050_I2C_SLV1_CTRL, I2C_SLV1_REG_DIS, 5, 1),
+    FIELD(tMPU6050_I2C_SLV1_CTRL, I2C_SLV1_GRP, 4, 1),
+    FIELD(tMPU6050_I2C_SLV1_CTRL, I2C_SLV1_LEN, 0, 4),
+};
+
+static const tMPU6050_FIELD_DESC i2cSlv2Addr[] =
+{
+    FIELD(tMPU6050_I2C_SLV2_ADDR, I2C_SLV2_RW, 7, 1),
+    FIELD(tMPU6050_I2C_SLV2_ADDR, I2C_SLV2_ADDR, 0, 7),
+};
+
+static const tMPU6050_FIELD_DESC i2cSlv2Ctrl[] =
+{
+    FIELD(tMPU6050_I2C_SLV2_CTRL, I2C_SLV2_EN, 7, 1),
+    FIELD(tMPU6050_I2C_SLV2_CTRL, I2C_SLV2_BYTE_SW, 6, 1),
+    FIELD(tMPU6050_I2C_SLV2_CTRL, I2C_SLV2_REG_DIS, 5, 1),
+    FIELD(tMPU6050_I2C_SLV2_CTRL, I2C_SLV2_GRP, 4, 1),
+    FIELD(tMPU6050_I2C_SLV2_CTRL, I2C_SLV2_LEN, 0, 4),
+};
+
+static const tMPU6050_FIELD_DESC i2cSlv3Addr[] =
+{
+    FIELD(tMPU6050_I2C_SLV3_ADDR, I2C_SLV3_RW, 7, 1),
+    FIELD(tMPU6050_I2C_SLV3_ADDR, I2C_SLV3_ADDR, 0, 7),
+};
+
+static const tMPU6050_FIELD_DESC i2cSlv3Ctrl[] =
+{
+    FIELD(tMPU6050_I2C_SLV3_CTRL, I2C_SLV3_EN, 7, 1),
+    FIELD(tMPU6050_I2C_SLV3_CTRL, I2C_SLV3_BYTE_SW, 6, 1),
+    FIELD(tMPU6050_I2C_SLV3_CTRL, I2C_SLV3_REG_DIS, 5, 1),
+    FIELD(tMPU6050_I2C_SLV3_CTRL, I2C_SLV3_GRP, 4, 1),
+    FIELD(tMPU6050_I2C_SLV3_CTRL, I2C_SLV3_LEN, 0, 4),
+};
+
+static const tMPU6050_FIELD_DESC i2cSlv4Addr[] =
+{
+    FIELD(tMPU6050_I2C_SLV4_ADDR, I2C_SLV4_RW, 7, 1),
+    FIELD(tMPU6050_I2C_SLV4_ADDR, I2C_SLV4_ADDR, 0, 7),
+};
+
+static const tMPU6050_FIELD_DESC i2cSlv4Ctrl[] =
+{
+    FIELD(tMPU6050_I2C_SLV4_CTRL, I2C_SLV4_EN, 7, 1),
+    FIELD(tMPU6050_I2C_SLV4_CTRL, I2C_SLV4_INT_EN, 6, 1),
+    FIELD(tMPU6050_I2C_SLV4_CTRL, I2C_SLV4_REG_DIS, 5, 1),
+    FIELD(tMPU6050_I2C_SLV4_CTRL, I2C_MST_DLY, 0, 5),
+};
+
+static const tMPU6050_FIELD_DESC i2cMstStatus[] =
+{
+    FIELD(tMPU6050_I2C_MST_STATUS, PASS_THROUGH, 7, 1),
+    FIELD(tMPU6050_I2C_MST_STATUS, I2C_SLV4_DONE, 6, 1),
+    FIELD(tMPU6050_I2C_MST_STATUS, I2C_LOST_ARB, 5, 1),
+    FIELD(tMPU6050_I2C_MST_STATUS, I2C_SLV4_NACK, 4, 1),
+    FIELD(tMPU6050_I2C_MST_STATUS, I2C_SLV3_NACK, 3, 1),
+    FIELD(tMPU6050_I2C_MST_STATUS, I2C_SLV2_NACK, 2, 1),
+    FIELD(tMPU6050_I2C_MST_STATUS, I2C_SLV1_NACK, 1, 1),
+    FIELD(tMPU6050_I2C_MST_STATUS, I2C_SLV0_NACK, 0, 1),
+};
+
+static const tMPU6050_FIELD_DESC intPinCfg[] =
+{
+    FIELD(tMPU6050_INT_PIN_CFG, INT_LEVEL, 7, 1),
+    FIELD(tMPU6050_INT_PIN_CFG, INT_OPEN, 6, 1),
+    FIELD(tMPU6050_INT_PIN_CFG, LATCH_INT_EN, 5, 1),
+    FIELD(tMPU6050_INT_PIN_CFG, INT_RD_CLEAR, 4, 1),
+    FIELD(tMPU6050_INT_PIN_CFG, FSYNC_INT_LEVEL, 3, 1),
+    FIELD(tMPU6050_INT_PIN_CFG, FSYNC_INT_EN, 2, 1),
+    FIELD(tMPU6050_INT_PIN_CFG, I2C_BYPASS_EN, 1, 1),
+};
+
+static const tMPU6050_FIELD_DESC intEnable[] =
+{
+    FIELD(tMPU6050_INT_ENABLE, FIFO_OFLOW_EN, 4, 1),
+    FIELD(tMPU6050_INT_ENABLE, I2C_MST_INT_EN, 3, 1),
+    FIELD(tMPU6050_INT_ENABLE, DATA_RDY_EN, 0, 1),
+};
+
+static const tMPU6050_FIELD_DESC intStatus[] =
+{
+    FIELD(tMPU6050_INT_STATUS, FIFO_OFLOW_INT, 4, 1),
+    FIELD(tMPU6050_INT_STATUS, I2C_MST_INT, 3, 1),
+    FIELD(tMPU6050_INT_STATUS, DATA_RDY_INT, 0, 1),
+};
+
+static const tMPU6050_FIELD_DESC i2cMstDelayCtrl[] =
+{
+    FIELD(tMPU6050_I2C_MST_DELAY_CTRL, DELAY_ES_SHADOW, 7, 1),
+    FIELD(tMPU6050_I2C_MST_DELAY_CTRL, I2C_SLV4_DLY_EN, 4, 1),
+    FIELD(tMPU6050_I2C_MST_DELAY_CTRL, I2C_SLV3_DLY_EN, 3, 1),
+    FIELD(tMPU6050_I2C_MST_DELAY_CTRL, I2C_SLV2_DLY_EN, 2, 1),
+    FIELD(tMPU6050_I2C_MST_DELAY_CTRL, I2C_SLV1_DLY_EN, 1, 1),
+    FIELD(tMPU6050_I2C_MST_DELAY_CTRL, I2C_SLV0_DLY_EN, 0, 1),
+};
+
+static const tMPU6050_FIELD_DESC signalPathReset[] =
+{
+    FIELD(tMPU6050_SIGNAL_PATH_RESET, GYRO_RESET, 2, 1),
+    FIELD(tMPU6050_SIGNAL_PATH_RESET, ACCEL_RESET, 1, 1),
+    FIELD(tMPU6050_SIGNAL_PATH_RESET, TEMP_RESET, 0, 1),
+};
+
+static const tMPU6050_FIELD_DESC userCtrl[] =
+{
+    FIELD(tMPU6050_USER_CTRL, FIFO_EN, 6, 1),
+    FIELD(tMPU6050_USER_CTRL, I2C_MST_EN, 5, 1),
+    FIELD(tMPU6050_USER_CTRL, I2C_IF_DIS, 4, 1),
+    FIELD(tMPU6050_USER_CTRL, FIFO_RESET, 2, 1),
+    FIELD(tMPU6050_USER_CTRL, I2C_MST_RESET, 1, 1),
+    FIELD(tMPU6050_USER_CTRL, SIG_COND_RESET, 0, 1),
+};
+
+static const tMPU6050_FIELD_DESC pwrMgmt1[] =
+{
+    FIELD(tMPU6050_PWR_MGMT_1, DEVICE_RESET, 7, 1),
+    FIELD(tMPU6050_PWR_MGMT_1, SLEEP, 6, 1),
+    FIELD(tMPU6050_PWR_MGMT_1, CYCLE, 5, 1),
+    FIELD(tMPU6050_PWR_MGMT_1, TEMP_DIS, 3, 1),
+    FIELD(tMPU6050_PWR_MGMT_1, CLKSEL, 0, 3),
+};
+
+static const tMPU6050_FIELD_DESC pwrMgmt2[] =
+{
+    FIELD(tMPU6050_PWR_MGMT_2, LP_WAKE_CTRL, 6, 2),
+    FIELD(tMPU6050_PWR_MGMT_2, STBY_XA, 5, 1),
+    FIELD(tMPU6050_PWR_MGMT_2, STBY_YA, 4, 1),
+    FIELD(tMPU6050_PWR_MGMT_2, STBY_ZA, 3, 1),
+    FIELD(tMPU6050_PWR_MGMT_2, STBY_XG, 2, 1),
+    FIELD(tMPU6050_PWR_MGMT_2, STBY_YG, 1, 1),
+    FIELD(tMPU6050_PWR_MGMT_2, STBY_ZG, 0, 1),
+};
+
+/**
+ *  \brief Register description table, indexed by tMPU6050_REG_ID
+ */
+const tMPU6050_REG_DESC mpu6050_registerMap[MPU6050_CODEC_COUNT] =
+{
+    [MPU6050_CODEC_SELF_TEST]           = REGISTER(MPU6050_SELF_TEST_X, 4, tMPU6050_SELF_TEST, selfTest),
+    [MPU6050_CODEC_CONFIG]              = REGISTER(MPU6050_CONFIG, 1, tMPU6050_CONFIG, config),
+    [MPU6050_CODEC_GYRO_CONFIG]         = REGISTER(MPU6050_GYRO_CONFIG, 1, tMPU6050_GYRO_CONFIG, gyroConfig),
+    [MPU6050_CODEC_ACCEL_CONFIG]        = REGISTER(MPU6050_ACCEL_CONFIG, 1, tMPU6050_ACCEL_CONFIG, accelConfig),
+    [MPU6050_CODEC_FIFO_EN]             = REGISTER(MPU6050_FIFO_EN, 1, tMPU6050_FIFO_EN, fifoEn),
+    [MPU6050_CODEC_I2C_MST_CTRL]        = REGISTER(MPU6050_I2C_MST_CTRL, 1, tMPU6050_I2C_MST_CTRL, i2cMstCtrl),
+    [MPU6050_CODEC_I2C_SLV0_ADDR]       = REGISTER(MPU6050_I2C_SLV0_ADDR, 1, tMPU6050_I2C_SLV0_ADDR, i2cSlv0Addr),
+    [MPU6050_CODEC_I2C_SLV0_CTRL]       = REGISTER(MPU6050_I2C_SLV0_CTRL, 1, tMPU6050_I2C_SLV0_CTRL, i2cSlv0Ctrl),
+    [MPU6050_CODEC_I2C_SLV1_ADDR]       = REGISTER(MPU6050_I2C_SLV1_ADDR, 1, tMPU6050_I2C_SLV1_ADDR, i2cSlv1Addr),
+    [MPU6050_CODEC_I2C_SLV1_CTRL]       = REGISTER(MPU6050_I2C_SLV1_CTRL, 1, tMPU6050_I2C_SLV1_CTRL, i2cSlv1Ctrl),
+    [MPU6050_CODEC_I2C_SLV2_ADDR]       = REGISTER(MPU6050_I2C_SLV2_ADDR, 1, tMPU6050_I2C_SLV2_ADDR, i2cSlv2Addr),
+    [MPU6050_CODEC_I2C_SLV2_CTRL]       = REGISTER(MPU6050_I2C_SLV2_CTRL, 1, tMPU6050_I2C_SLV2_CTRL, i2cSlv2Ctrl),
+    [MPU6050_CODEC_I2C_SLV3_ADDR]       = REGISTER(MPU6050_I2C_SLV3_ADDR, 1, tMPU6050_I2C_SLV3_ADDR, i2cSlv3Addr),
+    [MPU6050_CODEC_I2C_SLV3_CTRL]       = REGISTER(MPU6050_I2C_SLV3_CTRL, 1, tMPU6050_I2C_SLV3_CTRL, i2cSlv3Ctrl),
+    [MPU6050_CODEC_I2C_SLV4_ADDR]       = REGISTER(MPU6050_I2C_SLV4_ADDR, 1, tMPU6050_I2C_SLV4_ADDR, i2cSlv4Addr),
+    [MPU6050_CODEC_I2C_SLV4_CTRL]       = REGISTER(MPU6050_I2C_SLV4_CTRL, 1, tMPU6050_I2C_SLV4_CTRL, i2cSlv4Ctrl),
+    [MPU6050_CODEC_I2C_MST_STATUS]      = REGISTER(MPU6050_I2C_MST_STATUS, 1, tMPU6050_I2C_MST_STATUS, i2cMstStatus),
+    [MPU6050_CODEC_INT_PIN_CFG]         = REGISTER(MPU6050_INT_PIN_CFG, 1, tMPU6050_INT_PIN_CFG, intPinCfg),
+    [MPU6050_CODEC_INT_ENABLE]          = REGISTER(MPU6050_INT_ENABLE, 1, tMPU6050_INT_ENABLE, intEnable),
+    [MPU6050_CODEC_INT_STATUS]          = REGISTER(MPU6050_INT_STATUS, 1, tMPU6050_INT_STATUS, intStatus),
+    [MPU6050_CODEC_I2C_MST_DELAY_CTRL]  = REGISTER(MPU6050_I2C_MST_DELAY_CT_RL, 1, tMPU6050_I2C_MST_DELAY_CTRL, i2cMstDelayCtrl),
+    [MPU6050_CODEC_SIGNAL_PATH_RESET]   = REGISTER(MPU6050_SIGNAL_PATH_RESET, 1, tMPU6050_SIGNAL_PATH_RESET, signalPathReset),
+    [MPU6050_CODEC_USER_CTRL]           = REGISTER(MPU6050_USER_CTRL, 1, tMPU6050_USER_CTRL, userCtrl),
+    [MPU6050_CODEC_PWR_MGMT_1]          = REGISTER(MPU6050_PWR_MGMT_1, 1, tMPU6050_PWR_MGMT_1, pwrMgmt1),
+    [MPU6050_CODEC_PWR_MGMT_2]          = REGISTER(MPU6050_PWR_MGMT_2, 1, tMPU6050_PWR_MGMT_2, pwrMgmt2),
+};
+
+/**
+ *  \brief Decode register bytes into a register datatype
+ *  
+ *  \param [in] desc Register description
+ *  \param [in] pui8Reg Register bytes, desc->SPAN bytes
+ *  \param [in] obj Datatype pointer to return register values
+ *  
+ *  \details Bits that are not described by a field are ignored.
+ */
+void mpu6050_regDecode(const tMPU6050_REG_DESC *desc, const uint8_t *pui8Reg, void *obj)
+{
+    const tMPU6050_FIELD_DESC *field = desc->FIELDS;
+    uint8_t *member = (uint8_t*)obj;
+    uint8_t i;
+
+    memset(obj, 0, desc->SIZE);
+    for(i = 0; i < desc->COUNT; i++, field++)
+        member[field->OFFSET] |= ((pui8Reg[field->REG] >> field->SHIFT) & ((1u << field->WIDTH) - 1)) << field->POS;
+}
+
+/**
+ *  \brief Encode a register datatype into register bytes
+ *  
+ *  \param [in] desc Register description
+ *  \param [in] obj Datatype pointer with register values
+ *  \param [in] pui8Reg Buffer for desc->SPAN register bytes
+ *  
+ *  \details Field values wider than the field are truncated, reserved
+ *  bits are written as 0.
+ */
+void mpu6050_regEncode(const tMPU6050_REG_DESC *desc, const void *obj, uint8_t *pui8Reg)
+{
+    const tMPU6050_FIELD_DESC *field = desc->FIELDS;
+    const uint8_t *member = (const uint8_t*)obj;
+    uint8_t i;
+
+    memset(pui8Reg, 0, desc->SPAN);
+    for(i = 0; i < desc->COUNT; i++, field++)
+        pui8Reg[field->REG] |= ((member[field->OFFSET] >> field->POS) & ((1u << field->WIDTH) - 1)) << field->SHIFT;
+}
+
+/**
+ *  \brief Read a register datatype
+ *  
+ *  \param [in] dev Device handle
+ *  \param [in] id Register datatype
+ *  \param [in] obj Datatype pointer to return register values
+ *  
+ *  \details Registers spanning more than one address are read with one burst.
+ */
+void mpu6050_regRead(tMPU6050_DEV *dev, tMPU6050_REG_ID id, void *obj)
+{
+    const tMPU6050_REG_DESC *desc = &mpu6050_registerMap[id];
+    uint8_t reg[MPU6050_CODEC_MAX_SPAN];
+
+    if(desc->SPAN == 1)
+        reg[0] = mpu6050_busRead(dev, desc->ADDR);
+    else
+        mpu6050_busReadBurst(dev, desc->ADDR, reg, desc->SPAN);
+
+    mpu6050_regDecode(desc, reg, obj);
+}
+
+/**
+ *  \brief Write a register datatype
+ *  
+ *  \param [in] dev Device handle
+ *  \param [in] id Register datatype
+ *  \param [in] obj Datatype pointer with register values
+ *  
+ *  \details Registers spanning more than one address are written with one burst.
+ */
+void mpu6050_regWrite(tMPU6050_DEV *dev, tMPU6050_REG_ID id, const void *obj)
+{
+    const tMPU6050_REG_DESC *desc = &mpu6050_registerMap[id];
+    uint8_t reg[MPU6050_CODEC_MAX_SPAN];
+
+    mpu6050_regEncode(desc, obj, reg);
+
+    if(desc->SPAN == 1)
+        mpu6050_busWrite(dev, desc->ADDR, reg[0]);
+    else
+        mpu6050_busWriteBurst(dev, desc->ADDR, reg, desc->SPAN);
+}
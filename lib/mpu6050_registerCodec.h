@@ -0,0 +1,104 @@
+/*
+ * This file is part of the MPU6050-Library distribution (https://github.com/jmherzog-de/MPU6050-Library).
+ * Copyright (c) 2021 Jean-Marcel Herzog.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+/**
+ *  \file mpu6050_registerCodec.h
+ *  \brief Register Codec headerfile
+ *  \copyright Copyright 2021 Jean-Marcel Herzog. All rights reserved. This project is released under the GNU Public License.
+ */
+
+#ifndef MPU6050_REGISTERCODEC_H_
+#define MPU6050_REGISTERCODEC_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "mpu6050_device.h"
+
+/**
+ *  \brief Description of one register field
+ *  
+ *  WIDTH bits at bit SHIFT of register byte REG map to bit POS and up of
+ *  the datatype byte at OFFSET. For the bit field datatypes of single
+ *  registers OFFSET is 0 and POS equals SHIFT.
+ */
+typedef struct
+{
+    uint8_t REG;        /**< Register index inside the register span. */
+    uint8_t OFFSET;     /**< Byte offset inside the datatype. */
+    uint8_t SHIFT;      /**< Position of the field inside the register. */
+    uint8_t WIDTH;      /**< Width of the field in bits. */
+    uint8_t POS;        /**< Position of the field inside the datatype byte. */
+}
+tMPU6050_FIELD_DESC;
+
+/**
+ *  \brief Description of one register datatype
+ */
+typedef struct
+{
+    uint8_t ADDR;                           /**< Address of the first register. */
+    uint8_t SPAN;                           /**< Number of adjacent registers. */
+    uint8_t SIZE;                           /**< Size of the register datatype. */
+    uint8_t COUNT;                          /**< Number of fields. */
+    const tMPU6050_FIELD_DESC *FIELDS;      /**< Field descriptions. */
+}
+tMPU6050_REG_DESC;
+
+/**
+ *  \brief Index into the register description table
+ */
+typedef enum
+{
+    MPU6050_CODEC_SELF_TEST,
+    MPU6050_CODEC_CONFIG,
+    MPU6050_CODEC_GYRO_CONFIG,
+    MPU6050_CODEC_ACCEL_CONFIG,
+    MPU6050_CODEC_FIFO_EN,
+    MPU6050_CODEC_I2C_MST_CTRL,
+    MPU6050_CODEC_I2C_SLV0_ADDR,
+    MPU6050_CODEC_I2C_SLV0_CTRL,
+    MPU6050_CODEC_I2C_SLV1_ADDR,
+    MPU6050_CODEC_I2C_SLV1_CTRL,
+    MPU6050_CODEC_I2C_SLV2_ADDR,
+    MPU6050_CODEC_I2C_SLV2_CTRL,
+    MPU6050_CODEC_I2C_SLV3_ADDR,
+    MPU6050_CODEC_I2C_SLV3_CTRL,
+    MPU6050_CODEC_I2C_SLV4_ADDR,
+    MPU6050_CODEC_I2C_SLV4_CTRL,
+    MPU6050_CODEC_I2C_MST_STATUS,
+    MPU6050_CODEC_INT_PIN_CFG,
+    MPU6050_CODEC_INT_ENABLE,
+    MPU6050_CODEC_INT_STATUS,
+    MPU6050_CODEC_I2C_MST_DELAY_CTRL,
+    MPU6050_CODEC_SIGNAL_PATH_RESET,
+    MPU6050_CODEC_USER_CTRL,
+    MPU6050_CODEC_PWR_MGMT_1,
+    MPU6050_CODEC_PWR_MGMT_2,
+    MPU6050_CODEC_COUNT
+}
+tMPU6050_REG_ID;
+
+/** Largest register span of the description table */
+#define MPU6050_CODEC_MAX_SPAN      4
+
+extern const tMPU6050_REG_DESC mpu6050_registerMap[MPU6050_CODEC_COUNT];
+
+extern void mpu6050_regDecode(const tMPU6050_REG_DESC*, const uint8_t*, void*);
+extern void mpu6050_regEncode(const tMPU6050_REG_DESC*, const void*, uint8_t*);
+extern void mpu6050_regRead(tMPU6050_DEV*, tMPU6050_REG_ID, void*);
+extern void mpu6050_regWrite(tMPU6050_DEV*, tMPU6050_REG_ID, const void*);
+
+#endif
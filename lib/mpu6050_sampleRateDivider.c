@@ -44,30 +44,51 @@
 
 #include <stdint.h>
 #include <stdbool.h>
-#include "i2c.h"
-#include "mpu6050_reg.h"
+#include "mpu6050_transport.h"
+#include "mpu6050_shadowRegisters.h"
 #include "mpu6050_sampleRateDivider.h"
 
 /**
  *  \brief Read Sample Rate Divider register
  *  
+ *  \param [in] dev Device handle
  *  \param [in] obj Datatype pointer to return register values
  *  
  *  \details See register datasheet chapter 4.2 for more details.
  */
-void mpu6050_sampleRateDividerRegRead(tMPU6050_SMPLRT_DIV *obj)
+void mpu6050_sampleRateDividerRegRead(tMPU6050_DEV *dev, tMPU6050_SMPLRT_DIV *obj)
 {
-    *obj = i2c_receive(MPU6050_I2C_ADDR, MPU6050_SMPRT_DIV);
+    *obj = mpu6050_busRead(dev, MPU6050_SMPRT_DIV);
 }
 
 /**
  *  \brief Write Sample Rate Divider register
  *  
+ *  \param [in] dev Device handle
  *  \param [in] obj Datatype pointer to register values
  *  
  *  \details See register datasheet chapter 4.2 for more details.
  */
-void mpu6050_sampleRateDividerRegWrite(tMPU6050_SMPLRT_DIV *obj)
+void mpu6050_sampleRateDividerRegWrite(tMPU6050_DEV *dev, tMPU6050_SMPLRT_DIV *obj)
 {
-    i2c_write(MPU6050_I2C_ADDR, MPU6050_SMPRT_DIV, *obj);
-}
\ No newline at end of file
+    mpu6050_busWrite(dev, MPU6050_SMPRT_DIV, *obj);
+}
+
+/**
+ *  \brief Get the sample period
+ *  
+ *  \param [in] dev Device handle
+ *  \return Time between two samples in nanoseconds
+ *  
+ *  \details Computed from SMPLRT_DIV and DLPF_CFG (register 26). Both are
+ *  taken from the shadow cache, so the registers are read only once.
+ *  The period is exact: 125us or 1ms times (1 + SMPLRT_DIV).
+ */
+uint32_t mpu6050_samplePeriodNs(tMPU6050_DEV *dev)
+{
+    uint8_t div = mpu6050_shadowFieldRead(dev, MPU6050_FIELD_SMPLRT_DIV);
+    uint8_t dlpf = mpu6050_shadowFieldRead(dev, MPU6050_FIELD_DLPF_CFG);
+    uint32_t gyroPeriodNs = (dlpf == 0 || dlpf == 7) ? 125000 : 1000000;
+
+    return gyroPeriodNs * (1u + div);
+}
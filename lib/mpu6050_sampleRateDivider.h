@@ -26,7 +26,8 @@
 
 typedef unsigned char tMPU6050_SMPLRT_DIV;	/**< Datatype for Sample Rate Register. The Sample Rate is determined by dividing the gyro output rate by this value. */
 
-extern void mpu6050_sampleRateDividerRegRead(tMPU6050_SMPLRT_DIV*);
-extern void mpu6050_sampleRateDividerRegWrite(tMPU6050_SMPLRT_DIV*);
+extern void mpu6050_sampleRateDividerRegRead(tMPU6050_DEV*, tMPU6050_SMPLRT_DIV*);
+extern void mpu6050_sampleRateDividerRegWrite(tMPU6050_DEV*, tMPU6050_SMPLRT_DIV*);
+extern uint32_t mpu6050_samplePeriodNs(tMPU6050_DEV*);
 
 #endif
\ No newline at end of file
@@ -0,0 +1,159 @@
+/*
+ * This file is part of the MPU6050-Library distribution (https://github.com/jmherzog-de/MPU6050-Library).
+ * Copyright (c) 2021 Jean-Marcel Herzog.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+/**
+ *  \file mpu6050_sampleRing.c
+ *  \brief Sample Ring Buffer
+ *  
+ *  Decouples the acquisition interrupt from the application: the interrupt
+ *  pushes every sample, the main loop or a task pops all pending samples
+ *  at its own rate, e.g. 10 samples per 100Hz control cycle at a 1kHz
+ *  sample rate.
+ *  
+ *  The ring needs neither locks nor interrupt masking. There is exactly one
+ *  producer and one consumer, each index is written by one side only, and
+ *  a memory barrier orders the sample copy before the index update. The
+ *  capacity is a power of two, so the free-running 32 bit indices wrap
+ *  without a correction and a slot is found with a mask.
+ *  
+ *  A full ring drops the new sample (the producer may not move TAIL) and
+ *  counts it in OVERRUNS. HIGH_WATER shows how close the consumer came to
+ *  an overrun; size MPU6050_RING_SIZE accordingly.
+ *  
+ *  Usage with the acquisition pipeline:
+ *  
+ *      mpu6050_ringInitialization(&ring);
+ *      mpu6050_acqStart(&dev, &acq, clock, mpu6050_ringAcqPush, &ring);
+ *      ...
+ *      n = mpu6050_ringPop(&ring, samples, 16);
+ *  
+ *  \copyright Copyright 2021 Jean-Marcel Herzog. All rights reserved. This project is released under the GNU Public License.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "mpu6050_sampleRing.h"
+
+#define MPU6050_RING_MASK   (MPU6050_RING_SIZE - 1)
+
+/** Memory barrier between sample data and index updates */
+#if defined(__GNUC__)
+#define MPU6050_RING_BARRIER()  __sync_synchronize()
+#else
+#define MPU6050_RING_BARRIER()
+#endif
+
+/**
+ *  \brief Sample ring initialization
+ *  
+ *  \param [in] ring Sample ring
+ *  
+ *  \details Empties the ring and clears the counters. Not safe while the
+ *  producer or the consumer is active.
+ */
+void mpu6050_ringInitialization(tMPU6050_RING *ring)
+{
+    ring->HEAD = 0;
+    ring->TAIL = 0;
+    ring->OVERRUNS = 0;
+    ring->HIGH_WATER = 0;
+}
+
+/**
+ *  \brief Append a sample (producer)
+ *  
+ *  \param [in] ring Sample ring
+ *  \param [in] sample Sample to append
+ *  \return false if the ring is full and the sample was dropped
+ */
+bool mpu6050_ringPush(tMPU6050_RING *ring, const tMPU6050_SAMPLE *sample)
+{
+    uint32_t head = ring->HEAD;
+    uint32_t count = head - ring->TAIL;
+
+    if(count >= MPU6050_RING_SIZE)
+    {
+        ring->OVERRUNS++;
+        return false;
+    }
+
+    ring->SAMPLE[head & MPU6050_RING_MASK] = *sample;
+
+    // the consumer must see the sample before the new HEAD
+    MPU6050_RING_BARRIER();
+    ring->HEAD = head + 1;
+
+    if(count + 1 > ring->HIGH_WATER)
+        ring->HIGH_WATER = count + 1;
+
+    return true;
+}
+
+/**
+ *  \brief Remove up to ui16Max samples (consumer)
+ *  
+ *  \param [in] ring Sample ring
+ *  \param [in] pSamples Buffer for ui16Max samples
+ *  \param [in] ui16Max Maximum number of samples to remove
+ *  \return Number of samples copied to pSamples, oldest first
+ */
+uint16_t mpu6050_ringPop(tMPU6050_RING *ring, tMPU6050_SAMPLE *pSamples, uint16_t ui16Max)
+{
+    uint32_t tail = ring->TAIL;
+    uint32_t count = ring->HEAD - tail;
+    uint16_t i;
+
+    if(count > ui16Max)
+        count = ui16Max;
+
+    // HEAD was read before the samples it announces
+    MPU6050_RING_BARRIER();
+
+    for(i = 0; i < count; i++)
+        pSamples[i] = ring->SAMPLE[(tail + i) & MPU6050_RING_MASK];
+
+    // the producer may reuse the slots only after they are copied
+    MPU6050_RING_BARRIER();
+    ring->TAIL = tail + count;
+
+    return (uint16_t)count;
+}
+
+/**
+ *  \brief Number of samples in the ring
+ *  
+ *  \param [in] ring Sample ring
+ *  \return Number of samples that can be popped
+ */
+uint16_t mpu6050_ringCount(const tMPU6050_RING *ring)
+{
+    return (uint16_t)(ring->HEAD - ring->TAIL);
+}
+
+/**
+ *  \brief Acquisition consumer that pushes into a ring
+ *  
+ *  \param [in] dev Device handle
+ *  \param [in] sample Acquired sample
+ *  \param [in] arg Sample ring
+ *  
+ *  \details Pass as callback to mpu6050_acqStart() with the ring as argument.
+ */
+void mpu6050_ringAcqPush(tMPU6050_DEV *dev, const tMPU6050_SAMPLE *sample, void *arg)
+{
+    (void)dev;
+    mpu6050_ringPush((tMPU6050_RING*)arg, sample);
+}
@@ -0,0 +1,61 @@
+/*
+ * This file is part of the MPU6050-Library distribution (https://github.com/jmherzog-de/MPU6050-Library).
+ * Copyright (c) 2021 Jean-Marcel Herzog.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+/**
+ *  \file mpu6050_sampleRing.h
+ *  \brief Sample Ring Buffer headerfile
+ *  \copyright Copyright 2021 Jean-Marcel Herzog. All rights reserved. This project is released under the GNU Public License.
+ */
+
+#ifndef MPU6050_SAMPLERING_H_
+#define MPU6050_SAMPLERING_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "mpu6050_acquisition.h"
+
+/** Number of samples of a ring, must be a power of two */
+#ifndef MPU6050_RING_SIZE
+#define MPU6050_RING_SIZE   64
+#endif
+
+#if (MPU6050_RING_SIZE & (MPU6050_RING_SIZE - 1)) != 0
+#error MPU6050_RING_SIZE must be a power of two
+#endif
+
+/**
+ *  \brief Single producer, single consumer ring of samples
+ *  
+ *  HEAD and TAIL are free-running sample counters. HEAD, OVERRUNS and
+ *  HIGH_WATER are only written by the producer, TAIL only by the consumer.
+ */
+typedef struct
+{
+    tMPU6050_SAMPLE SAMPLE[MPU6050_RING_SIZE];  /**< Sample storage */
+    volatile uint32_t HEAD;                     /**< Number of samples pushed */
+    volatile uint32_t TAIL;                     /**< Number of samples popped */
+    volatile uint32_t OVERRUNS;                 /**< Number of samples dropped because the ring was full */
+    volatile uint32_t HIGH_WATER;               /**< Highest number of samples in the ring */
+}
+tMPU6050_RING;
+
+extern void mpu6050_ringInitialization(tMPU6050_RING*);
+extern bool mpu6050_ringPush(tMPU6050_RING*, const tMPU6050_SAMPLE *sample);
+extern uint16_t mpu6050_ringPop(tMPU6050_RING*, tMPU6050_SAMPLE *pSamples, uint16_t ui16Max);
+extern uint16_t mpu6050_ringCount(const tMPU6050_RING*);
+extern void mpu6050_ringAcqPush(tMPU6050_DEV*, const tMPU6050_SAMPLE *sample, void *arg);
+
+#endif
@@ -0,0 +1,95 @@
+/*
+ * This file is part of the MPU6050-Library distribution (https://github.com/jmherzog-de/MPU6050-Library).
+ * Copyright (c) 2021 Jean-Marcel Herzog.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ *  \file mpu6050_scaledMeasurements.c
+ *  \brief Scaled Measurements
+ *  
+ *  Converts the two's complement measurement register values to SI units:
+ *  acceleration in m/s^2, angular rate in rad/s and temperature in degrees C.
+ *  
+ *  The scale factors for the current full scale ranges are cached in the
+ *  device handle (see mpu6050_device.c). They follow the range whenever
+ *  ACCEL_CONFIG or GYRO_CONFIG is accessed through the library, so a
+ *  conversion needs no register access and no divide.
+ *  
+ *  Temperature in degrees C = (TEMP_OUT register value as signed quantity)/340 + 36.53
+ *  
+ *  \copyright Copyright 2021 Jean-Marcel Herzog. All rights reserved. This project is released under the GNU Public License.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "mpu6050_device.h"
+#include "mpu6050_scaledMeasurements.h"
+
+/**
+ *  \brief Convert accelerometer measurement to m/s^2
+ *  
+ *  \param [in] dev Device handle
+ *  \param [in] raw Accelerometer measurement
+ *  \param [in] obj Datatype pointer to return the scaled values
+ */
+void mpu6050_accelScale(const tMPU6050_DEV *dev, const tMPU6050_ACCEL *raw, tMPU6050_ACCEL_SI *obj)
+{
+    const float scale = dev->ACCEL_SCALE;
+
+    obj->X = raw->X * scale;
+    obj->Y = raw->Y * scale;
+    obj->Z = raw->Z * scale;
+}
+
+/**
+ *  \brief Convert gyroscope measurement to rad/s
+ *  
+ *  \param [in] dev Device handle
+ *  \param [in] raw Gyroscope measurement
+ *  \param [in] obj Datatype pointer to return the scaled values
+ */
+void mpu6050_gyroScale(const tMPU6050_DEV *dev, const tMPU6050_GYRO *raw, tMPU6050_GYRO_SI *obj)
+{
+    const float scale = dev->GYRO_SCALE;
+
+    obj->X = raw->X * scale;
+    obj->Y = raw->Y * scale;
+    obj->Z = raw->Z * scale;
+}
+
+/**
+ *  \brief Convert temperature measurement to degrees C
+ *  
+ *  \param [in] raw Temperature measurement
+ *  \return Temperature in degrees C
+ */
+float mpu6050_tempScale(tMPU6050_TEMP raw)
+{
+    return raw * MPU6050_TEMP_SCALE + MPU6050_TEMP_OFFSET;
+}
+
+/**
+ *  \brief Convert a complete sample to SI units
+ *  
+ *  \param [in] dev Device handle
+ *  \param [in] raw Accelerometer, temperature and gyroscope measurement
+ *  \param [in] obj Datatype pointer to return the scaled values
+ */
+void mpu6050_motionScale(const tMPU6050_DEV *dev, const tMPU6050_MOTION *raw, tMPU6050_MOTION_SI *obj)
+{
+    mpu6050_accelScale(dev, &raw->ACCEL, &obj->ACCEL);
+    obj->TEMP = mpu6050_tempScale(raw->TEMP);
+    mpu6050_gyroScale(dev, &raw->GYRO, &obj->GYRO);
+}
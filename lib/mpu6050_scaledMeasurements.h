@@ -0,0 +1,76 @@
+/*
+ * This file is part of the MPU6050-Library distribution (https://github.com/jmherzog-de/MPU6050-Library).
+ * Copyright (c) 2021 Jean-Marcel Herzog.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ *  \file mpu6050_scaledMeasurements.h
+ *  \brief Scaled Measurements headerfile
+ *  \copyright Copyright 2021 Jean-Marcel Herzog. All rights reserved. This project is released under the GNU Public License.
+ */
+
+#ifndef MPU6050_SCALEDMEASUREMENTS_H_
+#define MPU6050_SCALEDMEASUREMENTS_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "mpu6050_transport.h"
+#include "mpu6050_motionMeasurements.h"
+
+/** Temperature sensitivity in degrees C per LSB (1/340 LSB/degrees C) */
+#define MPU6050_TEMP_SCALE      (1.0f / 340.0f)
+
+/** Temperature in degrees C at a register value of 0 */
+#define MPU6050_TEMP_OFFSET     36.53f
+
+/**
+ *  \brief Type for accelerometer measurement of all axis in m/s^2
+ */
+typedef struct
+{
+    float X;    /**< X axis acceleration in m/s^2 */
+    float Y;    /**< Y axis acceleration in m/s^2 */
+    float Z;    /**< Z axis acceleration in m/s^2 */
+}
+tMPU6050_ACCEL_SI;
+
+/**
+ *  \brief Type for gyroscope measurement of all axis in rad/s
+ */
+typedef struct
+{
+    float X;    /**< X axis angular rate in rad/s */
+    float Y;    /**< Y axis angular rate in rad/s */
+    float Z;    /**< Z axis angular rate in rad/s */
+}
+tMPU6050_GYRO_SI;
+
+/**
+ *  \brief Type for one complete sample in SI units
+ */
+typedef struct
+{
+    tMPU6050_ACCEL_SI ACCEL;    /**< Acceleration in m/s^2 */
+    float TEMP;                 /**< Temperature in degrees C */
+    tMPU6050_GYRO_SI GYRO;      /**< Angular rate in rad/s */
+}
+tMPU6050_MOTION_SI;
+
+extern void mpu6050_accelScale(const tMPU6050_DEV*, const tMPU6050_ACCEL*, tMPU6050_ACCEL_SI*);
+extern void mpu6050_gyroScale(const tMPU6050_DEV*, const tMPU6050_GYRO*, tMPU6050_GYRO_SI*);
+extern float mpu6050_tempScale(tMPU6050_TEMP);
+extern void mpu6050_motionScale(const tMPU6050_DEV*, const tMPU6050_MOTION*, tMPU6050_MOTION_SI*);
+
+#endif
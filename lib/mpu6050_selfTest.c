@@ -53,58 +53,32 @@
 
 #include <stdint.h>
 #include <stdbool.h>
-#include "i2c.h"
-#include "mpu6050_reg.h"
+#include "mpu6050_transport.h"
+#include "mpu6050_registerCodec.h"
 #include "mpu6050_selfTest.h"
 
 /**
  *  \brief Read Self Test register
  *  
+ *  \param [in] dev Device handle
  *  \param [in] obj Datatype pointer to return register values
  *  
  *  \details See register datasheet chapter 4.1 for more details.
  */
-void mpu6050_selftestRegRead(tMPU6050_SELF_TEST *obj)
+void mpu6050_selftestRegRead(tMPU6050_DEV *dev, tMPU6050_SELF_TEST *obj)
 {
-    uint8_t x_reg = i2c_receive(MPU6050_I2C_ADDR, MPU6050_SELF_TEST_X);
-    uint8_t y_reg = i2c_receive(MPU6050_I2C_ADDR, MPU6050_SELF_TEST_Y);
-    uint8_t z_reg = i2c_receive(MPU6050_I2C_ADDR, MPU6050_SELF_TEST_Z);
-    uint8_t a_reg = i2c_receive(MPU6050_I2C_ADDR, MPU6050_SELF_TEST_A);
-
-    obj->XG_TEST = x_reg & 0x1F;
-    obj->YG_TEST = y_reg & 0x1F;
-    obj->ZG_TEST = z_reg & 0x1F;
-
-    obj->XA_TEST = (x_reg & 0xE0) >> 3;
-    obj->XA_TEST = obj->XA_TEST | (( a_reg >> 4) & 0x03);
-
-    obj->YA_TEST = (y_reg & 0xE0) >> 3;
-    obj->YA_TEST = obj->YA_TEST | (( a_reg >> 2) & 0x03);
-
-    obj->ZA_TEST = (z_reg & 0xE0) >> 3;
-    obj->ZA_TEST = obj->ZA_TEST | (a_reg & 0x03);
+    mpu6050_regRead(dev, MPU6050_CODEC_SELF_TEST, obj);
 }
 
 /**
  *  \brief Write Self Test register
  *  
+ *  \param [in] dev Device handle
  *  \param [in] obj Datatype pointer to register values
  *  
  *  \details See register datasheet chapter 4.1 for more details.
  */
-void mpu6050_selftestRegWrite(tMPU6050_SELF_TEST *obj)
+void mpu6050_selftestRegWrite(tMPU6050_DEV *dev, tMPU6050_SELF_TEST *obj)
 {
-    uint8_t reg;
-
-    reg = (((uint8_t)obj->XA_TEST >> 2) << 5) | ((uint8_t)obj->XG_TEST);
-    i2c_write(MPU6050_I2C_ADDR, MPU6050_SELF_TEST_X, reg);
-
-    reg = (((uint8_t)obj->YA_TEST >> 2) << 5) | ((uint8_t)obj->YG_TEST);
-    i2c_write(MPU6050_I2C_ADDR, MPU6050_SELF_TEST_Y, reg);
-
-    reg = (((uint8_t)obj->ZA_TEST >> 2) << 5) | ((uint8_t)obj->ZG_TEST);
-    i2c_write(MPU6050_I2C_ADDR, MPU6050_SELF_TEST_Z, reg);
-
-    reg = (((uint8_t)obj->XA_TEST & 0x03) << 4) | (((uint8_t)obj->YA_TEST & 0x03) << 2) | ((uint8_t)obj->ZA_TEST & 0x03);
-    i2c_write(MPU6050_I2C_ADDR, MPU6050_SELF_TEST_A, reg);
+    mpu6050_regWrite(dev, MPU6050_CODEC_SELF_TEST, obj);
 }
\ No newline at end of file
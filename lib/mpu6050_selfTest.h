@@ -26,16 +26,16 @@
 
 typedef struct
 {
-    unsigned char XA_TEST: 5;
-    unsigned char XG_TEST: 5;
-    unsigned char YA_TEST: 5;
-    unsigned char YG_TEST: 5;
-    unsigned char ZA_TEST: 5;
-    unsigned char ZG_TEST: 5;
+    unsigned char XA_TEST;
+    unsigned char XG_TEST;
+    unsigned char YA_TEST;
+    unsigned char YG_TEST;
+    unsigned char ZA_TEST;
+    unsigned char ZG_TEST;
 }
 tMPU6050_SELF_TEST;
 
-extern void mpu6050_selftestRegRead(tMPU6050_SELF_TEST*);
-extern void mpu6050_selftestRegWrite(tMPU6050_SELF_TEST*);
+extern void mpu6050_selftestRegRead(tMPU6050_DEV*, tMPU6050_SELF_TEST*);
+extern void mpu6050_selftestRegWrite(tMPU6050_DEV*, tMPU6050_SELF_TEST*);
 
 #endif
\ No newline at end of file
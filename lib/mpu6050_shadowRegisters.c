@@ -0,0 +1,224 @@
+/*
+ * This file is part of the MPU6050-Library distribution (https://github.com/jmherzog-de/MPU6050-Library).
+ * Copyright (c) 2021 Jean-Marcel Herzog.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ *  \file mpu6050_shadowRegisters.c
+ *  \brief Shadow Registers
+ *  
+ *  Write-through cache of the writable configuration registers. Every device
+ *  handle keeps a copy of these registers. The copy is filled by the first
+ *  bus access and updated on every write, so reading a configuration register
+ *  again does not need a bus transaction.
+ *  
+ *  Registers which are changed by the sensor itself are never cached: the
+ *  measurement and external sensor data registers, INT_STATUS, I2C_MST_STATUS,
+ *  I2C_SLV4_CTRL and I2C_SLV4_DI (I2C_SLV4_EN clears on completion), the FIFO
+ *  registers and SIGNAL_PATH_RESET. The self clearing reset bits of USER_CTRL
+ *  are not stored. Writing DEVICE_RESET in PWR_MGMT_1 invalidates the cache.
+ *  
+ *  The field functions change a single register field (e.g. DLPF_CFG) with
+ *  at most one bus write, and with no bus access at all if the field already
+ *  has the requested value.
+ *  
+ *  \note Call mpu6050_shadowInvalidate() if the sensor lost its configuration
+ *  without the library, e.g. after a power cycle.
+ *  
+ *  \copyright Copyright 2021 Jean-Marcel Herzog. All rights reserved. This project is released under the GNU Public License.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "mpu6050_device.h"
+#include "mpu6050_fifoReadWrite.h"
+#include "mpu6050_shadowRegisters.h"
+
+#define SHADOW_USER_CTRL_RESET_BITS     0x07
+#define SHADOW_PWR_MGMT_1_DEVICE_RESET  0x80
+
+/**
+ *  \brief Check if a register is held in the shadow cache
+ *  
+ *  \param [in] ui8Reg Register address
+ *  \return true if the register is a writable configuration register
+ */
+bool mpu6050_shadowCacheable(uint8_t ui8Reg)
+{
+    if(ui8Reg >= MPU6050_SELF_TEST_X && ui8Reg <= MPU6050_SELF_TEST_A)
+        return true;
+    if(ui8Reg >= MPU6050_SMPRT_DIV && ui8Reg <= MPU6050_ACCEL_CONFIG)
+        return true;
+    if(ui8Reg >= MPU6050_FIFO_EN && ui8Reg <= MPU6050_I2C_SLV4_DO)
+        return true;
+    if(ui8Reg >= MPU6050_I2C_SLV0_DO && ui8Reg <= MPU6050_I2C_MST_DELAY_CT_RL)
+        return true;
+
+    switch(ui8Reg)
+    {
+    case MPU6050_INT_PIN_CFG:
+    case MPU6050_INT_ENABLE:
+    case MPU6050_USER_CTRL:
+    case MPU6050_PWR_MGMT_1:
+    case MPU6050_PWR_MGMT_2:
+        return true;
+    default:
+        return false;
+    }
+}
+
+/**
+ *  \brief Get a register value from the shadow cache
+ *  
+ *  \param [in] dev Device handle
+ *  \param [in] ui8Reg Register address
+ *  \param [out] pui8Data Cached register value
+ *  \return true if the register is cached, false if it must be read from the bus
+ */
+bool mpu6050_shadowLookup(tMPU6050_DEV *dev, uint8_t ui8Reg, uint8_t *pui8Data)
+{
+    ui8Reg &= 0x7F;
+
+    if(!(dev->SHADOW_VALID[ui8Reg >> 5] & (1UL << (ui8Reg & 0x1F))))
+        return false;
+
+    *pui8Data = dev->SHADOW[ui8Reg];
+    return true;
+}
+
+/**
+ *  \brief Update the shadow cache after a bus access
+ *  
+ *  \param [in] dev Device handle
+ *  \param [in] ui8Reg Register address
+ *  \param [in] ui8Data Register value read from or written to the sensor
+ *  
+ *  \details Called by the transport layer for every register access.
+ *  Registers which are not cacheable are ignored. The cached full scale
+ *  ranges of the device handle follow ACCEL_CONFIG and GYRO_CONFIG, the
+ *  FIFO layout follows FIFO_EN, whichever function wrote the register.
+ */
+void mpu6050_shadowUpdate(tMPU6050_DEV *dev, uint8_t ui8Reg, uint8_t ui8Data)
+{
+    tMPU6050_FIFO_EN fifoEn;
+
+    ui8Reg &= 0x7F;
+
+    if(!mpu6050_shadowCacheable(ui8Reg))
+        return;
+
+    switch(ui8Reg)
+    {
+    case MPU6050_PWR_MGMT_1:
+        if(ui8Data & SHADOW_PWR_MGMT_1_DEVICE_RESET)
+        {
+            // all registers return to their reset values
+            mpu6050_shadowInvalidate(dev);
+            mpu6050_devAccelRangeSet(dev, 0);
+            mpu6050_devGyroRangeSet(dev, 0);
+            fifoEn.RAW = 0;
+            mpu6050_fifoLayoutUpdate(dev, &fifoEn);
+            return;
+        }
+        break;
+    case MPU6050_USER_CTRL:
+        ui8Data &= ~SHADOW_USER_CTRL_RESET_BITS;
+        break;
+    case MPU6050_ACCEL_CONFIG:
+        mpu6050_devAccelRangeSet(dev, (ui8Data >> 3) & 0x03);
+        break;
+    case MPU6050_GYRO_CONFIG:
+        mpu6050_devGyroRangeSet(dev, (ui8Data >> 3) & 0x03);
+        break;
+    case MPU6050_FIFO_EN:
+        fifoEn.RAW = ui8Data;
+        mpu6050_fifoLayoutUpdate(dev, &fifoEn);
+        break;
+    default:
+        break;
+    }
+
+    dev->SHADOW[ui8Reg] = ui8Data;
+    dev->SHADOW_VALID[ui8Reg >> 5] |= 1UL << (ui8Reg & 0x1F);
+}
+
+/**
+ *  \brief Invalidate the whole shadow cache
+ *  
+ *  \param [in] dev Device handle
+ *  
+ *  \details The next access of every register goes to the bus.
+ */
+void mpu6050_shadowInvalidate(tMPU6050_DEV *dev)
+{
+    uint8_t i;
+
+    for(i = 0; i < sizeof(dev->SHADOW_VALID) / sizeof(dev->SHADOW_VALID[0]); i++)
+        dev->SHADOW_VALID[i] = 0;
+}
+
+/**
+ *  \brief Read a register field
+ *  
+ *  \param [in] dev Device handle
+ *  \param [in] ui8Reg Register address
+ *  \param [in] ui8Mask Field mask within the register
+ *  \return Field value, shifted to bit 0
+ *  
+ *  \details Use the MPU6050_FIELD_* defines for ui8Reg and ui8Mask.
+ *  Cached registers are read without bus access.
+ */
+uint8_t mpu6050_shadowFieldRead(tMPU6050_DEV *dev, uint8_t ui8Reg, uint8_t ui8Mask)
+{
+    uint8_t reg = mpu6050_busRead(dev, ui8Reg) & ui8Mask;
+
+    while(ui8Mask && !(ui8Mask & 0x01))
+    {
+        ui8Mask >>= 1;
+        reg >>= 1;
+    }
+
+    return reg;
+}
+
+/**
+ *  \brief Write a register field
+ *  
+ *  \param [in] dev Device handle
+ *  \param [in] ui8Reg Register address
+ *  \param [in] ui8Mask Field mask within the register
+ *  \param [in] ui8Value New field value, starting at bit 0
+ *  \return true if the register was written
+ *  
+ *  \details Use the MPU6050_FIELD_* defines for ui8Reg and ui8Mask, e.g.
+ *  mpu6050_shadowFieldWrite(dev, MPU6050_FIELD_DLPF_CFG, 3). The register is
+ *  only written if the field changes. For cached registers no read is needed.
+ */
+bool mpu6050_shadowFieldWrite(tMPU6050_DEV *dev, uint8_t ui8Reg, uint8_t ui8Mask, uint8_t ui8Value)
+{
+    uint8_t reg = mpu6050_busRead(dev, ui8Reg);
+    uint8_t shift = 0;
+    uint8_t value;
+
+    while(shift < 8 && !(ui8Mask & (1 << shift)))
+        shift++;
+
+    value = (uint8_t)((reg & ~ui8Mask) | ((ui8Value << shift) & ui8Mask));
+    if(value == reg)
+        return false;
+
+    mpu6050_busWrite(dev, ui8Reg, value);
+    return true;
+}
@@ -0,0 +1,109 @@
+/*
+ * This file is part of the MPU6050-Library distribution (https://github.com/jmherzog-de/MPU6050-Library).
+ * Copyright (c) 2021 Jean-Marcel Herzog.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ *  \file mpu6050_shadowRegisters.h
+ *  \brief Shadow Registers headerfile
+ *  \copyright Copyright 2021 Jean-Marcel Herzog. All rights reserved. This project is released under the GNU Public License.
+ */
+
+#ifndef MPU6050_SHADOWREGISTERS_H_
+#define MPU6050_SHADOWREGISTERS_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "mpu6050_transport.h"
+
+/*
+ *  Register fields for mpu6050_shadowFieldWrite() and mpu6050_shadowFieldRead().
+ *  Every define expands to the register address and the field mask.
+ */
+#define MPU6050_FIELD_SMPLRT_DIV            MPU6050_SMPRT_DIV, 0xFF
+
+#define MPU6050_FIELD_EXT_SYNC_SET          MPU6050_CONFIG, 0x38
+#define MPU6050_FIELD_DLPF_CFG              MPU6050_CONFIG, 0x07
+
+#define MPU6050_FIELD_XG_ST                 MPU6050_GYRO_CONFIG, 0x80
+#define MPU6050_FIELD_YG_ST                 MPU6050_GYRO_CONFIG, 0x40
+#define MPU6050_FIELD_ZG_ST                 MPU6050_GYRO_CONFIG, 0x20
+#define MPU6050_FIELD_FS_SEL                MPU6050_GYRO_CONFIG, 0x18
+
+#define MPU6050_FIELD_XA_ST                 MPU6050_ACCEL_CONFIG, 0x80
+#define MPU6050_FIELD_YA_ST                 MPU6050_ACCEL_CONFIG, 0x40
+#define MPU6050_FIELD_ZA_ST                 MPU6050_ACCEL_CONFIG, 0x20
+#define MPU6050_FIELD_AFS_SEL               MPU6050_ACCEL_CONFIG, 0x18
+
+#define MPU6050_FIELD_TEMP_FIFO_EN          MPU6050_FIFO_EN, 0x80
+#define MPU6050_FIELD_XG_FIFO_EN            MPU6050_FIFO_EN, 0x40
+#define MPU6050_FIELD_YG_FIFO_EN            MPU6050_FIFO_EN, 0x20
+#define MPU6050_FIELD_ZG_FIFO_EN            MPU6050_FIFO_EN, 0x10
+#define MPU6050_FIELD_ACCEL_FIFO_EN         MPU6050_FIFO_EN, 0x08
+#define MPU6050_FIELD_SLV2_FIFO_EN          MPU6050_FIFO_EN, 0x04
+#define MPU6050_FIELD_SLV1_FIFO_EN          MPU6050_FIFO_EN, 0x02
+#define MPU6050_FIELD_SLV0_FIFO_EN          MPU6050_FIFO_EN, 0x01
+
+#define MPU6050_FIELD_MULT_MST_EN           MPU6050_I2C_MST_CTRL, 0x80
+#define MPU6050_FIELD_WAIT_FOR_ES           MPU6050_I2C_MST_CTRL, 0x40
+#define MPU6050_FIELD_SLV_3_FIFO_EN         MPU6050_I2C_MST_CTRL, 0x20
+#define MPU6050_FIELD_I2C_MST_P_NSR         MPU6050_I2C_MST_CTRL, 0x10
+#define MPU6050_FIELD_I2C_MST_CLK           MPU6050_I2C_MST_CTRL, 0x0F
+
+#define MPU6050_FIELD_INT_LEVEL             MPU6050_INT_PIN_CFG, 0x80
+#define MPU6050_FIELD_INT_OPEN              MPU6050_INT_PIN_CFG, 0x40
+#define MPU6050_FIELD_LATCH_INT_EN          MPU6050_INT_PIN_CFG, 0x20
+#define MPU6050_FIELD_INT_RD_CLEAR          MPU6050_INT_PIN_CFG, 0x10
+#define MPU6050_FIELD_FSYNC_INT_LEVEL       MPU6050_INT_PIN_CFG, 0x08
+#define MPU6050_FIELD_FSYNC_INT_EN          MPU6050_INT_PIN_CFG, 0x04
+#define MPU6050_FIELD_I2C_BYPASS_EN         MPU6050_INT_PIN_CFG, 0x02
+
+#define MPU6050_FIELD_FIFO_OFLOW_EN         MPU6050_INT_ENABLE, 0x10
+#define MPU6050_FIELD_I2C_MST_INT_EN        MPU6050_INT_ENABLE, 0x08
+#define MPU6050_FIELD_DATA_RDY_EN           MPU6050_INT_ENABLE, 0x01
+
+#define MPU6050_FIELD_DELAY_ES_SHADOW       MPU6050_I2C_MST_DELAY_CT_RL, 0x80
+#define MPU6050_FIELD_I2C_SLV4_DLY_EN       MPU6050_I2C_MST_DELAY_CT_RL, 0x10
+#define MPU6050_FIELD_I2C_SLV3_DLY_EN       MPU6050_I2C_MST_DELAY_CT_RL, 0x08
+#define MPU6050_FIELD_I2C_SLV2_DLY_EN       MPU6050_I2C_MST_DELAY_CT_RL, 0x04
+#define MPU6050_FIELD_I2C_SLV1_DLY_EN       MPU6050_I2C_MST_DELAY_CT_RL, 0x02
+#define MPU6050_FIELD_I2C_SLV0_DLY_EN       MPU6050_I2C_MST_DELAY_CT_RL, 0x01
+
+#define MPU6050_FIELD_USER_FIFO_EN          MPU6050_USER_CTRL, 0x40
+#define MPU6050_FIELD_I2C_MST_EN            MPU6050_USER_CTRL, 0x20
+#define MPU6050_FIELD_I2C_IF_DIS            MPU6050_USER_CTRL, 0x10
+
+#define MPU6050_FIELD_SLEEP                 MPU6050_PWR_MGMT_1, 0x40
+#define MPU6050_FIELD_CYCLE                 MPU6050_PWR_MGMT_1, 0x20
+#define MPU6050_FIELD_TEMP_DIS              MPU6050_PWR_MGMT_1, 0x08
+#define MPU6050_FIELD_CLKSEL                MPU6050_PWR_MGMT_1, 0x07
+
+#define MPU6050_FIELD_LP_WAKE_CTRL          MPU6050_PWR_MGMT_2, 0xC0
+#define MPU6050_FIELD_STBY_XA               MPU6050_PWR_MGMT_2, 0x20
+#define MPU6050_FIELD_STBY_YA               MPU6050_PWR_MGMT_2, 0x10
+#define MPU6050_FIELD_STBY_ZA               MPU6050_PWR_MGMT_2, 0x08
+#define MPU6050_FIELD_STBY_XG               MPU6050_PWR_MGMT_2, 0x04
+#define MPU6050_FIELD_STBY_YG               MPU6050_PWR_MGMT_2, 0x02
+#define MPU6050_FIELD_STBY_ZG               MPU6050_PWR_MGMT_2, 0x01
+
+extern bool mpu6050_shadowCacheable(uint8_t ui8Reg);
+extern bool mpu6050_shadowLookup(tMPU6050_DEV*, uint8_t ui8Reg, uint8_t *pui8Data);
+extern void mpu6050_shadowUpdate(tMPU6050_DEV*, uint8_t ui8Reg, uint8_t ui8Data);
+extern void mpu6050_shadowInvalidate(tMPU6050_DEV*);
+
+extern uint8_t mpu6050_shadowFieldRead(tMPU6050_DEV*, uint8_t ui8Reg, uint8_t ui8Mask);
+extern bool mpu6050_shadowFieldWrite(tMPU6050_DEV*, uint8_t ui8Reg, uint8_t ui8Mask, uint8_t ui8Value);
+
+#endif
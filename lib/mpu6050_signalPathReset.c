@@ -31,32 +31,29 @@
  *  \copyright Copyright 2021 Jean-Marcel Herzog. All rights reserved. This project is released under the GNU Public License.
  */
 
+#include "mpu6050_registerCodec.h"
 #include "mpu6050_signalPathReset.h"
 
 /**
  *  \brief Read signal path reset register
+ *  \param [in] dev Device handle
  *  \param [in] obj Datatype pointer to store read values
  *  
  *  \details See register datasheet chapter 4.26 for more details.
  */
-void mpu6050_signalPathResetReadReg(tMPU6050_SIGNAL_PATH_RESET *obj)
+void mpu6050_signalPathResetReadReg(tMPU6050_DEV *dev, tMPU6050_SIGNAL_PATH_RESET *obj)
 {
-    uint8_t reg = i2c_receive(MPU6050_I2C_ADDR, MPU6050_SIGNAL_PATH_RESET);
-    obj->GYRO_RESET = (reg >> 2) & 0x01;
-    obj->ACCEL_RESET = (reg >> 1) & 0x01;
-    obj->TEMP_RESET = reg & 0x01;
+    mpu6050_regRead(dev, MPU6050_CODEC_SIGNAL_PATH_RESET, obj);
 }
 
 /**
  *  \brief Write signal path reset register
+ *  \param [in] dev Device handle
  *  \param [in] obj Datatype pointer to store read values
  *  
  *  \details See register datasheet chapter 4.26 for more details.
  */
-void mpu6050_signalPathResetWriteReg(tMPU6050_SIGNAL_PATH_RESET *obj)
+void mpu6050_signalPathResetWriteReg(tMPU6050_DEV *dev, tMPU6050_SIGNAL_PATH_RESET *obj)
 {
-    uint8_t reg = obj->GYRO_RESET << 2;
-    reg |= obj->ACCEL_RESET << 1;
-    reg |= obj->TEMP_RESET;
-    i2c_write(MPU6050_I2C_ADDR, MPU6050_SIGNAL_PATH_RESET, reg);
+    mpu6050_regWrite(dev, MPU6050_CODEC_SIGNAL_PATH_RESET, obj);
 }
\ No newline at end of file
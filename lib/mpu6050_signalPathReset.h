@@ -26,22 +26,26 @@
 
 #include <stdint.h>
 #include <stdbool.h>
-#include "i2c.h"
-#include "mpu6050_reg.h"
+#include "mpu6050_transport.h"
 
 /**
  *  \brief Datatype for Signal Path Reset register
  */
-typedef struct
+typedef union
 {
-    
-    bool GYRO_RESET;	/**< When set to 1, this bit resets the gyroscope analog and digital signal paths. */
-    bool ACCEL_RESET;	/**< When set to 1, this bit resets the accelerometer analog and digital signal paths. */
-    bool TEMP_RESET;	/**< When set to 1, this bit resets the temperature sensor analog and digital signal paths. */
+    uint8_t RAW;                /**< Register value */
+
+    struct
+    {
+        bool TEMP_RESET : 1;	/**< When set to 1, this bit resets the temperature sensor analog and digital signal paths. */
+        bool ACCEL_RESET : 1;	/**< When set to 1, this bit resets the accelerometer analog and digital signal paths. */
+        bool GYRO_RESET : 1;	/**< When set to 1, this bit resets the gyroscope analog and digital signal paths. */
+        unsigned char : 5;
+    };
 }
 tMPU6050_SIGNAL_PATH_RESET;
 
-extern void mpu6050_signalPathResetReadReg(tMPU6050_SIGNAL_PATH_RESET*);
-extern void mpu6050_signalPathResetWriteReg(tMPU6050_SIGNAL_PATH_RESET*);
+extern void mpu6050_signalPathResetReadReg(tMPU6050_DEV*, tMPU6050_SIGNAL_PATH_RESET*);
+extern void mpu6050_signalPathResetWriteReg(tMPU6050_DEV*, tMPU6050_SIGNAL_PATH_RESET*);
 
 #endif
\ No newline at end of file
@@ -0,0 +1,138 @@
+/*
+ * This file is part of the MPU6050-Library distribution (https://github.com/jmherzog-de/MPU6050-Library).
+ * Copyright (c) 2021 Jean-Marcel Herzog.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ *  \file mpu6050_snapshot.c
+ *  \brief Register Snapshot
+ *  
+ *  Captures the complete register map with one burst read and writes a
+ *  captured configuration back with as few burst writes as possible, e.g.
+ *  to restore the sensor after a brown-out without the full init path.
+ *  
+ *  The snapshot reads SELF_TEST_X (0x0D) up to FIFO_COUNTL (0x73) in one
+ *  burst. FIFO_R_W is skipped because reading it removes a byte from the
+ *  FIFO; WHO_AM_I is read separately.
+ *  
+ *  \note Reading the register map clears INT_STATUS, like every read of it.
+ *  
+ *  \copyright Copyright 2021 Jean-Marcel Herzog. All rights reserved. This project is released under the GNU Public License.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "mpu6050_device.h"
+#include "mpu6050_shadowRegisters.h"
+#include "mpu6050_batchWrite.h"
+#include "mpu6050_snapshot.h"
+
+/**
+ *  \brief Check if a register address is documented in the register map
+ *  
+ *  \param [in] ui8Reg Register address
+ *  \return true for a documented register
+ */
+static bool mpu6050_snapshotDocumented(uint8_t ui8Reg)
+{
+    if(ui8Reg >= MPU6050_SELF_TEST_X && ui8Reg <= MPU6050_SELF_TEST_A)
+        return true;
+    if(ui8Reg >= MPU6050_SMPRT_DIV && ui8Reg <= MPU6050_ACCEL_CONFIG)
+        return true;
+    if(ui8Reg >= MPU6050_FIFO_EN && ui8Reg <= MPU6050_INT_ENABLE)
+        return true;
+    if(ui8Reg >= MPU6050_INT_STATUS && ui8Reg <= MPU6050_EXT_SENS_DATA_23)
+        return true;
+    if(ui8Reg >= MPU6050_I2C_SLV0_DO && ui8Reg <= MPU6050_SIGNAL_PATH_RESET)
+        return true;
+    if(ui8Reg >= MPU6050_USER_CTRL && ui8Reg <= MPU6050_PWR_MGMT_2)
+        return true;
+    return ui8Reg >= MPU6050_FIFO_COUNTH && ui8Reg <= MPU6050_WHO_AM_I;
+}
+
+/**
+ *  \brief Capture the register map
+ *  
+ *  \param [in] dev Device handle
+ *  \param [in] obj Datatype pointer to return the register values
+ *  
+ *  \details Two bus transactions. The shadow cache is refreshed with the
+ *  captured configuration registers.
+ */
+void mpu6050_snapshot(tMPU6050_DEV *dev, tMPU6050_SNAPSHOT *obj)
+{
+    uint8_t reg;
+
+    mpu6050_busReadBurst(dev, MPU6050_SNAPSHOT_FIRST, obj->REG, MPU6050_FIFO_COUNTL - MPU6050_SNAPSHOT_FIRST + 1);
+    for(reg = MPU6050_SNAPSHOT_FIRST; reg <= MPU6050_SNAPSHOT_LAST; reg++)
+        if(!mpu6050_snapshotDocumented(reg))
+            MPU6050_SNAPSHOT_REG(obj, reg) = 0;
+    MPU6050_SNAPSHOT_REG(obj, MPU6050_FIFO_R_W) = 0;
+    MPU6050_SNAPSHOT_REG(obj, MPU6050_WHO_AM_I) = mpu6050_busRead(dev, MPU6050_WHO_AM_I);
+}
+
+/**
+ *  \brief Restore the configuration of a snapshot
+ *  
+ *  \param [in] dev Device handle
+ *  \param [in] obj Register values to restore
+ *  \return Number of registers written
+ *  
+ *  \details Only the writable configuration registers (the registers held
+ *  in the shadow cache) are restored, and only if they differ from the
+ *  current value. The current values come from the shadow cache; if a
+ *  register is not cached, all configuration registers are read with one
+ *  burst first. The writes are coalesced into burst writes.
+ *  
+ *  Call mpu6050_shadowInvalidate() before if the sensor may have lost its
+ *  configuration, e.g. after a brown-out.
+ */
+uint8_t mpu6050_restore(tMPU6050_DEV *dev, const tMPU6050_SNAPSHOT *obj)
+{
+    tMPU6050_BATCH batch;
+    uint8_t buf[MPU6050_PWR_MGMT_2 - MPU6050_SNAPSHOT_FIRST + 1];
+    uint8_t reg, cached, value;
+    uint8_t count = 0;
+
+    for(reg = MPU6050_SNAPSHOT_FIRST; reg <= MPU6050_PWR_MGMT_2; reg++)
+    {
+        if(mpu6050_shadowCacheable(reg) && !mpu6050_shadowLookup(dev, reg, &cached))
+        {
+            // fills the shadow cache with the current configuration
+            mpu6050_busReadBurst(dev, MPU6050_SNAPSHOT_FIRST, buf, sizeof(buf));
+            break;
+        }
+    }
+
+    mpu6050_batchBegin(dev, &batch);
+
+    for(reg = MPU6050_SNAPSHOT_FIRST; reg <= MPU6050_PWR_MGMT_2; reg++)
+    {
+        if(!mpu6050_shadowCacheable(reg))
+            continue;
+
+        value = MPU6050_SNAPSHOT_REG(obj, reg);
+        mpu6050_shadowLookup(dev, reg, &cached);
+        if(value == cached)
+            continue;
+
+        mpu6050_busWrite(dev, reg, value);
+        count++;
+    }
+
+    mpu6050_batchCommit(dev);
+
+    return count;
+}
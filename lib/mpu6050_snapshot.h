@@ -0,0 +1,59 @@
+/*
+ * This file is part of the MPU6050-Library distribution (https://github.com/jmherzog-de/MPU6050-Library).
+ * Copyright (c) 2021 Jean-Marcel Herzog.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ *  \file mpu6050_snapshot.h
+ *  \brief Register Snapshot headerfile
+ *  \copyright Copyright 2021 Jean-Marcel Herzog. All rights reserved. This project is released under the GNU Public License.
+ */
+
+#ifndef MPU6050_SNAPSHOT_H_
+#define MPU6050_SNAPSHOT_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "mpu6050_transport.h"
+
+/** First register of the documented register space */
+#define MPU6050_SNAPSHOT_FIRST      MPU6050_SELF_TEST_X
+
+/** Last register of the documented register space */
+#define MPU6050_SNAPSHOT_LAST       MPU6050_WHO_AM_I
+
+/** Number of registers in a snapshot */
+#define MPU6050_SNAPSHOT_SIZE       (MPU6050_SNAPSHOT_LAST - MPU6050_SNAPSHOT_FIRST + 1)
+
+/** Register value of a snapshot */
+#define MPU6050_SNAPSHOT_REG(snap, reg)     ((snap)->REG[(reg) - MPU6050_SNAPSHOT_FIRST])
+
+/**
+ *  \brief Datatype for a register map image
+ *  
+ *  Register values from SELF_TEST_X (0x0D) to WHO_AM_I (0x75), indexed by
+ *  register address - MPU6050_SNAPSHOT_FIRST. Use MPU6050_SNAPSHOT_REG().
+ *  Undocumented addresses and FIFO_R_W are 0.
+ */
+typedef struct
+{
+    uint8_t REG[MPU6050_SNAPSHOT_SIZE];
+}
+tMPU6050_SNAPSHOT;
+
+extern void mpu6050_snapshot(tMPU6050_DEV*, tMPU6050_SNAPSHOT*);
+extern uint8_t mpu6050_restore(tMPU6050_DEV*, const tMPU6050_SNAPSHOT*);
+
+#endif
@@ -53,13 +53,14 @@
 
 /**
  *  \brief Read temperature measurement register
+ *  \param [in] dev Device handle
  *  \param [in] obj Datatype pointer to store read values
  *  
  *  \details See register datasheet chapter 4.18 for more details.
  */
-void mpu6050_tempOutReadReg(tMPU6050_TEMP *obj)
+void mpu6050_tempOutReadReg(tMPU6050_DEV *dev, tMPU6050_TEMP *obj)
 {
-    uint16_t high = (uint8_t)i2c_receive(MPU6050_I2C_ADDR, MPU6050_TEMP_OUT_H);
-    uint16_t low = (uint8_t)i2c_receive(MPU6050_I2C_ADDR, MPU6050_TEMP_OUT_L);
-    *obj = (high << 8) | low;
+    uint16_t high = (uint8_t)mpu6050_busRead(dev, MPU6050_TEMP_OUT_H);
+    uint16_t low = (uint8_t)mpu6050_busRead(dev, MPU6050_TEMP_OUT_L);
+    *obj = (int16_t)((high << 8) | low);
 }
\ No newline at end of file
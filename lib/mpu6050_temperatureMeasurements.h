@@ -26,12 +26,11 @@
 
 #include <stdint.h>
 #include <stdbool.h>
-#include "i2c.h"
-#include "mpu6050_reg.h"
+#include "mpu6050_transport.h"
 
 /** \brief Datatype for Temperature Measurement */
-typedef uint16_t tMPU6050_TEMP;
+typedef int16_t tMPU6050_TEMP;
 
-extern void mpu6050_tempOutReadReg(tMPU6050_TEMP*);
+extern void mpu6050_tempOutReadReg(tMPU6050_DEV*, tMPU6050_TEMP*);
 
 #endif
\ No newline at end of file
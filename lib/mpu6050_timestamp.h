@@ -0,0 +1,62 @@
+/*
+ * This file is part of the MPU6050-Library distribution (https://github.com/jmherzog-de/MPU6050-Library).
+ * Copyright (c) 2021 Jean-Marcel Herzog.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ *  \file mpu6050_timestamp.h
+ *  \brief FIFO Sample Timestamps headerfile
+ *  \copyright Copyright 2021 Jean-Marcel Herzog. All rights reserved. This project is released under the GNU Public License.
+ */
+
+#ifndef MPU6050_TIMESTAMP_H_
+#define MPU6050_TIMESTAMP_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "mpu6050_transport.h"
+#include "mpu6050_acquisition.h"
+#include "mpu6050_fifoReadWrite.h"
+
+/**
+ *  \brief Timestamp reconstruction of one device
+ *  
+ *  Times are host clock ticks in Q16.16, unwrapped to 64 bit.
+ */
+typedef struct
+{
+    tMPU6050_DEV *dev;          /**< Device the FIFO is drained from */
+    tMPU6050_CLOCK clock;       /**< Host clock */
+    uint32_t CLOCK_HZ;          /**< Frequency of clock */
+    uint32_t RAW;               /**< Clock reading of the last update */
+    int64_t HOST;               /**< Host time of the last update */
+    int64_t NEXT;               /**< Host time of the sample of the next frame read */
+    int64_t PERIOD;             /**< Sample period fitted against the host clock */
+    int64_t NOMINAL;            /**< Sample period from the configuration */
+    int64_t ERROR;              /**< Phase error of the last update */
+    uint16_t PENDING;           /**< Frames left in the FIFO by the last drain */
+    uint16_t OVERFLOWS;         /**< FIFO_STATUS.OVERFLOWS at the last update */
+    uint32_t UPDATES;           /**< Loop updates since the sample period was set */
+    bool LOCKED;                /**< The phase is locked to the frame count */
+}
+tMPU6050_TIMESTAMP;
+
+extern void mpu6050_tsInitialization(tMPU6050_TIMESTAMP*, tMPU6050_DEV*, tMPU6050_CLOCK clock, uint32_t ui32ClockHz);
+extern void mpu6050_tsRateUpdate(tMPU6050_TIMESTAMP*);
+extern void mpu6050_tsUpdate(tMPU6050_TIMESTAMP*, uint32_t ui32Clock, uint16_t ui16Frames, uint32_t *pui32Stamps);
+extern uint16_t mpu6050_tsDrain(tMPU6050_TIMESTAMP*, tMPU6050_MOTION *buf, uint32_t *pui32Stamps, uint16_t max);
+extern int32_t mpu6050_tsDriftPpm(const tMPU6050_TIMESTAMP*);
+
+#endif
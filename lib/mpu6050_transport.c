@@ -0,0 +1,184 @@
+/*
+ * This file is part of the MPU6050-Library distribution (https://github.com/jmherzog-de/MPU6050-Library).
+ * Copyright (c) 2021 Jean-Marcel Herzog.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ *  \file mpu6050_transport.c
+ *  \brief Bus transport
+ *  
+ *  All register modules access the sensor through the functions in this
+ *  file. They forward the access to the transport and slave address of the
+ *  device handle. This decouples the library from the hardware driver, so
+ *  the same code runs on a Tiva microcontroller or against the simulated
+ *  sensor on a host computer, for any number of sensors and buses.
+ *  
+ *  Configuration registers are served from the shadow cache of the device
+ *  handle if possible, see mpu6050_shadowRegisters.c. Writes are collected
+ *  while a batch is active, see mpu6050_batchWrite.c.
+ *  
+ *  \copyright Copyright 2021 Jean-Marcel Herzog. All rights reserved. This project is released under the GNU Public License.
+ */
+
+#include "mpu6050_device.h"
+#include "mpu6050_shadowRegisters.h"
+#include "mpu6050_batchWrite.h"
+
+/**
+ *  \brief Read one register
+ *  
+ *  \param [in] dev Device handle
+ *  \param [in] ui8Reg Register address to read from
+ *  \return Register value
+ */
+uint8_t mpu6050_busRead(tMPU6050_DEV *dev, uint8_t ui8Reg)
+{
+    uint8_t data;
+
+    if(mpu6050_shadowLookup(dev, ui8Reg, &data))
+        return data;
+
+    mpu6050_batchFlush(dev);
+    data = dev->transport->read(dev->transport->ctx, dev->ADDR, ui8Reg);
+    mpu6050_shadowUpdate(dev, ui8Reg, data);
+    return data;
+}
+
+/**
+ *  \brief Write one register
+ *  
+ *  \param [in] dev Device handle
+ *  \param [in] ui8Reg Register address to write
+ *  \param [in] ui8Data Register value
+ */
+void mpu6050_busWrite(tMPU6050_DEV *dev, uint8_t ui8Reg, uint8_t ui8Data)
+{
+    if(dev->batch)
+    {
+        mpu6050_batchWrite(dev, ui8Reg, ui8Data);
+        return;
+    }
+
+    dev->transport->write(dev->transport->ctx, dev->ADDR, ui8Reg, ui8Data);
+    mpu6050_shadowUpdate(dev, ui8Reg, ui8Data);
+}
+
+/**
+ *  \brief Read consecutive registers with one burst read
+ *  
+ *  \param [in] dev Device handle
+ *  \param [in] ui8Reg First register address to read from
+ *  \param [out] pui8Data Buffer to store the register values
+ *  \param [in] ui16Count Number of registers to read
+ *  
+ *  \details No bus access is needed if all registers are cached.
+ */
+void mpu6050_busReadBurst(tMPU6050_DEV *dev, uint8_t ui8Reg, uint8_t *pui8Data, uint16_t ui16Count)
+{
+    uint16_t i;
+
+    // FIFO_R_W does not auto increment
+    if(ui8Reg == MPU6050_FIFO_R_W)
+    {
+        mpu6050_batchFlush(dev);
+        dev->transport->readBurst(dev->transport->ctx, dev->ADDR, ui8Reg, pui8Data, ui16Count);
+        return;
+    }
+
+    for(i = 0; i < ui16Count; i++)
+        if(!mpu6050_shadowLookup(dev, ui8Reg + i, &pui8Data[i]))
+            break;
+
+    if(i == ui16Count)
+        return;
+
+    mpu6050_batchFlush(dev);
+    dev->transport->readBurst(dev->transport->ctx, dev->ADDR, ui8Reg, pui8Data, ui16Count);
+
+    for(i = 0; i < ui16Count; i++)
+        mpu6050_shadowUpdate(dev, ui8Reg + i, pui8Data[i]);
+}
+
+/**
+ *  \brief Write consecutive registers with one burst write
+ *  
+ *  \param [in] dev Device handle
+ *  \param [in] ui8Reg First register address to write
+ *  \param [in] pui8Data Register values
+ *  \param [in] ui16Count Number of registers to write
+ */
+void mpu6050_busWriteBurst(tMPU6050_DEV *dev, uint8_t ui8Reg, const uint8_t *pui8Data, uint16_t ui16Count)
+{
+    uint16_t i;
+
+    if(dev->batch && ui8Reg != MPU6050_FIFO_R_W)
+    {
+        for(i = 0; i < ui16Count; i++)
+            mpu6050_batchWrite(dev, ui8Reg + i, pui8Data[i]);
+        return;
+    }
+
+    mpu6050_batchFlush(dev);
+    dev->transport->writeBurst(dev->transport->ctx, dev->ADDR, ui8Reg, pui8Data, ui16Count);
+
+    if(ui8Reg != MPU6050_FIFO_R_W)
+        for(i = 0; i < ui16Count; i++)
+            mpu6050_shadowUpdate(dev, ui8Reg + i, pui8Data[i]);
+}
+
+/**
+ *  \brief Queue an asynchronous transfer
+ *  
+ *  \param [in] dev Device handle
+ *  \param [in] obj Transfer to queue
+ *  
+ *  \details Returns immediately. The transfer callback is called from
+ *  interrupt context once the transfer has finished. Transports without
+ *  asynchronous support execute the transfer blocking and call the
+ *  callback before this function returns.
+ */
+void mpu6050_busSubmit(tMPU6050_DEV *dev, tMPU6050_TRANSFER *obj)
+{
+    const tMPU6050_TRANSPORT *transport = dev->transport;
+
+    uint16_t i;
+
+    mpu6050_batchFlush(dev);
+
+    obj->SLAVE_ADDR = dev->ADDR;
+    obj->DONE = false;
+    obj->ERROR = 0;
+    obj->next = 0;
+
+    // write-through: the cache holds the value the sensor has after the transfer
+    if(!obj->READ && obj->REG != MPU6050_FIFO_R_W)
+        for(i = 0; i < obj->COUNT; i++)
+            mpu6050_shadowUpdate(dev, obj->REG + i, obj->DATA[i]);
+
+    if(transport->submit)
+    {
+        transport->submit(transport->ctx, obj);
+        return;
+    }
+
+    if(obj->READ)
+        transport->readBurst(transport->ctx, obj->SLAVE_ADDR, obj->REG, obj->DATA, obj->COUNT);
+    else
+        transport->writeBurst(transport->ctx, obj->SLAVE_ADDR, obj->REG, obj->DATA, obj->COUNT);
+
+    obj->DONE = true;
+    if(obj->callback)
+        obj->callback(obj);
+}
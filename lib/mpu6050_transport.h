@@ -0,0 +1,91 @@
+/*
+ * This file is part of the MPU6050-Library distribution (https://github.com/jmherzog-de/MPU6050-Library).
+ * Copyright (c) 2021 Jean-Marcel Herzog.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ *  \file mpu6050_transport.h
+ *  \brief Bus transport headerfile
+ *  \copyright Copyright 2021 Jean-Marcel Herzog. All rights reserved. This project is released under the GNU Public License.
+ */
+
+#ifndef MPU6050_TRANSPORT_H_
+#define MPU6050_TRANSPORT_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "mpu6050_reg.h"
+
+typedef struct tMPU6050_TRANSFER tMPU6050_TRANSFER;
+typedef struct tMPU6050_DEV tMPU6050_DEV;
+
+/**
+ *  \brief Completion callback of an asynchronous transfer
+ *  
+ *  Called from interrupt context when the transfer has finished.
+ */
+typedef void (*tMPU6050_TRANSFER_CALLBACK)(tMPU6050_TRANSFER *transfer);
+
+/**
+ *  \brief Asynchronous bus transfer
+ *  
+ *  Describes one multi-byte register read or write. The memory is owned by
+ *  the caller and must stay valid until DONE is set.
+ */
+struct tMPU6050_TRANSFER
+{
+    uint8_t SLAVE_ADDR;                     /**< I2C slave address, set by mpu6050_busSubmit() */
+    uint8_t REG;                            /**< First register address */
+    bool READ;                              /**< true for a burst read, false for a burst write */
+    uint8_t *DATA;                          /**< Data buffer */
+    uint16_t COUNT;                         /**< Number of bytes to transfer */
+    volatile bool DONE;                     /**< Set by the driver when the transfer has finished */
+    volatile uint32_t ERROR;                /**< Driver error code, 0 on success */
+    tMPU6050_TRANSFER_CALLBACK callback;    /**< Completion callback, may be 0 */
+    void *arg;                              /**< User argument for the callback */
+    tMPU6050_TRANSFER *next;                /**< Queue link, used by the driver */
+};
+
+/**
+ *  \brief Bus transport interface
+ *  
+ *  Set of functions the library uses to access the sensor registers.
+ *  Every hardware driver provides one instance of this type per bus (e.g.
+ *  per I2C module of the Tiva driver or per simulated sensor).
+ */
+typedef struct
+{
+    /** Read one register */
+    uint8_t (*read)(void *ctx, uint8_t ui8SlaveAddr, uint8_t ui8Reg);
+    /** Write one register */
+    void (*write)(void *ctx, uint8_t ui8SlaveAddr, uint8_t ui8Reg, uint8_t ui8Data);
+    /** Read ui16Count consecutive registers in one bus transaction */
+    void (*readBurst)(void *ctx, uint8_t ui8SlaveAddr, uint8_t ui8Reg, uint8_t *pui8Data, uint16_t ui16Count);
+    /** Write ui16Count consecutive registers in one bus transaction */
+    void (*writeBurst)(void *ctx, uint8_t ui8SlaveAddr, uint8_t ui8Reg, const uint8_t *pui8Data, uint16_t ui16Count);
+    /** Queue an asynchronous transfer and return immediately, may be 0 */
+    void (*submit)(void *ctx, tMPU6050_TRANSFER *transfer);
+    /** Driver specific context passed to every function */
+    void *ctx;
+}
+tMPU6050_TRANSPORT;
+
+extern uint8_t mpu6050_busRead(tMPU6050_DEV*, uint8_t ui8Reg);
+extern void mpu6050_busWrite(tMPU6050_DEV*, uint8_t ui8Reg, uint8_t ui8Data);
+extern void mpu6050_busReadBurst(tMPU6050_DEV*, uint8_t ui8Reg, uint8_t *pui8Data, uint16_t ui16Count);
+extern void mpu6050_busWriteBurst(tMPU6050_DEV*, uint8_t ui8Reg, const uint8_t *pui8Data, uint16_t ui16Count);
+extern void mpu6050_busSubmit(tMPU6050_DEV*, tMPU6050_TRANSFER*);
+
+#endif
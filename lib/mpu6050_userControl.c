@@ -37,40 +37,31 @@
  *  \copyright Copyright 2021 Jean-Marcel Herzog. All rights reserved. This project is released under the GNU Public License.
  */
 
+#include "mpu6050_registerCodec.h"
 #include "mpu6050_userControl.h"
 
 /**
  *  \brief Read User Control register
  *  
+ *  \param [in] dev Device handle
  *  \param [in] obj Datatype pointer to return register values
  *  
  *  \details See register datasheet chapter 4.27 for more details.
  */
-void mpu6050_userCtrlReadReg(tMPU6050_USER_CTRL *obj)
+void mpu6050_userCtrlReadReg(tMPU6050_DEV *dev, tMPU6050_USER_CTRL *obj)
 {
-    uint8_t reg = i2c_receive(MPU6050_I2C_ADDR, MPU6050_USER_CTRL);
-    obj->FIFO_EN = (reg >> 6) & 0x01;
-    obj->I2C_MST_EN = (reg >> 5) & 0x01;
-    obj->I2C_IF_DIS = (reg >> 4) & 0x01;
-    obj->FIFO_RESET = (reg >> 2) & 0x01;
-    obj->I2C_MST_RESET = (reg >> 1) & 0x01;
-    obj->SIG_COND_RESET = reg & 0x01;
+    mpu6050_regRead(dev, MPU6050_CODEC_USER_CTRL, obj);
 }
 
 /**
  *  \brief Write User Control register
  *  
+ *  \param [in] dev Device handle
  *  \param [in] obj Datatype pointer to register values
  *  
  *  \details See register datasheet chapter 4.27 for more details.
  */
-void mpu6050_userCtrlWriteReg(tMPU6050_USER_CTRL *obj)
+void mpu6050_userCtrlWriteReg(tMPU6050_DEV *dev, tMPU6050_USER_CTRL *obj)
 {
-    uint8_t reg = obj->FIFO_EN << 6;
-    reg |= obj->I2C_MST_EN << 5;
-    reg |= obj->I2C_IF_DIS << 4;
-    reg |= obj->FIFO_RESET << 2;
-    reg |= obj->I2C_MST_RESET << 1;
-    reg |= obj->SIG_COND_RESET;
-    i2c_write(MPU6050_I2C_ADDR, MPU6050_USER_CTRL, reg);
+    mpu6050_regWrite(dev, MPU6050_CODEC_USER_CTRL, obj);
 }
\ No newline at end of file
@@ -26,43 +26,47 @@
 
 #include <stdint.h>
 #include <stdbool.h>
-#include "i2c.h"
-#include "mpu6050_reg.h"
+#include "mpu6050_transport.h"
 
 /**
  *  \brief Datatype User Control
  */
-typedef struct
+typedef union
 {
-    /** When set to 1, this bit enables FIFO operations.
-     *  When this bit is cleared to 0, the FIFO buffer is disabled.
-     *  The FIFO buffer cannot be written to or read from while disabled.
-     *  The FIFO buffers state does not change unless the MPU-60X0 is power cycled. 
-     */
-    bool FIFO_EN;
-	
-    bool I2C_MST_EN;	/**< When set to 1, this bit enables I2C Master Mode. */
-	
-    bool I2C_IF_DIS;	/**< Always write this bit as zero. */
+    uint8_t RAW;                /**< Register value */
 
-    /** This bit resets the FIFO buffer when set to 1 while FIFO_EN equals 0.
-     * This bit automatically clears to 0 after the reset has been triggered. */
-    bool FIFO_RESET;
+    struct
+    {
+        /** When set to 1, this bit resets the signal paths for all sensors (gyroscopes,
+         * accelerometers and temperature sensor). This operation will also be clear the
+         * sensor registers. This bit automatically clears to 0 after the reset has been triggered.
+         * When resetting only the signal path ( and not the sensor registers), please use
+         * Register 104 (SIGNAL_PATH_RESET) */
+        bool SIG_COND_RESET : 1;
 
-    /** This bit resets the I2C Master when set to 1 while I2C_MST_EN equals 0.
-     * This bit automatically clears to 0 after the reset has been triggered. */
-    bool I2C_MST_RESET;
+        /** This bit resets the I2C Master when set to 1 while I2C_MST_EN equals 0.
+         * This bit automatically clears to 0 after the reset has been triggered. */
+        bool I2C_MST_RESET : 1;
 
-    /** When set to 1, this bit resets the signal paths for all sensors (gyroscopes,
-     * accelerometers and temperature sensor). This operation will also be clear the
-     * sensor registers. This bit automatically clears to 0 after the reset has been triggered.
-     * When resetting only the signal path ( and not the sensor registers), please use
-     * Register 104 (SIGNAL_PATH_RESET) */
-    bool SIG_COND_RESET;
+        /** This bit resets the FIFO buffer when set to 1 while FIFO_EN equals 0.
+         * This bit automatically clears to 0 after the reset has been triggered. */
+        bool FIFO_RESET : 1;
+        unsigned char : 1;
+        bool I2C_IF_DIS : 1;	/**< Always write this bit as zero. */
+        bool I2C_MST_EN : 1;	/**< When set to 1, this bit enables I2C Master Mode. */
+
+        /** When set to 1, this bit enables FIFO operations.
+         *  When this bit is cleared to 0, the FIFO buffer is disabled.
+         *  The FIFO buffer cannot be written to or read from while disabled.
+         *  The FIFO buffers state does not change unless the MPU-60X0 is power cycled. 
+         */
+        bool FIFO_EN : 1;
+        unsigned char : 1;
+    };
 }
 tMPU6050_USER_CTRL;
 
-extern void mpu6050_userCtrlReadReg(tMPU6050_USER_CTRL*);
-extern void mpu6050_userCtrlWriteReg(tMPU6050_USER_CTRL*);
+extern void mpu6050_userCtrlReadReg(tMPU6050_DEV*, tMPU6050_USER_CTRL*);
+extern void mpu6050_userCtrlWriteReg(tMPU6050_DEV*, tMPU6050_USER_CTRL*);
 
 #endif
\ No newline at end of file
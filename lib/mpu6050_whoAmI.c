@@ -35,11 +35,12 @@
 /**
  *  \brief Read Who Am I register
  *  
+ *  \param [in] dev Device handle
  *  \param [in] obj Datatype pointer to return register values
  *  
  *  \details See register datasheet chapter 4.32 for more details.
  */
-void mpu6050_whoAmIReadReg(tMPU6050_WHO_AM_I *obj)
+void mpu6050_whoAmIReadReg(tMPU6050_DEV *dev, tMPU6050_WHO_AM_I *obj)
 {
-    *obj = i2c_receive(MPU6050_I2C_ADDR, MPU6050_WHO_AM_I);
+    *obj = mpu6050_busRead(dev, MPU6050_WHO_AM_I);
 }
\ No newline at end of file
@@ -26,14 +26,13 @@
 
 #include <stdint.h>
 #include <stdbool.h>
-#include "i2c.h"
-#include "mpu6050_reg.h"
+#include "mpu6050_transport.h"
 
  /**
   *  Datatype for the Who Am I register
   */
 typedef uint8_t tMPU6050_WHO_AM_I;
 
-extern void mpu6050_whoAmIReadReg(tMPU6050_WHO_AM_I*);
+extern void mpu6050_whoAmIReadReg(tMPU6050_DEV*, tMPU6050_WHO_AM_I*);
 
 #endif
\ No newline at end of file